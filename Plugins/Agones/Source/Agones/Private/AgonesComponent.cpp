@@ -14,8 +14,8 @@
 
 #include "AgonesComponent.h"
 
+#include "AgonesTransport.h"
 #include "Engine/World.h"
-#include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "JsonUtilities/Public/JsonObjectConverter.h"
 #include "TimerManager.h"
@@ -55,23 +55,31 @@ void UAgonesComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     {
         WatchWebSocket->Close();
     }
+
+	if (Transport.IsValid())
+	{
+		Transport->CancelAll();
+		Transport.Reset();
+	}
+}
+
+FAgonesTransport& UAgonesComponent::GetTransport()
+{
+	if (!Transport.IsValid())
+	{
+		Transport = MakeShared<FAgonesTransport>(HttpPort, MaxInFlightRequests, MaxQueuedRequests);
+	}
+	return *Transport;
 }
 
-FHttpRequestRef UAgonesComponent::BuildAgonesRequest(const FString Path, const FHttpVerb Verb, const FString Content)
+void UAgonesComponent::SendAgonesRequest(
+	const FString& Path, const FHttpVerb Verb, FString Content, TFunction<void(FHttpResponsePtr, bool)> Completion,
+	const FAgonesErrorDelegate& ErrorDelegate, const FString& CoalesceKey)
 {
-	FHttpModule* Http = &FHttpModule::Get();
-	FHttpRequestRef Request = Http->CreateRequest();
-
-	Request->SetURL(FString::Format(
-		TEXT("http://localhost:{0}/{1}"), 
-{FStringFormatArg(HttpPort), FStringFormatArg(Path)}	
-	));
-	Request->SetVerb(Verb.ToString());
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	Request->SetHeader(TEXT("User-Agent"), TEXT("X-UnrealEngine-Agent"));
-	Request->SetHeader(TEXT("Accepts"), TEXT("application/json"));
-	Request->SetContentAsString(Content);
-	return Request;
+	if (!GetTransport().Send(Path, Verb, MoveTemp(Content), MoveTemp(Completion), CoalesceKey))
+	{
+		ErrorDelegate.ExecuteIfBound({TEXT("Agones request queue is full")});
+	}
 }
 
 void UAgonesComponent::HealthPing(const float RateSeconds)
@@ -106,24 +114,22 @@ void UAgonesComponent::ConnectSuccess(const FGameServerResponse GameServerRespon
 
 void UAgonesComponent::Ready(const FReadyDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("ready");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("ready", FHttpVerb::Post, TEXT("{}"),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::GameServer(const FGameServerDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("gameserver", FHttpVerb::Get, "");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("gameserver", FHttpVerb::Get, "",
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -132,8 +138,8 @@ void UAgonesComponent::GameServer(const FGameServerDelegate SuccessDelegate, con
 			}
 
 			SuccessDelegate.ExecuteIfBound(FGameServerResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::EnsureWebSocketConnection()
@@ -256,47 +262,46 @@ void UAgonesComponent::SetLabel(
 		return;
 	}
 
-	FHttpRequestRef Request = BuildAgonesRequest("metadata/label", FHttpVerb::Put, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("metadata/label", FHttpVerb::Put, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate, TEXT("metadata/label/") + Key);
 }
 
 void UAgonesComponent::Health(const FHealthDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("health");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	if (!GetTransport().SendHealth(
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		}))
+	{
+		ErrorDelegate.ExecuteIfBound({TEXT("Agones request queue is full")});
+	}
 }
 
 void UAgonesComponent::Shutdown(const FShutdownDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("shutdown");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("shutdown", FHttpVerb::Post, TEXT("{}"),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::SetAnnotation(
@@ -317,32 +322,30 @@ void UAgonesComponent::SetAnnotation(
 		return;
 	}
 
-	FHttpRequestRef Request = BuildAgonesRequest("metadata/annotation", FHttpVerb::Put, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("metadata/annotation", FHttpVerb::Put, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate, TEXT("metadata/annotation/") + Key);
 }
 
 void UAgonesComponent::Allocate(const FAllocateDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("allocate");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("allocate", FHttpVerb::Post, TEXT("{}"),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::Reserve(
@@ -356,17 +359,16 @@ void UAgonesComponent::Reserve(
 		return;
 	}
 
-	FHttpRequestRef Request = BuildAgonesRequest("reserve", FHttpVerb::Post, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("reserve", FHttpVerb::Post, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::PlayerConnect(
@@ -383,9 +385,8 @@ void UAgonesComponent::PlayerConnect(
 	// TODO(dom) - look at JSON encoding in UE4.
 	Json = Json.Replace(TEXT("playerId"), TEXT("playerID"));
 
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/connect", FHttpVerb::Post, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/connect", FHttpVerb::Post, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -394,8 +395,8 @@ void UAgonesComponent::PlayerConnect(
 			}
 
 			SuccessDelegate.ExecuteIfBound(FConnectedResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::PlayerDisconnect(
@@ -412,9 +413,8 @@ void UAgonesComponent::PlayerDisconnect(
 	// TODO(dom) - look at JSON encoding in UE4.
 	Json = Json.Replace(TEXT("playerId"), TEXT("playerID"));
 
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/disconnect", FHttpVerb::Post, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/disconnect", FHttpVerb::Post, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -423,8 +423,8 @@ void UAgonesComponent::PlayerDisconnect(
 			}
 
 			SuccessDelegate.ExecuteIfBound(FDisconnectResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::SetPlayerCapacity(
@@ -438,24 +438,22 @@ void UAgonesComponent::SetPlayerCapacity(
 		return;
 	}
 
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/capacity", FHttpVerb::Post, Json);
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/capacity", FHttpVerb::Post, MoveTemp(Json),
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			if (!IsValidResponse(bSucceeded, HttpResponse, ErrorDelegate))
 			{
 				return;
 			}
 
 			SuccessDelegate.ExecuteIfBound({});
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::GetPlayerCapacity(FGetPlayerCapacityDelegate SuccessDelegate, FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/capacity", FHttpVerb::Get, "");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/capacity", FHttpVerb::Get, "",
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -464,15 +462,14 @@ void UAgonesComponent::GetPlayerCapacity(FGetPlayerCapacityDelegate SuccessDeleg
 			}
 
 			SuccessDelegate.ExecuteIfBound(FCountResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::GetPlayerCount(FGetPlayerCountDelegate SuccessDelegate, FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/count", FHttpVerb::Get, "");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/count", FHttpVerb::Get, "",
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -481,14 +478,14 @@ void UAgonesComponent::GetPlayerCount(FGetPlayerCountDelegate SuccessDelegate, F
 			}
 
 			SuccessDelegate.ExecuteIfBound(FCountResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::IsPlayerConnected(
 	const FString PlayerId, const FIsPlayerConnectedDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest(
+	SendAgonesRequest(
 		FString::Format(TEXT("alpha/player/connected/{0}"),
 			static_cast<FStringFormatOrderedArguments>(
 				TArray<FStringFormatArg, TFixedAllocator<1>>{
@@ -497,11 +494,8 @@ void UAgonesComponent::IsPlayerConnected(
 			)
 		),
 		FHttpVerb::Get,
-		""
-	);
-	
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+		"",
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
             
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -510,16 +504,15 @@ void UAgonesComponent::IsPlayerConnected(
 			}
 
 			SuccessDelegate.ExecuteIfBound(FConnectedResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 void UAgonesComponent::GetConnectedPlayers(
 	const FGetConnectedPlayersDelegate SuccessDelegate, const FAgonesErrorDelegate ErrorDelegate)
 {
-	FHttpRequestRef Request = BuildAgonesRequest("alpha/player/connected/{0}", FHttpVerb::Get, "");
-	Request->OnProcessRequestComplete().BindWeakLambda(this,
-		[SuccessDelegate, ErrorDelegate](FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
+	SendAgonesRequest("alpha/player/connected", FHttpVerb::Get, "",
+		[SuccessDelegate, ErrorDelegate](const FHttpResponsePtr HttpResponse, const bool bSucceeded) {
 			TSharedPtr<FJsonObject> JsonObject;
 
 			if (!IsValidJsonResponse(JsonObject, bSucceeded, HttpResponse, ErrorDelegate))
@@ -528,8 +521,8 @@ void UAgonesComponent::GetConnectedPlayers(
 			}
 			
 			SuccessDelegate.ExecuteIfBound(FConnectedPlayersResponse(JsonObject));
-		});
-	Request->ProcessRequest();
+		},
+		ErrorDelegate);
 }
 
 bool UAgonesComponent::IsValidResponse(const bool bSucceeded, const FHttpResponsePtr HttpResponse, FAgonesErrorDelegate ErrorDelegate)
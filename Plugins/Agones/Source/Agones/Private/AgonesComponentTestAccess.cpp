@@ -0,0 +1,45 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AgonesComponentTestAccess.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgonesTransport.h"
+
+void FAgonesComponentTestAccess::HandleWatchMessage(UAgonesComponent& Component, const void* Data, const SIZE_T Size, const SIZE_T BytesRemaining)
+{
+	Component.HandleWatchMessage(Data, Size, BytesRemaining);
+}
+
+void FAgonesComponentTestAccess::AddWatchCallback(UAgonesComponent& Component, const FGameServerDelegate& Callback)
+{
+	Component.WatchGameServerCallbacks.Add(Callback);
+}
+
+uint64 FAgonesComponentTestAccess::NumDispatched(UAgonesComponent& Component)
+{
+	return Component.GetTransport().NumDispatched();
+}
+
+void FAgonesComponentTestAccess::Shutdown(UAgonesComponent& Component)
+{
+	if (Component.Transport.IsValid())
+	{
+		Component.Transport->CancelAll();
+		Component.Transport.Reset();
+	}
+}
+
+#endif
@@ -0,0 +1,149 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AgonesTransport.h"
+
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+
+FAgonesTransport::FAgonesTransport(const FString& HttpPort, const int32 MaxInFlight, const int32 MaxQueued)
+	: BaseUrl(FString::Printf(TEXT("http://localhost:%s/"), *HttpPort))
+	, MaxInFlight(FMath::Max(1, MaxInFlight))
+	, MaxQueued(FMath::Max(1, MaxQueued))
+{
+	HealthUrl = BaseUrl + TEXT("health");
+	Queue.Reserve(this->MaxQueued);
+	InFlight.Reserve(this->MaxInFlight);
+
+	// Queued calls go out once per frame, which is what lets writes made within the same frame coalesce.
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAgonesTransport::Tick));
+}
+
+FAgonesTransport::~FAgonesTransport()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	CancelAll();
+}
+
+bool FAgonesTransport::Send(const FString& Path, const FHttpVerb Verb, FString Content, FCompletion Completion, const FString& CoalesceKey)
+{
+	if (!CoalesceKey.IsEmpty())
+	{
+		for (FPendingCall& Call : Queue)
+		{
+			if (Call.CoalesceKey == CoalesceKey)
+			{
+				Call.Content = MoveTemp(Content);
+				Call.Completions.Add(MoveTemp(Completion));
+				return true;
+			}
+		}
+	}
+
+	if (Queue.Num() >= MaxQueued)
+	{
+		return false;
+	}
+
+	FPendingCall& Call = Queue.Emplace_GetRef(Path, Verb, MoveTemp(Content), CoalesceKey);
+	Call.Completions.Add(MoveTemp(Completion));
+	return true;
+}
+
+bool FAgonesTransport::SendHealth(FCompletion Completion)
+{
+	for (FInFlightCall& Call : InFlight)
+	{
+		if (Call.CoalesceKey == HealthKey)
+		{
+			Call.Completions.Add(MoveTemp(Completion));
+			return true;
+		}
+	}
+
+	return Send(TEXT("health"), FHttpVerb::Post, TEXT("{}"), MoveTemp(Completion), HealthKey);
+}
+
+bool FAgonesTransport::Tick(float DeltaTime)
+{
+	Flush();
+	return true;
+}
+
+void FAgonesTransport::Flush()
+{
+	// Pop before dispatching, a request that fails synchronously re-enters Flush from its completion
+	while (Queue.Num() > 0 && InFlight.Num() < MaxInFlight)
+	{
+		FPendingCall Call = MoveTemp(Queue[0]);
+		Queue.RemoveAt(0, 1, false);
+		Dispatch(Call);
+	}
+}
+
+void FAgonesTransport::Dispatch(FPendingCall& Call)
+{
+	const FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Call.CoalesceKey == HealthKey ? HealthUrl : BaseUrl + Call.Path);
+	Request->SetVerb(Call.Verb.ToString());
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	Request->SetHeader(TEXT("User-Agent"), TEXT("X-UnrealEngine-Agent"));
+	Request->SetHeader(TEXT("Accepts"), TEXT("application/json"));
+	Request->SetContentAsString(Call.Content);
+	Request->OnProcessRequestComplete().BindSP(AsShared(), &FAgonesTransport::OnRequestComplete);
+
+	FInFlightCall& Sent = InFlight.AddDefaulted_GetRef();
+	Sent.Request = Request;
+	Sent.CoalesceKey = MoveTemp(Call.CoalesceKey);
+	Sent.Completions = MoveTemp(Call.Completions);
+
+	++DispatchedCount;
+	Request->ProcessRequest();
+}
+
+void FAgonesTransport::OnRequestComplete(FHttpRequestPtr HttpRequest, const FHttpResponsePtr HttpResponse, const bool bSucceeded)
+{
+	const int32 Index = InFlight.IndexOfByPredicate([&HttpRequest](const FInFlightCall& Call) { return Call.Request == HttpRequest; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	TArray<FCompletion, TInlineAllocator<1>> Completions = MoveTemp(InFlight[Index].Completions);
+	InFlight.RemoveAtSwap(Index, 1, false);
+
+	for (FCompletion& Completion : Completions)
+	{
+		if (Completion)
+		{
+			Completion(HttpResponse, bSucceeded);
+		}
+	}
+
+	// A slot just freed up, don't wait for the next frame to use it
+	Flush();
+}
+
+void FAgonesTransport::CancelAll()
+{
+	Queue.Reset();
+
+	TArray<FInFlightCall> Cancelled = MoveTemp(InFlight);
+	InFlight.Reset();
+	for (FInFlightCall& Call : Cancelled)
+	{
+		Call.Request->OnProcessRequestComplete().Unbind();
+		Call.Request->CancelRequest();
+	}
+}
@@ -0,0 +1,117 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "AgonesComponent.h"
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+/**
+ * \brief FAgonesTransport is the single pipeline every UAgonesComponent call goes through.
+ *
+ * Calls are queued and dispatched once per frame, at most MaxInFlight at a time, so a slow sidecar cannot pile up
+ * requests on the game thread. Queued calls that share a coalescing key are merged into one request carrying the
+ * latest body, and every caller's completion is run with that request's response.
+ */
+class FAgonesTransport : public TSharedFromThis<FAgonesTransport>
+{
+public:
+	using FCompletion = TFunction<void(FHttpResponsePtr HttpResponse, bool bSucceeded)>;
+
+	FAgonesTransport(const FString& HttpPort, int32 MaxInFlight, int32 MaxQueued);
+
+	~FAgonesTransport();
+
+	/**
+	 * \brief Send queues a call to the sidecar.
+	 * \param Path - Path relative to the SDK server root, e.g. "metadata/label".
+	 * \param Verb - Http verb.
+	 * \param Content - Json body.
+	 * \param Completion - Called with the response once the call completes.
+	 * \param CoalesceKey - Queued calls with the same non-empty key are merged and only the latest content is sent.
+	 * \return false if the queue is full. Completion is not called in that case.
+	 */
+	bool Send(const FString& Path, FHttpVerb Verb, FString Content, FCompletion Completion, const FString& CoalesceKey = FString());
+
+	/**
+	 * \brief SendHealth queues a health ping. A ping that is already queued or in flight absorbs this one.
+	 */
+	bool SendHealth(FCompletion Completion);
+
+	/**
+	 * \brief Flush dispatches queued calls until the in-flight limit is reached.
+	 */
+	void Flush();
+
+	/**
+	 * \brief CancelAll drops queued calls and cancels in-flight requests without running their completions.
+	 */
+	void CancelAll();
+
+	int32 NumQueued() const { return Queue.Num(); }
+
+	int32 NumInFlight() const { return InFlight.Num(); }
+
+	/** Number of requests actually sent to the sidecar, after coalescing */
+	uint64 NumDispatched() const { return DispatchedCount; }
+
+private:
+	struct FPendingCall
+	{
+		FPendingCall(const FString& InPath, const FHttpVerb InVerb, FString&& InContent, const FString& InCoalesceKey)
+			: Path(InPath), Verb(InVerb), Content(MoveTemp(InContent)), CoalesceKey(InCoalesceKey)
+		{
+		}
+
+		FString Path;
+		FHttpVerb Verb;
+		FString Content;
+		FString CoalesceKey;
+		TArray<FCompletion, TInlineAllocator<1>> Completions;
+	};
+
+	struct FInFlightCall
+	{
+		FHttpRequestPtr Request;
+		FString CoalesceKey;
+		TArray<FCompletion, TInlineAllocator<1>> Completions;
+	};
+
+	bool Tick(float DeltaTime);
+
+	void Dispatch(FPendingCall& Call);
+
+	void OnRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+
+	FString BaseUrl;
+
+	/** Built once; every ping sends the same url and body */
+	FString HealthUrl;
+
+	const FString HealthKey = TEXT("health");
+
+	int32 MaxInFlight;
+
+	int32 MaxQueued;
+
+	TArray<FPendingCall> Queue;
+
+	TArray<FInFlightCall> InFlight;
+
+	uint64 DispatchedCount = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
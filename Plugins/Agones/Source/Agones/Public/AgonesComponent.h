@@ -22,6 +22,8 @@
 
 #include "AgonesComponent.generated.h"
 
+class FAgonesTransport;
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAgonesErrorDelegate, const FAgonesError&, Error);
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAllocateDelegate, const FEmptyResponse&, Response);
@@ -119,6 +121,18 @@ public:
 	UPROPERTY(EditAnywhere, Category = Agones, Config)
 	bool bDisableAutoConnect;
 
+	/**
+	 * \brief MaxInFlightRequests is the number of SDK calls that may be waiting on the sidecar at once. Further calls are queued.
+	 */
+	UPROPERTY(EditAnywhere, Category = Agones, Config)
+	int32 MaxInFlightRequests = 4;
+
+	/**
+	 * \brief MaxQueuedRequests bounds the queue of calls waiting for an in-flight slot. Calls past this fail with an error.
+	 */
+	UPROPERTY(EditAnywhere, Category = Agones, Config)
+	int32 MaxQueuedRequests = 64;
+
 	/**
 	 * \brief ConnectedDelegate will be called once the Connect func gets a successful response from GameServer.
 	 */
@@ -291,8 +305,15 @@ public:
 	void SetPlayerCapacity(int64 Count, FSetPlayerCapacityDelegate SuccessDelegate, FAgonesErrorDelegate ErrorDelegate);
 
 private:
-	FHttpRequestRef BuildAgonesRequest(
-		FString Path = "", const FHttpVerb Verb = FHttpVerb::Post, const FString Content = "{}");
+	friend struct FAgonesComponentTestAccess;
+
+	FAgonesTransport& GetTransport();
+
+	void SendAgonesRequest(
+		const FString& Path, const FHttpVerb Verb, FString Content, TFunction<void(FHttpResponsePtr, bool)> Completion,
+		const FAgonesErrorDelegate& ErrorDelegate, const FString& CoalesceKey = FString());
+
+	TSharedPtr<FAgonesTransport> Transport;
 
 	void HandleWatchMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
 
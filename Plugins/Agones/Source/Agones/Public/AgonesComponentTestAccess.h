@@ -0,0 +1,41 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "AgonesComponent.h"
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * \brief FAgonesComponentTestAccess exposes the component internals the stand-in tests need, without widening the
+ * component's own interface.
+ */
+struct AGONES_API FAgonesComponentTestAccess
+{
+	/** Feeds one websocket fragment to the component, exactly as the watch socket's raw message event does */
+	static void HandleWatchMessage(UAgonesComponent& Component, const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+
+	/** Subscribes to watch updates without opening the websocket, which needs a world for its reconnect timer */
+	static void AddWatchCallback(UAgonesComponent& Component, const FGameServerDelegate& Callback);
+
+	/** Number of requests the component's transport has sent, after coalescing */
+	static uint64 NumDispatched(UAgonesComponent& Component);
+
+	/** Cancels everything the transport has queued or in flight, stands in for EndPlay on a component that never began play */
+	static void Shutdown(UAgonesComponent& Component);
+};
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using UnrealBuildTool;
+
+// The automation tests and the SDK server stand-in they run against. A DeveloperTool module, so the test listener
+// UCLASS never reaches a shipping build.
+public class AgonesTests : ModuleRules
+{
+	public AgonesTests(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		PrivateDependencyModuleNames.AddRange(
+			new[]
+			{
+				"Agones",
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"Http",
+				"HTTPServer",
+				"Json",
+				"JsonUtilities"
+			});
+	}
+}
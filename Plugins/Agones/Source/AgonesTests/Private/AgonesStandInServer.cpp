@@ -0,0 +1,289 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AgonesStandInServer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace AgonesStandIn
+{
+	FString VerbToString(const EHttpServerRequestVerbs Verb)
+	{
+		switch (Verb)
+		{
+			case EHttpServerRequestVerbs::VERB_GET:
+				return TEXT("GET");
+			case EHttpServerRequestVerbs::VERB_POST:
+				return TEXT("POST");
+			case EHttpServerRequestVerbs::VERB_PUT:
+				return TEXT("PUT");
+			default:
+				return TEXT("");
+		}
+	}
+
+	TSharedPtr<FJsonObject> ParseBody(const FString& Body)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Body);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			return MakeShared<FJsonObject>();
+		}
+		return JsonObject;
+	}
+
+	FString Serialize(const TSharedRef<FJsonObject>& JsonObject)
+	{
+		FString Json;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(JsonObject, JsonWriter);
+		return Json;
+	}
+
+	FString BoolResponse(const bool bValue)
+	{
+		return bValue ? TEXT("{\"bool\":true}") : TEXT("{\"bool\":false}");
+	}
+
+	FString CountResponse(const int64 Count)
+	{
+		return FString::Printf(TEXT("{\"count\":\"%lld\"}"), Count);
+	}
+
+	const FString EmptyResponse = TEXT("{}");
+}
+
+FAgonesStandInServer::FAgonesStandInServer(const uint32 InPort) : Port(InPort)
+{
+}
+
+FAgonesStandInServer::~FAgonesStandInServer()
+{
+	Stop();
+}
+
+bool FAgonesStandInServer::Start()
+{
+	Router = FHttpServerModule::Get().GetHttpRouter(Port);
+	if (!Router.IsValid())
+	{
+		return false;
+	}
+
+	using namespace AgonesStandIn;
+
+	Bind(TEXT("/ready"), [this](const FString&, const FString&, const FString&) {
+		State = TEXT("Ready");
+		return EmptyResponse;
+	});
+	Bind(TEXT("/allocate"), [this](const FString&, const FString&, const FString&) {
+		State = TEXT("Allocated");
+		return EmptyResponse;
+	});
+	Bind(TEXT("/reserve"), [this](const FString&, const FString&, const FString&) {
+		State = TEXT("Reserved");
+		return EmptyResponse;
+	});
+	Bind(TEXT("/shutdown"), [this](const FString&, const FString&, const FString&) {
+		State = TEXT("Shutdown");
+		return EmptyResponse;
+	});
+	Bind(TEXT("/health"), [](const FString&, const FString&, const FString&) {
+		return EmptyResponse;
+	});
+	Bind(TEXT("/gameserver"), [this](const FString&, const FString&, const FString&) {
+		return BuildGameServerJson(0);
+	});
+	Bind(TEXT("/metadata/label"), [this](const FString&, const FString&, const FString& Body) {
+		const TSharedPtr<FJsonObject> JsonObject = ParseBody(Body);
+		Labels.Add(JsonObject->GetStringField(TEXT("key")), JsonObject->GetStringField(TEXT("value")));
+		return EmptyResponse;
+	});
+	Bind(TEXT("/metadata/annotation"), [this](const FString&, const FString&, const FString& Body) {
+		const TSharedPtr<FJsonObject> JsonObject = ParseBody(Body);
+		Annotations.Add(JsonObject->GetStringField(TEXT("key")), JsonObject->GetStringField(TEXT("value")));
+		return EmptyResponse;
+	});
+	Bind(TEXT("/alpha/player/connect"), [this](const FString&, const FString&, const FString& Body) {
+		const FString PlayerId = ParseBody(Body)->GetStringField(TEXT("playerID"));
+		const bool bAdded = !Players.Contains(PlayerId) && Players.Num() < PlayerCapacity;
+		if (bAdded)
+		{
+			Players.Add(PlayerId);
+		}
+		return BoolResponse(bAdded);
+	});
+	Bind(TEXT("/alpha/player/disconnect"), [this](const FString&, const FString&, const FString& Body) {
+		const FString PlayerId = ParseBody(Body)->GetStringField(TEXT("playerID"));
+		return BoolResponse(Players.Remove(PlayerId) > 0);
+	});
+	Bind(TEXT("/alpha/player/capacity"), [this](const FString& Verb, const FString&, const FString& Body) {
+		if (Verb == TEXT("GET"))
+		{
+			return CountResponse(PlayerCapacity);
+		}
+		PlayerCapacity = static_cast<int64>(ParseBody(Body)->GetNumberField(TEXT("count")));
+		return EmptyResponse;
+	});
+	Bind(TEXT("/alpha/player/count"), [this](const FString&, const FString&, const FString&) {
+		return CountResponse(Players.Num());
+	});
+	Bind(TEXT("/alpha/player/connected"), [this](const FString&, const FString& RelativePath, const FString&) {
+		// "/alpha/player/connected/{id}" asks about one player, the bare route lists them all
+		FString PlayerId = RelativePath;
+		PlayerId.RemoveFromStart(TEXT("/"));
+		if (!PlayerId.IsEmpty())
+		{
+			return BoolResponse(Players.Contains(PlayerId));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> List;
+		for (const FString& Player : Players)
+		{
+			List.Add(MakeShared<FJsonValueString>(Player));
+		}
+		const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetArrayField(TEXT("list"), List);
+		return Serialize(JsonObject);
+	});
+
+	FHttpServerModule::Get().StartAllListeners();
+	return true;
+}
+
+void FAgonesStandInServer::Stop()
+{
+	if (Router.IsValid())
+	{
+		for (const FHttpRouteHandle& Route : Routes)
+		{
+			Router->UnbindRoute(Route);
+		}
+	}
+	Routes.Reset();
+	Router.Reset();
+}
+
+void FAgonesStandInServer::Bind(const FString& Route, FRouteHandler Handler)
+{
+	// The router keys routes by path only, so each route takes every verb and the handler branches on it
+	const EHttpServerRequestVerbs Verbs =
+		EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_POST | EHttpServerRequestVerbs::VERB_PUT;
+
+	const FHttpRouteHandle Handle = Router->BindRoute(FHttpPath(Route), Verbs,
+		[this, Route, Handler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) {
+			Hits.FindOrAdd(Route)++;
+
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+			const FString Body(Converted.Length(), Converted.Get());
+
+			const FString Response = Handler(AgonesStandIn::VerbToString(Request.Verb), Request.RelativePath.GetPath(), Body);
+			OnComplete(FHttpServerResponse::Create(Response, TEXT("application/json")));
+			return true;
+		});
+
+	if (Handle.IsValid())
+	{
+		Routes.Add(Handle);
+	}
+}
+
+int32 FAgonesStandInServer::GetHits(const FString& Route) const
+{
+	const int32* Count = Hits.Find(Route);
+	return Count ? *Count : 0;
+}
+
+int32 FAgonesStandInServer::GetTotalHits() const
+{
+	int32 Total = 0;
+	for (const TPair<FString, int32>& Entry : Hits)
+	{
+		Total += Entry.Value;
+	}
+	return Total;
+}
+
+void FAgonesStandInServer::ResetHits()
+{
+	Hits.Reset();
+}
+
+FString FAgonesStandInServer::BuildWatchMessage(const int64 Generation) const
+{
+	return FString::Printf(TEXT("{\"result\":%s}"), *BuildGameServerJson(Generation));
+}
+
+FString FAgonesStandInServer::BuildGameServerJson(const int64 Generation) const
+{
+	const TSharedRef<FJsonObject> ObjectMeta = MakeShared<FJsonObject>();
+	ObjectMeta->SetStringField(TEXT("name"), TEXT("standin-gameserver"));
+	ObjectMeta->SetStringField(TEXT("namespace"), TEXT("default"));
+	ObjectMeta->SetStringField(TEXT("uid"), TEXT("00000000-0000-0000-0000-000000000000"));
+	ObjectMeta->SetStringField(TEXT("resource_version"), LexToString(Generation));
+	ObjectMeta->SetStringField(TEXT("generation"), LexToString(Generation));
+	ObjectMeta->SetStringField(TEXT("creation_timestamp"), TEXT("1600000000"));
+
+	const TSharedRef<FJsonObject> LabelsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FString>& Label : Labels)
+	{
+		LabelsObject->SetStringField(Label.Key, Label.Value);
+	}
+	ObjectMeta->SetObjectField(TEXT("labels"), LabelsObject);
+
+	const TSharedRef<FJsonObject> AnnotationsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FString>& Annotation : Annotations)
+	{
+		AnnotationsObject->SetStringField(Annotation.Key, Annotation.Value);
+	}
+	ObjectMeta->SetObjectField(TEXT("annotations"), AnnotationsObject);
+
+	const TSharedRef<FJsonObject> Health = MakeShared<FJsonObject>();
+	Health->SetBoolField(TEXT("disabled"), false);
+	Health->SetNumberField(TEXT("period_seconds"), 5);
+	Health->SetNumberField(TEXT("failure_threshold"), 3);
+	Health->SetNumberField(TEXT("initial_delay_seconds"), 5);
+
+	const TSharedRef<FJsonObject> Spec = MakeShared<FJsonObject>();
+	Spec->SetObjectField(TEXT("health"), Health);
+
+	const TSharedRef<FJsonObject> GamePort = MakeShared<FJsonObject>();
+	GamePort->SetStringField(TEXT("name"), TEXT("default"));
+	GamePort->SetNumberField(TEXT("port"), 7777);
+
+	const TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
+	Status->SetStringField(TEXT("state"), State);
+	Status->SetStringField(TEXT("address"), TEXT("127.0.0.1"));
+	Status->SetArrayField(TEXT("ports"), {MakeShared<FJsonValueObject>(GamePort)});
+
+	const TSharedRef<FJsonObject> GameServer = MakeShared<FJsonObject>();
+	GameServer->SetObjectField(TEXT("object_meta"), ObjectMeta);
+	GameServer->SetObjectField(TEXT("spec"), Spec);
+	GameServer->SetObjectField(TEXT("status"), Status);
+	return AgonesStandIn::Serialize(GameServer);
+}
+
+#endif
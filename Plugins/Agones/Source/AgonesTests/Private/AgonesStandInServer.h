@@ -0,0 +1,99 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "AgonesComponent.h"
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpRouteHandle.h"
+
+class IHttpRouter;
+
+/**
+ * \brief FAgonesStandInServer answers the SDK server REST endpoints the way the Agones sidecar does, so UAgonesComponent
+ * can be exercised on a machine with no cluster.
+ *
+ * It keeps a small game server state (lifecycle state, labels, annotations, player tracking) that the endpoints read
+ * and write, and counts the requests each route received so tests can check what actually went over the wire.
+ */
+class FAgonesStandInServer
+{
+public:
+	explicit FAgonesStandInServer(uint32 InPort);
+
+	~FAgonesStandInServer();
+
+	/**
+	 * \brief Start binds every SDK route on Port and starts the http listeners.
+	 * \return false if the router could not be created, e.g. the port is taken.
+	 */
+	bool Start();
+
+	/**
+	 * \brief Stop unbinds the routes. Listeners are left running, other systems may share them.
+	 */
+	void Stop();
+
+	uint32 GetPort() const { return Port; }
+
+	/** Number of requests received on Route, e.g. "/metadata/label" */
+	int32 GetHits(const FString& Route) const;
+
+	/** Total number of requests received on all routes */
+	int32 GetTotalHits() const;
+
+	void ResetHits();
+
+	const FString& GetState() const { return State; }
+
+	const TMap<FString, FString>& GetLabels() const { return Labels; }
+
+	const TMap<FString, FString>& GetAnnotations() const { return Annotations; }
+
+	/**
+	 * \brief BuildWatchMessage returns the frame the sidecar pushes on /watch/gameserver, with the current state and
+	 * the given generation.
+	 */
+	FString BuildWatchMessage(int64 Generation) const;
+
+private:
+	using FRouteHandler = TFunction<FString(const FString& Verb, const FString& RelativePath, const FString& Body)>;
+
+	void Bind(const FString& Route, FRouteHandler Handler);
+
+	FString BuildGameServerJson(int64 Generation) const;
+
+	uint32 Port;
+
+	TSharedPtr<IHttpRouter> Router;
+
+	TArray<FHttpRouteHandle> Routes;
+
+	TMap<FString, int32> Hits;
+
+	FString State = TEXT("Scheduled");
+
+	TMap<FString, FString> Labels;
+
+	TMap<FString, FString> Annotations;
+
+	TArray<FString> Players;
+
+	int64 PlayerCapacity = 0;
+};
+
+#endif
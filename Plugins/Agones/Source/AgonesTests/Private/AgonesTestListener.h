@@ -0,0 +1,76 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "Classes.h"
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "AgonesTestListener.generated.h"
+
+/**
+ * \brief UAgonesTestListener receives UAgonesComponent responses in the automation tests, the component's delegates
+ * are dynamic and can only be bound to UFunctions. Lives in the AgonesTests module, which isn't built for shipping.
+ */
+UCLASS(Transient)
+class UAgonesTestListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnEmpty(const FEmptyResponse& Response);
+
+	UFUNCTION()
+	void OnGameServer(const FGameServerResponse& Response);
+
+	UFUNCTION()
+	void OnConnected(const FConnectedResponse& Response);
+
+	UFUNCTION()
+	void OnDisconnected(const FDisconnectResponse& Response);
+
+	UFUNCTION()
+	void OnCount(const FCountResponse& Response);
+
+	UFUNCTION()
+	void OnConnectedPlayers(const FConnectedPlayersResponse& Response);
+
+	UFUNCTION()
+	void OnError(const FAgonesError& Error);
+
+	/** Number of responses, successful or not */
+	int32 NumResponses() const { return NumSucceeded + NumFailed; }
+
+	int32 NumSucceeded = 0;
+
+	int32 NumFailed = 0;
+
+	/** FPlatformTime::Seconds() of the last response */
+	double LastResponseTime = 0.0;
+
+	FString LastError;
+
+	FGameServerResponse LastGameServer;
+
+	bool bLastBool = false;
+
+	int64 LastCount = 0;
+
+	TArray<FString> LastPlayers;
+
+private:
+	void Record(bool bSucceeded);
+};
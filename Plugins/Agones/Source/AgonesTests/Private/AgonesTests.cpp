@@ -0,0 +1,581 @@
+// Copyright 2020 Google LLC All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AgonesTestListener.h"
+
+#include "HAL/PlatformTime.h"
+
+void UAgonesTestListener::OnEmpty(const FEmptyResponse& Response)
+{
+	Record(true);
+}
+
+void UAgonesTestListener::OnGameServer(const FGameServerResponse& Response)
+{
+	LastGameServer = Response;
+	Record(true);
+}
+
+void UAgonesTestListener::OnConnected(const FConnectedResponse& Response)
+{
+	bLastBool = Response.bConnected;
+	Record(true);
+}
+
+void UAgonesTestListener::OnDisconnected(const FDisconnectResponse& Response)
+{
+	bLastBool = Response.bDisconnected;
+	Record(true);
+}
+
+void UAgonesTestListener::OnCount(const FCountResponse& Response)
+{
+	LastCount = Response.Count;
+	Record(true);
+}
+
+void UAgonesTestListener::OnConnectedPlayers(const FConnectedPlayersResponse& Response)
+{
+	LastPlayers = Response.ConnectedPlayers;
+	Record(true);
+}
+
+void UAgonesTestListener::OnError(const FAgonesError& Error)
+{
+	LastError = Error.ErrorMessage;
+	Record(false);
+}
+
+void UAgonesTestListener::Record(const bool bSucceeded)
+{
+	++(bSucceeded ? NumSucceeded : NumFailed);
+	LastResponseTime = FPlatformTime::Seconds();
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgonesComponent.h"
+#include "AgonesComponentTestAccess.h"
+#include "AgonesStandInServer.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace AgonesTests
+{
+	/** Away from the sidecar's default 9358 so a real sidecar on the box is left alone */
+	constexpr uint32 StandInPort = 19358;
+
+	constexpr double TimeoutSeconds = 30.0;
+
+	constexpr int32 SequentialCalls = 50;
+
+	constexpr int32 BurstCalls = 200;
+
+	constexpr int32 WatchMessages = 2000;
+
+	/** libwebsockets hands over large frames in pieces, every other watch message is split to exercise the buffering */
+	constexpr int32 WatchFragmentSize = 256;
+
+	template <typename TDelegate>
+	TDelegate BindListener(UAgonesTestListener* Listener, const FName Function)
+	{
+		TDelegate Delegate;
+		Delegate.BindUFunction(Listener, Function);
+		return Delegate;
+	}
+
+	/**
+	 * A component talking to a stand-in server, shared by the latent commands of one test.
+	 */
+	struct FSession
+	{
+		explicit FSession(FAutomationTestBase* InTest)
+			: Test(InTest)
+			, Server(StandInPort)
+			, Component(NewObject<UAgonesComponent>(GetTransientPackage()))
+			, Listener(NewObject<UAgonesTestListener>(GetTransientPackage()))
+		{
+			Component->HttpPort = LexToString(StandInPort);
+			// Room for a whole burst, the benchmark measures the pipeline rather than the queue limit
+			Component->MaxQueuedRequests = BurstCalls * 2;
+		}
+
+		~FSession()
+		{
+			FAgonesComponentTestAccess::Shutdown(*Component);
+			Server.Stop();
+		}
+
+		FAgonesErrorDelegate OnError() const
+		{
+			return BindListener<FAgonesErrorDelegate>(Listener.Get(), GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnError));
+		}
+
+		template <typename TDelegate>
+		TDelegate OnEmpty() const
+		{
+			return BindListener<TDelegate>(Listener.Get(), GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnEmpty));
+		}
+
+		FAutomationTestBase* Test;
+		FAgonesStandInServer Server;
+		TStrongObjectPtr<UAgonesComponent> Component;
+		TStrongObjectPtr<UAgonesTestListener> Listener;
+	};
+
+	using FIssue = TFunction<void(FSession& Session, int32 Iteration)>;
+
+	/**
+	 * One call through the component: Issue sends it, Verify checks the listener and server once ExpectedResponses
+	 * responses came back.
+	 */
+	struct FStep
+	{
+		FString Name;
+		FIssue Issue;
+		TFunction<void(FSession& Session)> Verify;
+		int32 ExpectedResponses = 1;
+	};
+
+	/**
+	 * Runs steps one after the other, each waits for its responses before the next one is sent.
+	 */
+	class FRunStepsCommand : public IAutomationLatentCommand
+	{
+	public:
+		FRunStepsCommand(const TSharedRef<FSession>& InSession, TArray<FStep>&& InSteps)
+			: Session(InSession), Steps(MoveTemp(InSteps))
+		{
+		}
+
+		virtual bool Update() override
+		{
+			UAgonesTestListener& Listener = *Session->Listener;
+
+			if (bWaiting)
+			{
+				const FStep& Step = Steps[StepIndex];
+				if (Listener.NumResponses() - ResponsesBefore < Step.ExpectedResponses)
+				{
+					if (FPlatformTime::Seconds() - SendTime > TimeoutSeconds)
+					{
+						Session->Test->AddError(FString::Printf(TEXT("%s: timed out"), *Step.Name));
+						return true;
+					}
+					return false;
+				}
+
+				if (Listener.NumFailed > FailedBefore)
+				{
+					Session->Test->AddError(FString::Printf(TEXT("%s: %s"), *Step.Name, *Listener.LastError));
+				}
+				else if (Step.Verify)
+				{
+					Step.Verify(*Session);
+				}
+
+				bWaiting = false;
+				++StepIndex;
+			}
+
+			if (StepIndex >= Steps.Num())
+			{
+				return true;
+			}
+
+			ResponsesBefore = Listener.NumResponses();
+			FailedBefore = Listener.NumFailed;
+			SendTime = FPlatformTime::Seconds();
+			bWaiting = true;
+			Steps[StepIndex].Issue(*Session, 0);
+			return false;
+		}
+
+	private:
+		TSharedRef<FSession> Session;
+		TArray<FStep> Steps;
+		int32 StepIndex = 0;
+		int32 ResponsesBefore = 0;
+		int32 FailedBefore = 0;
+		double SendTime = 0.0;
+		bool bWaiting = false;
+	};
+
+	struct FBenchmarkPath
+	{
+		FString Name;
+		FString Route;
+		FIssue Issue;
+	};
+
+	/**
+	 * Measures one lifecycle path: round-trip latency over sequential calls, then calls per second over a burst.
+	 * Game thread time is what the component spends inside the call itself, before anything goes over the wire.
+	 */
+	class FBenchmarkPathCommand : public IAutomationLatentCommand
+	{
+	public:
+		FBenchmarkPathCommand(const TSharedRef<FSession>& InSession, FBenchmarkPath&& InPath)
+			: Session(InSession), Path(MoveTemp(InPath))
+		{
+		}
+
+		virtual bool Update() override
+		{
+			UAgonesTestListener& Listener = *Session->Listener;
+			const double Now = FPlatformTime::Seconds();
+
+			if (PhaseStart == 0.0)
+			{
+				PhaseStart = Now;
+				FailedBefore = Listener.NumFailed;
+			}
+			else if (Now - PhaseStart > TimeoutSeconds)
+			{
+				Session->Test->AddError(FString::Printf(TEXT("%s: timed out"), *Path.Name));
+				return true;
+			}
+
+			if (!bBurst)
+			{
+				if (bWaiting)
+				{
+					if (Listener.NumResponses() <= ResponsesBefore)
+					{
+						return false;
+					}
+					Latencies.Add(Listener.LastResponseTime - SendTime);
+					bWaiting = false;
+				}
+
+				if (Latencies.Num() < SequentialCalls)
+				{
+					ResponsesBefore = Listener.NumResponses();
+					SendTime = FPlatformTime::Seconds();
+					bWaiting = true;
+					Issue();
+					return false;
+				}
+
+				bBurst = true;
+				PhaseStart = FPlatformTime::Seconds();
+				ResponsesBefore = Listener.NumResponses();
+				HitsBefore = Session->Server.GetHits(Path.Route);
+				for (int32 Index = 0; Index < BurstCalls; ++Index)
+				{
+					Issue();
+				}
+				return false;
+			}
+
+			if (Listener.NumResponses() - ResponsesBefore < BurstCalls)
+			{
+				return false;
+			}
+
+			Report(Listener.LastResponseTime - PhaseStart);
+			return true;
+		}
+
+	private:
+		void Issue()
+		{
+			const double Start = FPlatformTime::Seconds();
+			Path.Issue(*Session, Iteration++);
+			GameThreadSeconds += FPlatformTime::Seconds() - Start;
+		}
+
+		void Report(const double BurstSeconds)
+		{
+			UAgonesTestListener& Listener = *Session->Listener;
+			if (Listener.NumFailed > FailedBefore)
+			{
+				Session->Test->AddError(FString::Printf(TEXT("%s: %d calls failed, last error: %s"),
+					*Path.Name, Listener.NumFailed - FailedBefore, *Listener.LastError));
+			}
+
+			Latencies.Sort();
+			const double P50 = Latencies[Latencies.Num() / 2];
+			const double P95 = Latencies[FMath::Min(Latencies.Num() - 1, Latencies.Num() * 95 / 100)];
+
+			Session->Test->AddInfo(FString::Printf(
+				TEXT("%-20s p50 %7.2f ms  p95 %7.2f ms  %8.0f calls/s  %6.2f us game thread per call  %d requests for %d burst calls"),
+				*Path.Name, P50 * 1000.0, P95 * 1000.0, BurstCalls / FMath::Max(BurstSeconds, SMALL_NUMBER),
+				GameThreadSeconds * 1000000.0 / Iteration, Session->Server.GetHits(Path.Route) - HitsBefore, BurstCalls));
+		}
+
+		TSharedRef<FSession> Session;
+		FBenchmarkPath Path;
+		TArray<double> Latencies;
+		double PhaseStart = 0.0;
+		double SendTime = 0.0;
+		double GameThreadSeconds = 0.0;
+		int32 Iteration = 0;
+		int32 ResponsesBefore = 0;
+		int32 FailedBefore = 0;
+		int32 HitsBefore = 0;
+		bool bWaiting = false;
+		bool bBurst = false;
+	};
+
+	TArray<FBenchmarkPath> MakeBenchmarkPaths()
+	{
+		TArray<FBenchmarkPath> Paths;
+
+		Paths.Add({TEXT("Health"), TEXT("/health"), [](FSession& Session, int32) {
+			Session.Component->Health(Session.OnEmpty<FHealthDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("Ready"), TEXT("/ready"), [](FSession& Session, int32) {
+			Session.Component->Ready(Session.OnEmpty<FReadyDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("GameServer"), TEXT("/gameserver"), [](FSession& Session, int32) {
+			Session.Component->GameServer(BindListener<FGameServerDelegate>(Session.Listener.Get(),
+				GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnGameServer)), Session.OnError());
+		}});
+		Paths.Add({TEXT("SetLabel"), TEXT("/metadata/label"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->SetLabel(FString::Printf(TEXT("bench-%d"), Iteration), TEXT("value"),
+				Session.OnEmpty<FSetLabelDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("SetAnnotation"), TEXT("/metadata/annotation"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->SetAnnotation(FString::Printf(TEXT("bench-%d"), Iteration), TEXT("value"),
+				Session.OnEmpty<FSetAnnotationDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("SetPlayerCapacity"), TEXT("/alpha/player/capacity"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->SetPlayerCapacity(BurstCalls + SequentialCalls + Iteration,
+				Session.OnEmpty<FSetPlayerCapacityDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("GetPlayerCapacity"), TEXT("/alpha/player/capacity"), [](FSession& Session, int32) {
+			Session.Component->GetPlayerCapacity(BindListener<FGetPlayerCapacityDelegate>(Session.Listener.Get(),
+				GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnCount)), Session.OnError());
+		}});
+		Paths.Add({TEXT("PlayerConnect"), TEXT("/alpha/player/connect"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->PlayerConnect(FString::Printf(TEXT("player-%d"), Iteration),
+				BindListener<FPlayerConnectDelegate>(Session.Listener.Get(),
+					GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnected)), Session.OnError());
+		}});
+		Paths.Add({TEXT("IsPlayerConnected"), TEXT("/alpha/player/connected"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->IsPlayerConnected(FString::Printf(TEXT("player-%d"), Iteration),
+				BindListener<FIsPlayerConnectedDelegate>(Session.Listener.Get(),
+					GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnected)), Session.OnError());
+		}});
+		Paths.Add({TEXT("GetConnectedPlayers"), TEXT("/alpha/player/connected"), [](FSession& Session, int32) {
+			Session.Component->GetConnectedPlayers(BindListener<FGetConnectedPlayersDelegate>(Session.Listener.Get(),
+				GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnectedPlayers)), Session.OnError());
+		}});
+		Paths.Add({TEXT("GetPlayerCount"), TEXT("/alpha/player/count"), [](FSession& Session, int32) {
+			Session.Component->GetPlayerCount(BindListener<FGetPlayerCountDelegate>(Session.Listener.Get(),
+				GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnCount)), Session.OnError());
+		}});
+		Paths.Add({TEXT("PlayerDisconnect"), TEXT("/alpha/player/disconnect"), [](FSession& Session, const int32 Iteration) {
+			Session.Component->PlayerDisconnect(FString::Printf(TEXT("player-%d"), Iteration),
+				BindListener<FPlayerDisconnectDelegate>(Session.Listener.Get(),
+					GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnDisconnected)), Session.OnError());
+		}});
+		Paths.Add({TEXT("Reserve"), TEXT("/reserve"), [](FSession& Session, int32) {
+			Session.Component->Reserve(10, Session.OnEmpty<FReserveDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("Allocate"), TEXT("/allocate"), [](FSession& Session, int32) {
+			Session.Component->Allocate(Session.OnEmpty<FAllocateDelegate>(), Session.OnError());
+		}});
+		Paths.Add({TEXT("Shutdown"), TEXT("/shutdown"), [](FSession& Session, int32) {
+			Session.Component->Shutdown(Session.OnEmpty<FShutdownDelegate>(), Session.OnError());
+		}});
+
+		return Paths;
+	}
+}
+
+/**
+ * Check every SDK call against the stand-in server, in the order a game server goes through its lifecycle
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAgonesStandInLifecycleTest, "Agones.StandIn.Lifecycle", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FAgonesStandInLifecycleTest::RunTest(const FString& Parameters)
+{
+	using namespace AgonesTests;
+
+	const TSharedRef<FSession> Session = MakeShared<FSession>(this);
+	if (!TestTrue(TEXT("Stand-in server must start"), Session->Server.Start()))
+	{
+		return false;
+	}
+
+	TArray<FStep> Steps;
+	Steps.Add({TEXT("Ready"), [](FSession& Session, int32) {
+		Session.Component->Ready(Session.OnEmpty<FReadyDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("Ready must move the game server to Ready"), Session.Server.GetState(), FString(TEXT("Ready")));
+	}});
+	Steps.Add({TEXT("GameServer"), [](FSession& Session, int32) {
+		Session.Component->GameServer(BindListener<FGameServerDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnGameServer)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("GameServer must report the current state"), Session.Listener->LastGameServer.Status.State, FString(TEXT("Ready")));
+		TestEqual(TEXT("GameServer must report the game port"), Session.Listener->LastGameServer.Status.Ports.Num(), 1);
+	}});
+	Steps.Add({TEXT("SetPlayerCapacity"), [](FSession& Session, int32) {
+		Session.Component->SetPlayerCapacity(4, Session.OnEmpty<FSetPlayerCapacityDelegate>(), Session.OnError());
+	}});
+	Steps.Add({TEXT("GetPlayerCapacity"), [](FSession& Session, int32) {
+		Session.Component->GetPlayerCapacity(BindListener<FGetPlayerCapacityDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnCount)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("GetPlayerCapacity must return the capacity that was set"), Session.Listener->LastCount, static_cast<int64>(4));
+	}});
+	Steps.Add({TEXT("PlayerConnect"), [](FSession& Session, int32) {
+		Session.Component->PlayerConnect(TEXT("player-1"), BindListener<FPlayerConnectDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnected)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestTrue(TEXT("PlayerConnect must add a new player"), Session.Listener->bLastBool);
+	}});
+	Steps.Add({TEXT("IsPlayerConnected"), [](FSession& Session, int32) {
+		Session.Component->IsPlayerConnected(TEXT("player-1"), BindListener<FIsPlayerConnectedDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnected)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestTrue(TEXT("IsPlayerConnected must find the connected player"), Session.Listener->bLastBool);
+	}});
+	Steps.Add({TEXT("GetPlayerCount"), [](FSession& Session, int32) {
+		Session.Component->GetPlayerCount(BindListener<FGetPlayerCountDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnCount)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("GetPlayerCount must count the connected player"), Session.Listener->LastCount, static_cast<int64>(1));
+	}});
+	Steps.Add({TEXT("GetConnectedPlayers"), [](FSession& Session, int32) {
+		Session.Component->GetConnectedPlayers(BindListener<FGetConnectedPlayersDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnConnectedPlayers)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("GetConnectedPlayers must list one player"), Session.Listener->LastPlayers.Num(), 1);
+		TestTrue(TEXT("GetConnectedPlayers must list the connected player"), Session.Listener->LastPlayers.Contains(TEXT("player-1")));
+	}});
+	Steps.Add({TEXT("PlayerDisconnect"), [](FSession& Session, int32) {
+		Session.Component->PlayerDisconnect(TEXT("player-1"), BindListener<FPlayerDisconnectDelegate>(Session.Listener.Get(),
+			GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnDisconnected)), Session.OnError());
+	}, [this](FSession& Session) {
+		TestTrue(TEXT("PlayerDisconnect must remove the player"), Session.Listener->bLastBool);
+	}});
+	Steps.Add({TEXT("SetAnnotation"), [](FSession& Session, int32) {
+		Session.Component->SetAnnotation(TEXT("map"), TEXT("warehouse"), Session.OnEmpty<FSetAnnotationDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("SetAnnotation must reach the server"), Session.Server.GetAnnotations().FindRef(TEXT("map")), FString(TEXT("warehouse")));
+	}});
+
+	constexpr int32 LabelWrites = 8;
+	Steps.Add({TEXT("SetLabel coalescing"), [](FSession& Session, int32) {
+		Session.Server.ResetHits();
+		for (int32 Index = 0; Index < LabelWrites; ++Index)
+		{
+			Session.Component->SetLabel(TEXT("round"), LexToString(Index), Session.OnEmpty<FSetLabelDelegate>(), Session.OnError());
+		}
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("Writes to one label in the same frame must go out as one request"), Session.Server.GetHits(TEXT("/metadata/label")), 1);
+		TestEqual(TEXT("The coalesced request must carry the latest value"), Session.Server.GetLabels().FindRef(TEXT("round")), LexToString(LabelWrites - 1));
+	}, LabelWrites});
+
+	Steps.Add({TEXT("Health coalescing"), [](FSession& Session, int32) {
+		Session.Server.ResetHits();
+		Session.Component->Health(Session.OnEmpty<FHealthDelegate>(), Session.OnError());
+		Session.Component->Health(Session.OnEmpty<FHealthDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("A ping must join the one already queued"), Session.Server.GetHits(TEXT("/health")), 1);
+	}, 2});
+	Steps.Add({TEXT("Reserve"), [](FSession& Session, int32) {
+		Session.Component->Reserve(10, Session.OnEmpty<FReserveDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("Reserve must move the game server to Reserved"), Session.Server.GetState(), FString(TEXT("Reserved")));
+	}});
+	Steps.Add({TEXT("Allocate"), [](FSession& Session, int32) {
+		Session.Component->Allocate(Session.OnEmpty<FAllocateDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("Allocate must move the game server to Allocated"), Session.Server.GetState(), FString(TEXT("Allocated")));
+	}});
+	Steps.Add({TEXT("Shutdown"), [](FSession& Session, int32) {
+		Session.Component->Shutdown(Session.OnEmpty<FShutdownDelegate>(), Session.OnError());
+	}, [this](FSession& Session) {
+		TestEqual(TEXT("Shutdown must move the game server to Shutdown"), Session.Server.GetState(), FString(TEXT("Shutdown")));
+	}});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FRunStepsCommand(Session, MoveTemp(Steps)));
+	return true;
+}
+
+/**
+ * Measure round-trip latency, calls per second and game thread time per call for each SDK call against the stand-in
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAgonesLifecycleBenchmark, "Agones.Benchmark.Lifecycle", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FAgonesLifecycleBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AgonesTests;
+
+	const TSharedRef<FSession> Session = MakeShared<FSession>(this);
+	if (!TestTrue(TEXT("Stand-in server must start"), Session->Server.Start()))
+	{
+		return false;
+	}
+
+	for (FBenchmarkPath& Path : MakeBenchmarkPaths())
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FBenchmarkPathCommand(Session, MoveTemp(Path)));
+	}
+	return true;
+}
+
+/**
+ * Measure how fast a stream of GameServer updates on the watch socket is reassembled, parsed and broadcast
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAgonesWatchBenchmark, "Agones.Benchmark.Watch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FAgonesWatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AgonesTests;
+
+	FSession Session(this);
+	FAgonesComponentTestAccess::AddWatchCallback(*Session.Component, BindListener<FGameServerDelegate>(Session.Listener.Get(),
+		GET_FUNCTION_NAME_CHECKED(UAgonesTestListener, OnGameServer)));
+
+	// Encode up front, the socket hands the component utf8 bytes
+	TArray<TArray<uint8>> Frames;
+	Frames.Reserve(WatchMessages);
+	int64 TotalBytes = 0;
+	for (int32 Index = 0; Index < WatchMessages; ++Index)
+	{
+		const FTCHARToUTF8 Converted(*Session.Server.BuildWatchMessage(Index + 1));
+		Frames.Emplace(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+		TotalBytes += Converted.Length();
+	}
+
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Frames.Num(); ++Index)
+	{
+		const TArray<uint8>& Frame = Frames[Index];
+		if (Index % 2 == 0)
+		{
+			FAgonesComponentTestAccess::HandleWatchMessage(*Session.Component, Frame.GetData(), Frame.Num(), 0);
+			continue;
+		}
+
+		for (int32 Offset = 0; Offset < Frame.Num(); Offset += WatchFragmentSize)
+		{
+			const int32 Size = FMath::Min(WatchFragmentSize, Frame.Num() - Offset);
+			FAgonesComponentTestAccess::HandleWatchMessage(*Session.Component, Frame.GetData() + Offset, Size, Frame.Num() - Offset - Size);
+		}
+	}
+	const double Seconds = FMath::Max(FPlatformTime::Seconds() - Start, SMALL_NUMBER);
+
+	TestEqual(TEXT("Every update must be broadcast"), Session.Listener->NumSucceeded, WatchMessages);
+	TestEqual(TEXT("The last update must be the latest generation"), Session.Listener->LastGameServer.ObjectMeta.Generation, static_cast<int64>(WatchMessages));
+
+	AddInfo(FString::Printf(TEXT("Watch: %d updates, %.0f updates/s, %.2f us per update, %.1f MB/s"),
+		WatchMessages, WatchMessages / Seconds, Seconds * 1000000.0 / WatchMessages, TotalBytes / Seconds / (1024.0 * 1024.0)));
+	return true;
+}
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright Sam Bonifacio. All Rights Reserved.
+
+#include "Misc/AutoSettingsConfigWriter.h"
+#include "Async/Async.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "AutoSettingsLogs.h"
+
+FAutoSettingsConfigWriter::FAutoSettingsConfigWriter(const FString& InIniFilename)
+	: IniFilename(InIniFilename)
+{
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAutoSettingsConfigWriter::Tick));
+}
+
+FAutoSettingsConfigWriter::~FAutoSettingsConfigWriter()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	// Config cache may already be gone if this is destroyed late in shutdown
+	if (GConfig)
+	{
+		Flush();
+	}
+}
+
+void FAutoSettingsConfigWriter::SetValue(const FString& Section, FName Key, const FString& Value)
+{
+	// Wait for the delay again, the user is likely still changing the value
+	WriteTime = FPlatformTime::Seconds() + SaveDelay;
+
+	// A write in progress has its own copy of the file, this one goes out with the next
+	ApplyValue(Section, Key, Value);
+	bDirty = true;
+}
+
+void FAutoSettingsConfigWriter::Flush()
+{
+	FinishWrite();
+
+	if (bDirty)
+	{
+		StartWrite();
+		FinishWrite();
+	}
+}
+
+bool FAutoSettingsConfigWriter::Tick(float DeltaTime)
+{
+	if (WriteTask.IsValid() && WriteTask.IsReady())
+	{
+		FinishWrite();
+	}
+
+	if (bDirty && !WriteTask.IsValid() && FPlatformTime::Seconds() >= WriteTime)
+	{
+		StartWrite();
+	}
+
+	return true;
+}
+
+void FAutoSettingsConfigWriter::ApplyValue(const FString& Section, FName Key, const FString& Value)
+{
+	// Remove the existing value and compact the map, so that the new value gets added to the end of the config section rather than inserted back in it's original place
+	// This is important because config are applied in the order they are saved when the engine is started, and we want to preserve the order that the user applied
+	// in case there are any CVars that set other CVars, like the scalability ones
+	GConfig->RemoveKey(*Section, *Key.ToString(), IniFilename);
+	GConfig->GetSectionPrivate(*Section, true, false, IniFilename)->CompactStable();
+	GConfig->SetString(*Section, *Key.ToString(), *Value, IniFilename);
+}
+
+void FAutoSettingsConfigWriter::StartWrite()
+{
+	bDirty = false;
+
+	FConfigFile* ConfigFile = FindConfigFile();
+	if (!ConfigFile || ConfigFile->NoSave)
+	{
+		return;
+	}
+
+	// The config file belongs to GConfig and can change or go away at any time, so it's serialized here and the worker
+	// only gets the text
+	FString Contents;
+	if (!ConfigFile->WriteToString(Contents, IniFilename))
+	{
+		return;
+	}
+
+	// The file is written here, so the config cache doesn't need to write it again on exit
+	ConfigFile->Dirty = false;
+	NumDiskWrites++;
+
+	WriteTask = Async(EAsyncExecution::ThreadPool, [Contents = MoveTemp(Contents), Filename = IniFilename]()
+	{
+		return FFileHelper::SaveStringToFile(Contents, *Filename);
+	});
+}
+
+void FAutoSettingsConfigWriter::FinishWrite()
+{
+	if (!WriteTask.IsValid())
+	{
+		return;
+	}
+
+	const bool bWritten = WriteTask.Get();
+	WriteTask.Reset();
+
+	if (bWritten)
+	{
+		NumFailedWrites = 0;
+	}
+	else
+	{
+		// Back off so a file that can't be written (read only, disk full) isn't retried and warned about every frame
+		NumFailedWrites++;
+		const float RetryDelay = FMath::Min(SaveDelay * (1 << FMath::Min(NumFailedWrites, 8)), MaxRetryDelay);
+		WriteTime = FMath::Max(WriteTime, FPlatformTime::Seconds() + RetryDelay);
+		UE_LOG(LogAutoSettings, Warning, TEXT("Failed to write settings to %s, retrying in %.1f seconds"), *IniFilename, RetryDelay);
+
+		if (FConfigFile* ConfigFile = FindConfigFile())
+		{
+			ConfigFile->Dirty = true;
+		}
+		bDirty = true;
+	}
+
+}
+
+FConfigFile* FAutoSettingsConfigWriter::FindConfigFile() const
+{
+	return GConfig ? GConfig->FindConfigFile(IniFilename) : nullptr;
+}
@@ -125,6 +125,22 @@ USettingsManager::USettingsManager()
 	FConfigCacheIni::LoadGlobalIniFile(IniFilename, *IniName);
 }
 
+void USettingsManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ConfigWriter = MakeUnique<FAutoSettingsConfigWriter>(IniFilename);
+	ConfigWriter->SetSaveDelay(GetDefault<UAutoSettingsConfig>()->SaveDelay);
+}
+
+void USettingsManager::Deinitialize()
+{
+	// Make sure nothing the user saved is lost on exit
+	ConfigWriter.Reset();
+
+	Super::Deinitialize();
+}
+
 void USettingsManager::Init()
 {
 	ApplySettingsFromConfig();
@@ -175,13 +191,18 @@ void USettingsManager::SetConfigValue(FName Key, FString Value)
 {
 	if (!Key.IsNone() && !Value.IsEmpty())
 	{
-		// Remove the existing value and compact the map, so that the new value gets added to the end of the config section rather than inserted back in it's original place
-		// This is important because config are applied in the order they are saved when the engine is started, and we want to preserve the order that the user applied
-		// in case there are any CVars that set other CVars, like the scalability ones
-		GConfig->RemoveKey(*GetSectionName(), *Key.ToString(), IniFilename);
-		GConfig->GetSectionPrivate(*GetSectionName(), true, false, IniFilename)->CompactStable();
-		GConfig->SetString(*GetSectionName(), *Key.ToString(), *Value, IniFilename);
-		GConfig->Flush(false, IniFilename);
+		if (ensure(ConfigWriter))
+		{
+			ConfigWriter->SetValue(GetSectionName(), Key, Value);
+		}
+	}
+}
+
+void USettingsManager::FlushConfig()
+{
+	if (ConfigWriter)
+	{
+		ConfigWriter->Flush();
 	}
 }
 
@@ -206,6 +227,9 @@ FString USettingsManager::GetSectionName()
 
 void USettingsManager::ApplySettingsFromConfig()
 {
+	// Make sure the section has every saved value
+	FlushConfig();
+
 	FConfigSection* Section = GetSection();
 
 	int32 SettingsLoaded = 0;
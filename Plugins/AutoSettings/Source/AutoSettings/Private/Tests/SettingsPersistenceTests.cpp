@@ -0,0 +1,94 @@
+// Copyright Sam Bonifacio. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/AutoSettingsConfigWriter.h"
+#include "Misc/ConfigCacheIni.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AutoSettingsPersistenceTests
+{
+	static const TCHAR* Section = TEXT("Settings");
+	static const FName Key = TEXT("r.ScreenPercentage");
+
+	// Number of values a slider sends while being dragged from one end to the other
+	static const int32 NumDragValues = 200;
+
+	FString LoadTestIni(const TCHAR* BaseName)
+	{
+		FString IniFilename;
+		FConfigCacheIni::LoadGlobalIniFile(IniFilename, BaseName, nullptr, true);
+		return IniFilename;
+	}
+
+	void UnloadTestIni(const FString& IniFilename)
+	{
+		GConfig->Remove(IniFilename);
+		IFileManager::Get().Delete(*IniFilename, false, false, true);
+	}
+
+	FString GetDragValue(int32 Index)
+	{
+		return FString::FromInt(50 + Index * 50 / (NumDragValues - 1));
+	}
+}
+
+/**
+ * Check that values set in quick succession are coalesced into a single disk write, and compare game thread time against writing on every value
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSliderDragPersistenceBenchmark, "AutoSettings.Settings.Benchmark.SliderDrag", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FSliderDragPersistenceBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AutoSettingsPersistenceTests;
+
+	// Previous behavior, the file is written for every value
+	const FString ImmediateIni = LoadTestIni(TEXT("AutoSettingsBenchmarkImmediate"));
+	const double ImmediateStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumDragValues; i++)
+	{
+		GConfig->RemoveKey(Section, *Key.ToString(), ImmediateIni);
+		GConfig->GetSectionPrivate(Section, true, false, ImmediateIni)->CompactStable();
+		GConfig->SetString(Section, *Key.ToString(), *GetDragValue(i), ImmediateIni);
+		GConfig->Flush(false, ImmediateIni);
+	}
+	const double ImmediateSeconds = FPlatformTime::Seconds() - ImmediateStart;
+	UnloadTestIni(ImmediateIni);
+
+	// Write-behind, nothing should reach the disk until the drag settles
+	const FString DeferredIni = LoadTestIni(TEXT("AutoSettingsBenchmarkDeferred"));
+	double DeferredSeconds = 0.0;
+	{
+		FAutoSettingsConfigWriter Writer(DeferredIni);
+		Writer.SetSaveDelay(0.5f);
+
+		const double DeferredStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumDragValues; i++)
+		{
+			Writer.SetValue(Section, Key, GetDragValue(i));
+		}
+		DeferredSeconds = FPlatformTime::Seconds() - DeferredStart;
+
+		TestEqual(TEXT("No disk writes while dragging"), Writer.GetNumDiskWrites(), 0);
+		TestTrue(TEXT("Writer must have unsaved values"), Writer.IsDirty());
+		TestEqual(TEXT("Config cache must have the latest value"), GConfig->GetStr(Section, *Key.ToString(), DeferredIni), GetDragValue(NumDragValues - 1));
+
+		Writer.Flush();
+
+		TestEqual(TEXT("Single disk write after flush"), Writer.GetNumDiskWrites(), 1);
+		TestFalse(TEXT("Writer must have nothing left to save"), Writer.IsDirty());
+	}
+
+	// Reload from disk to check the write contains the final value
+	GConfig->Remove(DeferredIni);
+	const FString ReloadedIni = LoadTestIni(TEXT("AutoSettingsBenchmarkDeferred"));
+	TestEqual(TEXT("File must have the latest value"), GConfig->GetStr(Section, *Key.ToString(), ReloadedIni), GetDragValue(NumDragValues - 1));
+	UnloadTestIni(ReloadedIni);
+
+	AddInfo(FString::Printf(TEXT("Slider drag of %i values: immediate %i disk writes, %.3f ms game thread; deferred 1 disk write, %.3f ms game thread"),
+		NumDragValues, NumDragValues, ImmediateSeconds * 1000.0, DeferredSeconds * 1000.0));
+	return true;
+}
+
+#endif
@@ -24,6 +24,11 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = Settings)
 	FString SettingsSectionName = "Settings";
 
+	// Seconds without a new setting being saved before the config ini file is written to disk
+	// Settings saved in quick succession, like while dragging a slider, are written together
+	UPROPERTY(Config, EditAnywhere, Category = Settings, meta = (ClampMin = 0))
+	float SaveDelay = 0.5f;
+
 protected:
 
 	virtual void PostInitProperties() override;
@@ -0,0 +1,77 @@
+// Copyright Sam Bonifacio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+class FConfigFile;
+
+// Write-behind persistence for a config ini file
+// Values go into the config cache straight away, the file is written on a background thread once no value has been set
+// for the save delay, so a burst of values (like dragging a slider) costs a single disk write
+// The file is serialized on the game thread, the background thread only saves the text
+// Game thread only
+class AUTOSETTINGS_API FAutoSettingsConfigWriter
+{
+public:
+
+	explicit FAutoSettingsConfigWriter(const FString& InIniFilename);
+
+	// Flushes anything not written yet
+	~FAutoSettingsConfigWriter();
+
+	// Sets a value, moving it to the end of the section so that values keep the order they were set in
+	void SetValue(const FString& Section, FName Key, const FString& Value);
+
+	// Writes everything set so far, blocking until it's on disk
+	void Flush();
+
+	// Seconds without a new value before the file is written
+	void SetSaveDelay(float InSaveDelay) { SaveDelay = InSaveDelay; }
+
+	// True if values have been set that aren't on disk yet
+	bool IsDirty() const { return bDirty || WriteTask.IsValid(); }
+
+	// Number of times the file has been written, for profiling
+	int32 GetNumDiskWrites() const { return NumDiskWrites; }
+
+private:
+
+	FString IniFilename;
+
+	float SaveDelay = 0.5f;
+
+	// Time the next write is due if still dirty
+	double WriteTime = 0.0;
+
+	// Writes that failed in a row, each one doubles the wait before the next attempt
+	int32 NumFailedWrites = 0;
+
+	// Longest wait between attempts to write a file that keeps failing
+	static constexpr float MaxRetryDelay = 30.0f;
+
+	// Config cache has values the file doesn't
+	bool bDirty = false;
+
+	// Write in progress, returns whether it succeeded
+	TFuture<bool> WriteTask;
+
+	int32 NumDiskWrites = 0;
+
+	FTSTicker::FDelegateHandle TickHandle;
+
+	bool Tick(float DeltaTime);
+
+	// Puts a value into the config cache
+	void ApplyValue(const FString& Section, FName Key, const FString& Value);
+
+	// Starts writing the file on a background thread
+	void StartWrite();
+
+	// Waits for the write in progress, if any
+	void FinishWrite();
+
+	FConfigFile* FindConfigFile() const;
+};
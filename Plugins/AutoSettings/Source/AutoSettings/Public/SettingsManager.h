@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Console/CVarChangeListenerManager.h"
+#include "Misc/AutoSettingsConfigWriter.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "SettingsManager.generated.h"
@@ -112,6 +113,9 @@ public:
 
 	USettingsManager();
 	
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 	// Initialize the settings manager, loading and applying any settings saved in config
 	void Init();
 
@@ -129,8 +133,12 @@ public:
 	void SaveSetting(FAutoSettingData SettingData, bool bApplySetting);
 
 	// Updates a value in config but is not considered saving a setting
+	// The config file is written after the save delay, see FlushConfig to write it immediately
 	void SetConfigValue(FName Key, FString Value);
 
+	// Writes any config values not yet on disk, blocking until they are
+	void FlushConfig();
+
 	// Applies a setting in the console
 	void ApplySetting(FAutoSettingData SettingData);
 	
@@ -139,6 +147,9 @@ private:
 	UPROPERTY()
 	FString IniFilename;
 
+	// Writes config values to disk in the background
+	TUniquePtr<FAutoSettingsConfigWriter> ConfigWriter;
+
 	static FString GetSectionName();
 
 	// Load and apply any settings in config
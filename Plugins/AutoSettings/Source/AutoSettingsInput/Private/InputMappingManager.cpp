@@ -251,68 +251,56 @@ void UInputMappingManager::AddPlayerAxisOverride(APlayerController* Player, cons
 
 FInputActionKeyMapping UInputMappingManager::GetPlayerActionMapping(APlayerController* Player, FName ActionName, int32 MappingGroup, FGameplayTag KeyGroup, bool bUsePlayerKeyGroup) const
 {
-	FPlayerInputMappings InputOverride = FindPlayerInputMappingsOrDefault(Player);
+	const FMergedInputMappingLayout& MergedLayout = GetPlayerMergedLayout(Player);
 
 	if (bUsePlayerKeyGroup)
 	{
-		KeyGroup = InputOverride.PlayerKeyGroup;
+		KeyGroup = MergedLayout.GetPlayerKeyGroup();
 	}
 
-	FInputMappingLayout MergedMappingLayout = InputOverride.BuildMergedMappingLayout();
-
 	// Use the first mapping group with the specified key group
 	if (MappingGroup == -1)
 	{
-		for (FInputMappingGroup& MappingGroupObj : MergedMappingLayout.GetMappingGroups())
+		for (int32 MappingGroupIndex = 0; MappingGroupIndex < MergedLayout.GetNumMappingGroups(); MappingGroupIndex++)
 		{
-			FInputActionKeyMapping Mapping = MappingGroupObj.GetAction(ActionName, KeyGroup);
-			if (Mapping.Key.IsValid())
+			const FInputActionKeyMapping* Mapping = MergedLayout.FindAction(MappingGroupIndex, ActionName, KeyGroup);
+			if (Mapping && Mapping->Key.IsValid())
 			{
-				return Mapping;
+				return *Mapping;
 			}
 		}
 		return FInputActionKeyMapping();
 	}
 
-	if (MergedMappingLayout.GetMappingGroups().IsValidIndex(MappingGroup))
-	{
-		return MergedMappingLayout.GetMappingGroups()[MappingGroup].GetAction(ActionName, KeyGroup);
-	}
-	
-	return FInputActionKeyMapping();
+	const FInputActionKeyMapping* Mapping = MergedLayout.FindAction(MappingGroup, ActionName, KeyGroup);
+	return Mapping ? *Mapping : FInputActionKeyMapping();
 }
 
 FInputAxisKeyMapping UInputMappingManager::GetPlayerAxisMapping(APlayerController * Player, FName AxisName, float Scale, int32 MappingGroup, FGameplayTag KeyGroup, bool bUsePlayerKeyGroup) const
 {
-	FPlayerInputMappings InputOverride = FindPlayerInputMappingsOrDefault(Player);
+	const FMergedInputMappingLayout& MergedLayout = GetPlayerMergedLayout(Player);
 
 	if (bUsePlayerKeyGroup)
 	{
-		KeyGroup = InputOverride.PlayerKeyGroup;
+		KeyGroup = MergedLayout.GetPlayerKeyGroup();
 	}
 
-	FInputMappingLayout MergedMappingLayout = InputOverride.BuildMergedMappingLayout();
-
 	// Use the first mapping group with the specified key group
 	if (MappingGroup == -1)
 	{
-		for (FInputMappingGroup& MappingGroupObj : MergedMappingLayout.GetMappingGroups())
+		for (int32 MappingGroupIndex = 0; MappingGroupIndex < MergedLayout.GetNumMappingGroups(); MappingGroupIndex++)
 		{
-			FInputAxisKeyMapping Mapping = MappingGroupObj.GetAxis(AxisName, Scale, KeyGroup);
-			if (Mapping.Key.IsValid())
+			const FInputAxisKeyMapping* Mapping = MergedLayout.FindAxis(MappingGroupIndex, AxisName, Scale, KeyGroup);
+			if (Mapping && Mapping->Key.IsValid())
 			{
-				return Mapping;
+				return *Mapping;
 			}
 		}
 		return FInputAxisKeyMapping();
 	}
 
-	if (MergedMappingLayout.GetMappingGroups().IsValidIndex(MappingGroup))
-	{
-		return MergedMappingLayout.GetMappingGroups()[MappingGroup].GetAxis(AxisName, Scale, KeyGroup);
-	}
-	
-	return FInputAxisKeyMapping();
+	const FInputAxisKeyMapping* Mapping = MergedLayout.FindAxis(MappingGroup, AxisName, Scale, KeyGroup);
+	return Mapping ? *Mapping : FInputAxisKeyMapping();
 }
 
 TArray<FInputActionKeyMapping> UInputMappingManager::GetPlayerActionMappings(APlayerController* Player, FName ActionName, int32 MappingGroup, FGameplayTag KeyGroup, bool bUsePlayerKeyGroup) const
@@ -322,31 +310,26 @@ TArray<FInputActionKeyMapping> UInputMappingManager::GetPlayerActionMappings(APl
 		return {};
 	}
 	
-	FPlayerInputMappings InputOverride = FindPlayerInputMappingsOrDefault(Player);
+	const FMergedInputMappingLayout& MergedLayout = GetPlayerMergedLayout(Player);
 
 	if (bUsePlayerKeyGroup)
 	{
-		KeyGroup = InputOverride.PlayerKeyGroup;
+		KeyGroup = MergedLayout.GetPlayerKeyGroup();
 	}
 
-	FInputMappingLayout MergedMappingLayout = InputOverride.BuildMergedMappingLayout();
-
 	TArray<FInputActionKeyMapping> Mappings;
 
 	// Use the first mapping group with the specified key group
 	if (MappingGroup == -1)
 	{
-		for (FInputMappingGroup& MappingGroupObj : MergedMappingLayout.GetMappingGroups())
+		for (int32 MappingGroupIndex = 0; MappingGroupIndex < MergedLayout.GetNumMappingGroups(); MappingGroupIndex++)
 		{
-			Mappings.Append(MappingGroupObj.GetAllActions(ActionName, KeyGroup));
+			MergedLayout.GetAllActions(MappingGroupIndex, ActionName, KeyGroup, Mappings);
 		}
 	}
 	else
 	{
-		if (MergedMappingLayout.GetMappingGroups().IsValidIndex(MappingGroup))
-		{
-			Mappings.Append(MergedMappingLayout.GetMappingGroups()[MappingGroup].GetAllActions(ActionName, KeyGroup));
-		}
+		MergedLayout.GetAllActions(MappingGroup, ActionName, KeyGroup, Mappings);
 	}
 	
 	return Mappings;
@@ -359,31 +342,26 @@ TArray<FInputAxisKeyMapping> UInputMappingManager::GetPlayerAxisMappings(APlayer
 		return {};
 	}
 	
-	FPlayerInputMappings InputOverride = FindPlayerInputMappingsOrDefault(Player);
+	const FMergedInputMappingLayout& MergedLayout = GetPlayerMergedLayout(Player);
 
 	if (bUsePlayerKeyGroup)
 	{
-		KeyGroup = InputOverride.PlayerKeyGroup;
+		KeyGroup = MergedLayout.GetPlayerKeyGroup();
 	}
 
-	FInputMappingLayout MergedMappingLayout = InputOverride.BuildMergedMappingLayout();
-
 	TArray<FInputAxisKeyMapping> Mappings;
 
 	// Use the first mapping group with the specified key group
 	if (MappingGroup == -1)
 	{
-		for (FInputMappingGroup& MappingGroupObj : MergedMappingLayout.GetMappingGroups())
+		for (int32 MappingGroupIndex = 0; MappingGroupIndex < MergedLayout.GetNumMappingGroups(); MappingGroupIndex++)
 		{
-			Mappings.Append(MappingGroupObj.GetAllAxes(AxisName, Scale, KeyGroup));
+			MergedLayout.GetAllAxes(MappingGroupIndex, AxisName, Scale, KeyGroup, Mappings);
 		}
 	}
 	else
 	{
-		if (MergedMappingLayout.GetMappingGroups().IsValidIndex(MappingGroup))
-		{
-			Mappings.Append(MergedMappingLayout.GetMappingGroups()[MappingGroup].GetAllAxes(AxisName, Scale, KeyGroup));
-		}
+		MergedLayout.GetAllAxes(MappingGroup, AxisName, Scale, KeyGroup, Mappings);
 	}
 	
 	return Mappings;
@@ -396,28 +374,62 @@ void UInputMappingManager::GetPlayerMappingsByKey(APlayerController* Player, FKe
 		return;
 	}
 
-	const FPlayerInputMappings InputOverride = FindPlayerInputMappingsOrDefault(Player);
-
-	const FInputMappingLayout MergedMappingLayout = InputOverride.BuildMergedMappingLayout();
-
 	Actions.Reset();
 	Axes.Reset();
 
-	// Find actions with the given key
-	for(const FInputActionKeyMapping& Action : MergedMappingLayout.GetActions())
+	GetPlayerMergedLayout(Player).GetMappingsByKey(Key, Actions, Axes);
+}
+
+const FMergedInputMappingLayout& UInputMappingManager::GetPlayerMergedLayout(APlayerController* Player) const
+{
+	const APlayerController* CacheKey = IsValid(Player) ? Player : nullptr;
+
+	FCachedMergedLayout* Cached = MergedLayoutCache.Find(CacheKey);
+	if (Cached && Cached->Version == MergedLayoutVersion && Cached->Player.Get() == CacheKey)
 	{
-		if(Action.Key == Key)
+		return *Cached->Layout;
+	}
+
+	if (!Cached)
+	{
+		// Drop layouts of destroyed players before growing the cache
+		for (auto It = MergedLayoutCache.CreateIterator(); It; ++It)
 		{
-			Actions.Add(Action);
+			if (It.Key() && !It.Value().Player.IsValid())
+			{
+				It.RemoveCurrent();
+			}
 		}
+		Cached = &MergedLayoutCache.Add(CacheKey);
+	}
+
+	const FPlayerInputMappings PlayerMappings = FindPlayerInputMappingsOrDefault(Player);
+	Cached->Player = CacheKey;
+	Cached->PlayerId = PlayerMappings.PlayerId;
+	Cached->Version = MergedLayoutVersion;
+	Cached->Layout = MakeUnique<FMergedInputMappingLayout>(PlayerMappings);
+	return *Cached->Layout;
+}
+
+void UInputMappingManager::InvalidatePlayerMergedLayout(APlayerController* Player)
+{
+	if (IsValid(Player))
+	{
+		MergedLayoutCache.Remove(Player);
 	}
+	else
+	{
+		MergedLayoutVersion++;
+	}
+}
 
-	// Find axes with the given key
-	for(const FInputAxisKeyMapping& Axis : MergedMappingLayout.GetAxes())
+void UInputMappingManager::InvalidateMergedLayouts(const FString& PlayerId)
+{
+	for (auto It = MergedLayoutCache.CreateIterator(); It; ++It)
 	{
-		if(Axis.Key == Key)
+		if (It.Value().PlayerId == PlayerId)
 		{
-			Axes.Add(Axis);
+			It.RemoveCurrent();
 		}
 	}
 }
@@ -465,6 +477,8 @@ void UInputMappingManager::PostInitProperties()
 {
 	Super::PostInitProperties();
 
+	MergedLayoutVersion++;
+
 	// Migrate deprecated properties
 
 	for(FPlayerInputMappings& PlayerInput : PlayerInputOverrides)
@@ -474,6 +488,37 @@ void UInputMappingManager::PostInitProperties()
 	}
 }
 
+void UInputMappingManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+#if WITH_EDITOR
+	// Presets and key groups are edited in project settings, which invalidates every merged layout
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &ThisClass::OnObjectPropertyChanged);
+#endif
+}
+
+void UInputMappingManager::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+
+	MergedLayoutCache.Empty();
+
+	Super::Deinitialize();
+}
+
+#if WITH_EDITOR
+void UInputMappingManager::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (Object && Object->IsA<UAutoSettingsInputProjectConfig>())
+	{
+		MergedLayoutVersion++;
+	}
+}
+#endif
+
 UWorld* UInputMappingManager::GetGameWorld() const
 {
 	UWorld* TestWorld = nullptr;
@@ -547,7 +592,7 @@ FPlayerInputMappings UInputMappingManager::FindPlayerInputMappings(APlayerContro
 	{
 		UE_LOG(LogAutoSettingsInput, VeryVerbose, TEXT("Checking internal mappings for %s with ID %s"), *Player->GetHumanReadableName(), *PlayerIdString);
 
-		for (FPlayerInputMappings PlayerInputMapping : PlayerInputOverrides)
+		for (const FPlayerInputMappings& PlayerInputMapping : PlayerInputOverrides)
 		{
 			// Compare ID strings
 			if (PlayerIdString == PlayerInputMapping.PlayerId)
@@ -593,6 +638,8 @@ void UInputMappingManager::SavePlayerInputMappings(APlayerController* Player, FP
 	PlayerInputOverrides.Add(NewMappings);
 	SaveConfig();
 
+	InvalidateMergedLayouts(NewMappings.PlayerId);
+
 	if(!ensure(IsValid(Player)))
 	{
 		return;
@@ -615,5 +662,6 @@ void UInputMappingManager::OnRegisteredPlayerControllerDestroyed(AActor* Destroy
 
 	// Unregister
 	RegisteredPlayerControllers.Remove(PlayerController);
+	MergedLayoutCache.Remove(PlayerController);
 	PlayerController->OnDestroyed.RemoveDynamic(this, &ThisClass::OnRegisteredPlayerControllerDestroyed);
 }
@@ -0,0 +1,163 @@
+// Copyright Sam Bonifacio. All Rights Reserved.
+
+#include "MergedInputMappingLayout.h"
+#include "AutoSettingsError.h"
+#include "Misc/AutoSettingsInputConfigInterface.h"
+
+FMergedInputMappingLayout::FMergedInputMappingLayout(const FPlayerInputMappings& PlayerMappings)
+	: Layout(PlayerMappings.BuildMergedMappingLayout())
+	, PlayerKeyGroup(PlayerMappings.PlayerKeyGroup)
+	, Config(PlayerMappings.Config)
+{
+	// Resolve what the config says about each key once, rather than on every lookup
+	auto IndexMapping = [this](int32 Index, FKey Key, float Scale)
+	{
+		FIndexedMapping Mapping;
+		Mapping.Index = Index;
+		Mapping.KeyGroup = Config.IsValid() ? Config->GetKeyGroupOfKey(Key) : FGameplayTag();
+		Mapping.Scale = Scale;
+		Mapping.bIsAxisKey = Config.IsValid() && Config->IsAxisKey(Key);
+		return Mapping;
+	};
+
+	const TArray<FInputMappingGroup>& MappingGroups = Layout.GetMappingGroupsConst();
+	Groups.SetNum(MappingGroups.Num());
+	for (int32 GroupIndex = 0; GroupIndex < MappingGroups.Num(); GroupIndex++)
+	{
+		const FInputMappingGroup& MappingGroup = MappingGroups[GroupIndex];
+		FGroupIndex& Group = Groups[GroupIndex];
+
+		for (int32 Index = 0; Index < MappingGroup.ActionMappings.Num(); Index++)
+		{
+			const FInputActionKeyMapping& Action = MappingGroup.ActionMappings[Index];
+			Group.Actions.FindOrAdd(Action.ActionName).Add(IndexMapping(Index, Action.Key, 0.f));
+		}
+
+		for (int32 Index = 0; Index < MappingGroup.AxisMappings.Num(); Index++)
+		{
+			const FInputAxisKeyMapping& Axis = MappingGroup.AxisMappings[Index];
+			Group.Axes.FindOrAdd(Axis.AxisName).Add(IndexMapping(Index, Axis.Key, Axis.Scale));
+		}
+	}
+
+	Actions = Layout.GetActions();
+	for (int32 Index = 0; Index < Actions.Num(); Index++)
+	{
+		ActionsByKey.FindOrAdd(Actions[Index].Key).Add(Index);
+	}
+
+	Axes = Layout.GetAxes();
+	for (int32 Index = 0; Index < Axes.Num(); Index++)
+	{
+		AxesByKey.FindOrAdd(Axes[Index].Key).Add(Index);
+	}
+}
+
+const FInputActionKeyMapping* FMergedInputMappingLayout::FindAction(int32 MappingGroup, FName ActionName, FGameplayTag KeyGroup) const
+{
+	CheckKeyGroup(KeyGroup);
+
+	const TArray<FIndexedMapping>* Mappings = Groups.IsValidIndex(MappingGroup) ? Groups[MappingGroup].Actions.Find(ActionName) : nullptr;
+	if (!Mappings)
+	{
+		return nullptr;
+	}
+
+	// Last match, to prioritize mappings that were added more recently
+	for (int32 i = Mappings->Num() - 1; i >= 0; i--)
+	{
+		const FIndexedMapping& Mapping = (*Mappings)[i];
+		if (MatchesKeyGroup(Mapping, KeyGroup))
+		{
+			return &Layout.GetMappingGroupsConst()[MappingGroup].ActionMappings[Mapping.Index];
+		}
+	}
+	return nullptr;
+}
+
+const FInputAxisKeyMapping* FMergedInputMappingLayout::FindAxis(int32 MappingGroup, FName AxisName, float Scale, FGameplayTag KeyGroup) const
+{
+	CheckKeyGroup(KeyGroup);
+
+	const TArray<FIndexedMapping>* Mappings = Groups.IsValidIndex(MappingGroup) ? Groups[MappingGroup].Axes.Find(AxisName) : nullptr;
+	if (!Mappings)
+	{
+		return nullptr;
+	}
+
+	// Last match, to prioritize mappings that were added more recently
+	for (int32 i = Mappings->Num() - 1; i >= 0; i--)
+	{
+		const FIndexedMapping& Mapping = (*Mappings)[i];
+		if (MatchesScale(Mapping, Scale) && MatchesKeyGroup(Mapping, KeyGroup))
+		{
+			return &Layout.GetMappingGroupsConst()[MappingGroup].AxisMappings[Mapping.Index];
+		}
+	}
+	return nullptr;
+}
+
+void FMergedInputMappingLayout::GetAllActions(int32 MappingGroup, FName ActionName, FGameplayTag KeyGroup, TArray<FInputActionKeyMapping>& OutActions) const
+{
+	CheckKeyGroup(KeyGroup);
+
+	const TArray<FIndexedMapping>* Mappings = Groups.IsValidIndex(MappingGroup) ? Groups[MappingGroup].Actions.Find(ActionName) : nullptr;
+	if (!Mappings)
+	{
+		return;
+	}
+
+	for (const FIndexedMapping& Mapping : *Mappings)
+	{
+		if (MatchesKeyGroup(Mapping, KeyGroup))
+		{
+			OutActions.Add(Layout.GetMappingGroupsConst()[MappingGroup].ActionMappings[Mapping.Index]);
+		}
+	}
+}
+
+void FMergedInputMappingLayout::GetAllAxes(int32 MappingGroup, FName AxisName, float Scale, FGameplayTag KeyGroup, TArray<FInputAxisKeyMapping>& OutAxes) const
+{
+	CheckKeyGroup(KeyGroup);
+
+	const TArray<FIndexedMapping>* Mappings = Groups.IsValidIndex(MappingGroup) ? Groups[MappingGroup].Axes.Find(AxisName) : nullptr;
+	if (!Mappings)
+	{
+		return;
+	}
+
+	for (const FIndexedMapping& Mapping : *Mappings)
+	{
+		if (MatchesScale(Mapping, Scale) && MatchesKeyGroup(Mapping, KeyGroup))
+		{
+			OutAxes.Add(Layout.GetMappingGroupsConst()[MappingGroup].AxisMappings[Mapping.Index]);
+		}
+	}
+}
+
+void FMergedInputMappingLayout::GetMappingsByKey(FKey Key, TArray<FInputActionKeyMapping>& OutActions, TArray<FInputAxisKeyMapping>& OutAxes) const
+{
+	if (const TArray<int32>* Indices = ActionsByKey.Find(Key))
+	{
+		for (const int32 Index : *Indices)
+		{
+			OutActions.Add(Actions[Index]);
+		}
+	}
+
+	if (const TArray<int32>* Indices = AxesByKey.Find(Key))
+	{
+		for (const int32 Index : *Indices)
+		{
+			OutAxes.Add(Axes[Index]);
+		}
+	}
+}
+
+void FMergedInputMappingLayout::CheckKeyGroup(FGameplayTag KeyGroup) const
+{
+	if (KeyGroup.IsValid() && Config.IsValid() && !Config->IsKeyGroupDefined(KeyGroup))
+	{
+		FAutoSettingsError::LogError(FString::Printf(TEXT("Undefined Key Group with tag '%s'. Please add a Key Group with the tag in the Auto Settings page of the project settings."), *KeyGroup.ToString()));
+	}
+}
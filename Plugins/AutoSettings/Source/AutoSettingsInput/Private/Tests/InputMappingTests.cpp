@@ -3,6 +3,7 @@
 #include "CoreTypes.h"
 #include "InputMappingManager.h"
 #include "PlayerInputMappings.h"
+#include "MergedInputMappingLayout.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/AutoSettingsInputConfig.h"
 
@@ -205,6 +206,49 @@ bool FMigrateDeprecatedPropertiesTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * Check that the indexed merged layout answers lookups the same as the layout it was built from
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMergedLayoutLookupTest, "AutoSettings.Input.MergedLayoutLookup", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FMergedLayoutLookupTest::RunTest(const FString& Parameters)
+{
+	UAutoSettingsInputConfig* Config = NewObject<UAutoSettingsInputConfig>();
+	Config->AllowMultipleBindingsPerKey = true;
+	FPlayerInputMappings PlayerInputMappings = FPlayerInputMappings(true, Config);
+	PlayerInputMappings.AddActionOverride(FInputActionKeyMapping(FName(TEXT("FireWeapon")), EKeys::LeftMouseButton), 0, false);
+	PlayerInputMappings.AddActionOverride(FInputActionKeyMapping(FName(TEXT("Jump")), EKeys::SpaceBar), 0, false);
+	PlayerInputMappings.AddActionOverride(FInputActionKeyMapping(FName(TEXT("Jump")), EKeys::LeftMouseButton), 1, false);
+	PlayerInputMappings.AddAxisOverride(FInputAxisKeyMapping(FName(TEXT("MoveForward")), EKeys::W, 1.f), 0, false);
+	PlayerInputMappings.AddAxisOverride(FInputAxisKeyMapping(FName(TEXT("MoveForward")), EKeys::S, -1.f), 0, false);
+
+	const FInputMappingLayout Layout = PlayerInputMappings.BuildMergedMappingLayout();
+	const FMergedInputMappingLayout MergedLayout = FMergedInputMappingLayout(PlayerInputMappings);
+	TestEqual(TEXT("Merged layout must have the same mapping groups"), MergedLayout.GetNumMappingGroups(), Layout.GetMappingGroupsConst().Num());
+
+	for (int32 MappingGroup = 0; MappingGroup < Layout.GetMappingGroupsConst().Num(); MappingGroup++)
+	{
+		for (const FName ActionName : { FName(TEXT("FireWeapon")), FName(TEXT("Jump")), FName(TEXT("Crouch")) })
+		{
+			const FInputActionKeyMapping* Action = MergedLayout.FindAction(MappingGroup, ActionName, FGameplayTag());
+			TestEqual(TEXT("Indexed action must match"), Action ? Action->Key : EKeys::Invalid, Layout.GetAction(MappingGroup, ActionName).Key);
+		}
+
+		for (const float Scale : { 1.f, -1.f })
+		{
+			const FInputAxisKeyMapping* Axis = MergedLayout.FindAxis(MappingGroup, FName(TEXT("MoveForward")), Scale, FGameplayTag());
+			TestEqual(TEXT("Indexed axis must match"), Axis ? Axis->Key : EKeys::Invalid, Layout.GetAxis(MappingGroup, FName(TEXT("MoveForward")), Scale).Key);
+		}
+	}
+
+	// Check key lookup finds the action bound on each mapping group
+	TArray<FInputActionKeyMapping> Actions;
+	TArray<FInputAxisKeyMapping> Axes;
+	MergedLayout.GetMappingsByKey(EKeys::LeftMouseButton, Actions, Axes);
+	TestEqual(TEXT("Both actions bound to the key must be found"), Actions.Num(), 2);
+	TestEqual(TEXT("No axis is bound to the key"), Axes.Num(), 0);
+	return true;
+}
+
 
 
 #endif
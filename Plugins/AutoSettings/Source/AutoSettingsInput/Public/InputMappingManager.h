@@ -3,6 +3,7 @@
 #pragma once
 
 #include "PlayerInputMappings.h"
+#include "MergedInputMappingLayout.h"
 #include "Misc/AutoSettingsInputConfig.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "InputMappingManager.generated.h"
@@ -121,6 +122,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Input Mapping")
 	void GetPlayerMappingsByKey(APlayerController* Player, FKey Key, TArray<FInputActionKeyMapping>& Actions, TArray<FInputAxisKeyMapping>& Axes ) const;
 
+	// Returns the player's merged mapping layout, or the default one for an invalid player
+	// Built on first use and kept until the player's mappings or the presets change, the reference is valid until then
+	const FMergedInputMappingLayout& GetPlayerMergedLayout(APlayerController* Player) const;
+
+	// Drops the cached merged layout of a player, or of all players if null
+	// Only needed when IAutoSettingsPlayer::GetInputMappings starts returning different mappings without going through this manager
+	void InvalidatePlayerMergedLayout(APlayerController* Player = nullptr);
+
 	// Set a player's input mapping preset
 	void SetPlayerInputPreset(APlayerController* Player, FInputMappingPreset Preset);
 
@@ -136,6 +145,10 @@ protected:
 
 	virtual void PostInitProperties() override;
 
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
 private:
 
 	UPROPERTY(Config)
@@ -144,6 +157,31 @@ private:
 	UPROPERTY()
 	TArray<APlayerController*> RegisteredPlayerControllers;
 
+	struct FCachedMergedLayout
+	{
+		// Catches a new player controller allocated at the address of a destroyed one
+		TWeakObjectPtr<const APlayerController> Player;
+		FString PlayerId;
+		uint32 Version = 0;
+		// Heap allocated so references handed out survive the cache growing
+		TUniquePtr<FMergedInputMappingLayout> Layout;
+	};
+
+	// Merged layouts by player, null for the default layout
+	mutable TMap<const APlayerController*, FCachedMergedLayout> MergedLayoutCache;
+
+	// Bumped when every cached layout is stale, such as when presets change
+	uint32 MergedLayoutVersion = 0;
+
+	// Drops cached layouts of players with the given ID
+	void InvalidateMergedLayouts(const FString& PlayerId);
+
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+
 	UWorld* GetGameWorld() const;
 
 	void RegisterPlayerController(APlayerController* Player);
@@ -0,0 +1,85 @@
+// Copyright Sam Bonifacio. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayerInputMappings.h"
+
+// A player's merged mapping layout, indexed for repeated lookups
+// Answers the same queries as FInputMappingGroup::GetAllActions / GetAllAxes and FInputMappingLayout::GetActions / GetAxes,
+// with key groups and axis keys resolved once when built instead of on every query
+struct AUTOSETTINGSINPUT_API FMergedInputMappingLayout
+{
+	FMergedInputMappingLayout()
+	{}
+
+	explicit FMergedInputMappingLayout(const FPlayerInputMappings& PlayerMappings);
+
+	// Merged layout the indexes point into
+	const FInputMappingLayout& GetLayout() const { return Layout; }
+
+	// Key group of the player the layout was built for
+	FGameplayTag GetPlayerKeyGroup() const { return PlayerKeyGroup; }
+
+	// Unique actions and axes across all mapping groups, same as FInputMappingLayout::GetActions / GetAxes
+	const TArray<FInputActionKeyMapping>& GetActions() const { return Actions; }
+	const TArray<FInputAxisKeyMapping>& GetAxes() const { return Axes; }
+
+	// Returns the last action in the mapping group that matches the given parameters, null if there is none
+	const FInputActionKeyMapping* FindAction(int32 MappingGroup, FName ActionName, FGameplayTag KeyGroup) const;
+
+	// Returns the last axis in the mapping group that matches the given parameters, null if there is none
+	const FInputAxisKeyMapping* FindAxis(int32 MappingGroup, FName AxisName, float Scale, FGameplayTag KeyGroup) const;
+
+	// Appends all actions in the mapping group that match the given parameters
+	void GetAllActions(int32 MappingGroup, FName ActionName, FGameplayTag KeyGroup, TArray<FInputActionKeyMapping>& OutActions) const;
+
+	// Appends all axes in the mapping group that match the given parameters
+	void GetAllAxes(int32 MappingGroup, FName AxisName, float Scale, FGameplayTag KeyGroup, TArray<FInputAxisKeyMapping>& OutAxes) const;
+
+	// Appends the unique actions and axes bound to the given key
+	void GetMappingsByKey(FKey Key, TArray<FInputActionKeyMapping>& OutActions, TArray<FInputAxisKeyMapping>& OutAxes) const;
+
+	int32 GetNumMappingGroups() const { return Groups.Num(); }
+
+private:
+
+	// A mapping along with what the config says about its key
+	struct FIndexedMapping
+	{
+		int32 Index;
+		FGameplayTag KeyGroup;
+		float Scale;
+		bool bIsAxisKey;
+	};
+
+	// Mappings of one mapping group by name, in the order they appear in the group
+	struct FGroupIndex
+	{
+		TMap<FName, TArray<FIndexedMapping>> Actions;
+		TMap<FName, TArray<FIndexedMapping>> Axes;
+	};
+
+	FInputMappingLayout Layout;
+
+	FGameplayTag PlayerKeyGroup;
+
+	TWeakInterfacePtr<const IAutoSettingsInputConfigInterface> Config;
+
+	TArray<FGroupIndex> Groups;
+
+	TArray<FInputActionKeyMapping> Actions;
+
+	TArray<FInputAxisKeyMapping> Axes;
+
+	// Indexes into Actions and Axes by key
+	TMap<FKey, TArray<int32>> ActionsByKey;
+	TMap<FKey, TArray<int32>> AxesByKey;
+
+	// Logs the same error as FInputMappingGroup when querying a key group the config doesn't define
+	void CheckKeyGroup(FGameplayTag KeyGroup) const;
+
+	static bool MatchesKeyGroup(const FIndexedMapping& Mapping, FGameplayTag KeyGroup) { return !KeyGroup.IsValid() || Mapping.KeyGroup == KeyGroup; }
+
+	// Axis keys count as all scales
+	static bool MatchesScale(const FIndexedMapping& Mapping, float Scale) { return Mapping.Scale == Scale || Mapping.bIsAxisKey; }
+};
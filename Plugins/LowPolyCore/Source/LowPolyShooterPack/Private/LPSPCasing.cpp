@@ -18,6 +18,65 @@ ALPSPCasing::ALPSPCasing()
 	Mesh->SetupAttachment(Pivot);
 }
 
+void ALPSPCasing::BeginPlay()
+{
+	//Base.
+	Super::BeginPlay();
+
+	//Track our own life time, the creation time means nothing once the casing gets reused.
+	ActivationTime = GetWorld()->GetTimeSeconds();
+}
+
+float ALPSPCasing::GetLifeTime() const
+{
+	return GetWorld()->GetTimeSeconds() - ActivationTime;
+}
+
+void ALPSPCasing::MakePooled()
+{
+	//Remember how the mesh was set up before physics gets to move it around.
+	MeshRelativeTransform = Mesh->GetRelativeTransform();
+	bMeshSimulatesPhysics = Mesh->BodyInstance.bSimulatePhysics;
+
+	bPooled = true;
+	Deactivate();
+}
+
+void ALPSPCasing::Activate(const FVector& Location, const FRotator& Rotation)
+{
+	//Put the mesh back on the pivot, simulating physics detached it.
+	if(Mesh->GetAttachParent() != Pivot)
+		Mesh->AttachToComponent(Pivot, FAttachmentTransformRules::KeepRelativeTransform);
+	Mesh->SetRelativeTransform(MeshRelativeTransform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	//Wake up.
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	if(bMeshSimulatesPhysics)
+	{
+		Mesh->SetSimulatePhysics(true);
+		Mesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		Mesh->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+	}
+
+	bActive = true;
+	ActivationTime = GetWorld()->GetTimeSeconds();
+	OnSpawn();
+}
+
+void ALPSPCasing::Deactivate()
+{
+	//Go dormant.
+	Mesh->SetSimulatePhysics(false);
+	SetActorTickEnabled(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+
+	bActive = false;
+}
+
 void ALPSPCasing::OnSpawn_Implementation()
 {
 	//We calculate the delay on spawn so that it works properly, as Begin Play is not getting called.
@@ -40,12 +99,15 @@ void ALPSPCasing::Tick(const float DeltaTime)
 	Mesh->AddLocalRotation(FRotator(Rotation, Rotation, 0));
 
 	//Destroy.
-	if(GetGameTimeSinceCreation() >= DestroyDelay)
+	if(GetLifeTime() >= DestroyDelay)
 	{
 		//Play sound.
 		UGameplayStatics::PlaySoundAtLocation(GetWorld(), Sound, GetActorLocation());
 
-		//Destroy this actor.
-		Destroy();
+		//Pooled casings go back to sleep, others destroy themselves.
+		if(bPooled)
+			Deactivate();
+		else
+			Destroy();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+//Copyright 2021, Infima Games. All Rights Reserved.
+
+#include "LPSPCasingPool.h"
+#include "LPSPCasing.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarCasingPoolMaxPerType(
+	TEXT("lpsp.CasingPool.MaxPerType"),
+	48,
+	TEXT("Most casings of a single type alive at once. Past this, the oldest casing is recycled for the next shot."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<int32> CVarCasingPoolPreallocate(
+	TEXT("lpsp.CasingPool.Preallocate"),
+	16,
+	TEXT("Dormant casings created the first time a casing type is fired."),
+	ECVF_Default);
+
+bool ULPSPCasingPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	//Nothing would ever see the casings.
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULPSPCasingPoolSubsystem::Deinitialize()
+{
+	//The casings themselves go away with the world.
+	Rings.Empty();
+
+	//Base.
+	Super::Deinitialize();
+}
+
+ALPSPCasing* ULPSPCasingPoolSubsystem::Acquire(const TSubclassOf<ALPSPCasing> CasingType, const FVector& Location,
+                                               const FRotator& Rotation)
+{
+	if(CasingType == nullptr)
+		return nullptr;
+
+	FLPSPCasingRing* Ring = Rings.Find(CasingType);
+	if(Ring == nullptr)
+	{
+		Preallocate(CasingType, CVarCasingPoolPreallocate.GetValueOnGameThread());
+		Ring = &Rings.FindOrAdd(CasingType);
+	}
+
+	//Casings are handed out in ring order, so the next one is also the oldest.
+	TArray<ALPSPCasing*>& Casings = Ring->Casings;
+	const int32 MaxCasings = FMath::Max(CVarCasingPoolMaxPerType.GetValueOnGameThread(), 1);
+	ALPSPCasing* Casing = Casings.IsValidIndex(Ring->Next) ? Casings[Ring->Next] : nullptr;
+
+	if(!IsValid(Casing))
+	{
+		//Something else destroyed it, take its place.
+		Casing = SpawnDormant(CasingType);
+		if(Casing == nullptr)
+			return nullptr;
+
+		if(Casings.IsValidIndex(Ring->Next))
+			Casings[Ring->Next] = Casing;
+		else
+			Casings.Add(Casing);
+	}
+	else if(Casing->IsActive() && Casings.Num() < MaxCasings)
+	{
+		//The oldest casing is still flying and we have room, grow instead of cutting it short.
+		ALPSPCasing* NewCasing = SpawnDormant(CasingType);
+		if(NewCasing != nullptr)
+		{
+			Casings.Insert(NewCasing, Ring->Next);
+			Casing = NewCasing;
+		}
+	}
+
+	Ring->Next = (Ring->Next + 1) % Casings.Num();
+	Casing->Activate(Location, Rotation);
+	return Casing;
+}
+
+void ULPSPCasingPoolSubsystem::Preallocate(const TSubclassOf<ALPSPCasing> CasingType, const int32 Count)
+{
+	if(CasingType == nullptr)
+		return;
+
+	FLPSPCasingRing& Ring = Rings.FindOrAdd(CasingType);
+	const int32 Target = FMath::Min(Count, FMath::Max(CVarCasingPoolMaxPerType.GetValueOnGameThread(), 1));
+	Ring.Casings.Reserve(Target);
+
+	//Dormant casings have no age, so they can go anywhere in the ring.
+	while(Ring.Casings.Num() < Target)
+	{
+		ALPSPCasing* Casing = SpawnDormant(CasingType);
+		if(Casing == nullptr)
+			return;
+
+		Ring.Casings.Add(Casing);
+	}
+}
+
+ALPSPCasing* ULPSPCasingPoolSubsystem::SpawnDormant(const TSubclassOf<ALPSPCasing> CasingType) const
+{
+	UWorld* World = GetWorld();
+	if(World == nullptr)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	ALPSPCasing* Casing = World->SpawnActor<ALPSPCasing>(CasingType, FTransform::Identity, SpawnParameters);
+	if(Casing != nullptr)
+		Casing->MakePooled();
+	return Casing;
+}
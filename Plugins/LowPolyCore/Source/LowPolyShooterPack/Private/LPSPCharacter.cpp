@@ -2,6 +2,9 @@
 
 #include "LPSPCharacter.h"
 #include "LPSPGameInstance.h"
+#include "LPSPLaser.h"
+#include "LPSPMagazine.h"
+#include "LPSPMuzzle.h"
 #include "LPSPScope.h"
 #include "LPSPWeapon.h"
 #include "Animation/AnimInstance.h"
@@ -11,12 +14,21 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Engine/SkeletalMeshSocket.h"
+
+/**Socket on the arms that animations use to move the camera.*/
+static const FName CameraSocketName(TEXT("SOCKET_Camera"));
+
+/**Animation curve that drives the camera's field of view.*/
+static const FName FieldOfViewCurveName(TEXT("Field Of View"));
 
 ALPSPCharacter::ALPSPCharacter()
 {
-	//Disable Tick since we have our own custom delay.
-	PrimaryActorTick.bCanEverTick = false;
-	PrimaryActorTick.bStartWithTickEnabled = false;
+	//Tick once per frame so our Update stays in sync with rendering.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+	//Update reads the arms' pose for the camera socket, so tick after physics, once the arms have ticked (see BeginPlay), and before the camera manager updates the view.
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
 
 	//Create Spring Arm.
 	Spring = CreateDefaultSubobject<USpringArmComponent>(TEXT("Spring"));
@@ -42,7 +54,7 @@ void ALPSPCharacter::OnConstruction(const FTransform& Transform)
 	Spring->SetRelativeLocation(GetViewLocation());
 
 	//Fix pivot issue with the character. If we don't do this, the weapon mesh will be a lot higher up than the camera.
-	const FVector CameraLocation = Arms->GetSocketTransform("SOCKET_Camera", RTS_Component).GetLocation();
+	const FVector CameraLocation = Arms->GetSocketTransform(CameraSocketName, RTS_Component).GetLocation();
 	Arms->SetRelativeLocation(FVector(0, 0, -CameraLocation.Z));
 }
 
@@ -51,6 +63,9 @@ void ALPSPCharacter::BeginPlay()
 	//Base.
 	Super::BeginPlay();
 
+	//Wait for the arms' animation. Their tick doesn't complete until parallel evaluation has finished, so the camera socket is this frame's.
+	AddTickPrerequisiteComponent(Arms);
+
 	//Grab the game instance so we can get settings from it at runtime and other goodies.
 	GInstance = Cast<ULPSPGameInstance>(GetGameInstance());
 	
@@ -68,19 +83,26 @@ void ALPSPCharacter::BeginPlay()
 			Weapon->AttachToComponent(Arms, FAttachmentTransformRules::SnapToTargetIncludingScale, WeaponSocket);
 			Weapon->SetOwner(this);
 
-			//Cache attachment references.
+			//Cache attachment references, and keep them cached whenever the weapon's attachments change.
 			Weapon->TryGetScope(Scope);
 			Weapon->TryGetMag(Magazine);
 			Weapon->TryGetLaser(Laser);
 			Weapon->TryGetMuzzle(Muzzle);
+			Weapon->OnAttachmentChanged.AddDynamic(this, &ALPSPCharacter::OnWeaponAttachmentChanged);
 
 			//Update the AnimationInstance to use the Weapon's one. This makes sure that we're using the correct one for each Weapon.
 			Arms->SetAnimInstanceClass(Weapon->GetInstance());
 		}
 	}
-	
-	//Update timer. We use this so we don't have to use the default Tick function.
-	GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &ALPSPCharacter::Update, UpdateInterval, true);
+}
+
+void ALPSPCharacter::Tick(const float DeltaSeconds)
+{
+	//Base.
+	Super::Tick(DeltaSeconds);
+
+	//Update.
+	Update(DeltaSeconds);
 }
 
 void ALPSPCharacter::StopGameAbility(const FLPSPGameAbility Ability)
@@ -95,40 +117,95 @@ void ALPSPCharacter::StopGameAbility(const FLPSPGameAbility Ability)
 	Ability.Stop(AbilityTags, AddRemoved);
 }
 
-void ALPSPCharacter::Update()
+void ALPSPCharacter::Update(const float DeltaSeconds)
 {
 	//Blueprint Update. Important so we can run any Blueprint-specific code.
 	BlueprintUpdate();
 	
 	//Calculate mapped speed by using the velocity and dividing it by the maximum speed. This gives us a zero to one speed value.
 	const FVector Velocity = GetCharacterMovement()->Velocity;
-	MappedSpeed = FVector2D(Velocity.X, Velocity.Y).Size() / GetCharacterMovement()->GetMaxSpeed();
+	const float MaxSpeed = GetCharacterMovement()->GetMaxSpeed();
+	if(Velocity != MappedSpeedVelocity || MaxSpeed != MappedSpeedMaxSpeed)
+	{
+		MappedSpeed = FVector2D(Velocity.X, Velocity.Y).Size() / MaxSpeed;
+		MappedSpeedVelocity = Velocity;
+		MappedSpeedMaxSpeed = MaxSpeed;
+	}
+
+	//Everything past this point is cosmetic, nobody sees it on the server or for other players' characters.
+	if(!ShouldUpdateView())
+		return;
 
-	//Player specific code.
-	if(IsPlayerControlled())
+	//First-Person specific code.
+	if(!IsThirdPerson())
 	{
-		//First-Person specific code.
-		if(!IsThirdPerson())
+		//Constantly update the pivot's location so the camera (parented to it) can react to changes like crouching.
+		//Moving the pivot moves the camera, arms and weapon with it, so only do it while it hasn't settled.
+		const FVector ViewLocation = GetViewLocation();
+		const FVector PivotLocation = Spring->GetRelativeLocation();
+		if(PivotLocation != ViewLocation)
+			Spring->SetRelativeLocation(UKismetMathLibrary::VInterpTo(PivotLocation, ViewLocation, DeltaSeconds, ViewInterpSpeed));
+
+		//Checking in case we don't want to play the camera animation data.
+		FTransform CameraSocketTransform;
+		if(bUseWeaponCameraAnimation && TryGetCameraSocketTransform(CameraSocketTransform))
 		{
-			//Constantly update the pivot's location so the camera (parented to it) can react to changes like crouching.
-			Spring->SetRelativeLocation(UKismetMathLibrary::VInterpTo(Spring->GetRelativeLocation(), GetViewLocation(),
-			                                                          UGameplayStatics::GetWorldDeltaSeconds(
-				                                                          GetWorld()), ViewInterpSpeed));
+			//Update rotation with the camera animation data from animations.
+			const FRotator AnimatedRotation = CameraSocketTransform.GetRotation().Rotator();
+			const FRotator CameraRotation = FRotator(AnimatedRotation.Roll * -1, AnimatedRotation.Yaw, AnimatedRotation.Pitch);
+			if(CameraRotation != Camera->GetRelativeRotation())
+				Camera->SetRelativeRotation(CameraRotation);
+		}
+	}
+
+	//Update camera field of view.
+	const UAnimInstance* Instance = Arms->GetAnimInstance();
+	if(IsValid(Instance))
+	{
+		const float FieldOfView = Instance->GetCurveValue(FieldOfViewCurveName);
+		if(FieldOfView != Camera->FieldOfView)
+			Camera->SetFieldOfView(FieldOfView);
+	}
+}
+
+bool ALPSPCharacter::ShouldUpdateView() const
+{
+	//Only the player looking through this character's camera cares about it.
+	return IsPlayerControlled() && IsLocallyControlled() && GetNetMode() != NM_DedicatedServer;
+}
 
-			//Checking in case we don't want to play the camera animation data.
-			if(bUseWeaponCameraAnimation)
+bool ALPSPCharacter::TryGetCameraSocketTransform(FTransform& OutTransform)
+{
+	//Look the socket up again whenever the arms mesh changes.
+	USkeletalMesh* const ArmsMesh = Arms->SkeletalMesh;
+	if(CameraSocketMesh.Get() != ArmsMesh || CameraSocketMesh.IsStale())
+	{
+		CameraSocketMesh = ArmsMesh;
+		CameraSocketBoneIndex = INDEX_NONE;
+		CameraSocketLocalTransform = FTransform::Identity;
+
+		if(IsValid(ArmsMesh))
+		{
+			//The camera can be either a socket, or a bone with the same name.
+			const USkeletalMeshSocket* const Socket = ArmsMesh->FindSocket(CameraSocketName);
+			if(Socket != nullptr)
 			{
-				//Update rotation with the camera animation data from animations.
-				const FRotator AnimatedRotation = Arms->GetSocketTransform("SOCKET_Camera", RTS_Component).GetRotation().Rotator();
-				Camera->SetRelativeRotation(FRotator(AnimatedRotation.Roll * -1, AnimatedRotation.Yaw, AnimatedRotation.Pitch));
+				CameraSocketBoneIndex = Arms->GetBoneIndex(Socket->BoneName);
+				CameraSocketLocalTransform = Socket->GetSocketLocalTransform();
 			}
+			else
+				CameraSocketBoneIndex = Arms->GetBoneIndex(CameraSocketName);
 		}
-
-		//Update camera field of view.
-		const UAnimInstance* Instance = Arms->GetAnimInstance();
-		if(IsValid(Instance))
-			Camera->SetFieldOfView(Instance->GetCurveValue("Field Of View"));
 	}
+
+	//Make sure the pose has the bone.
+	const TArray<FTransform>& ComponentSpaceTransforms = Arms->GetComponentSpaceTransforms();
+	if(!ComponentSpaceTransforms.IsValidIndex(CameraSocketBoneIndex))
+		return false;
+
+	//Socket transform in component space.
+	OutTransform = CameraSocketLocalTransform * ComponentSpaceTransforms[CameraSocketBoneIndex];
+	return true;
 }
 
 void ALPSPCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -180,6 +257,33 @@ float ALPSPCharacter::GetAimSpeedMultiplier() const
 	return 1.0f;
 }
 
+void ALPSPCharacter::OnWeaponAttachmentChanged(ALPSPWeapon* ChangedWeapon, const TEnumAsByte<ELPSPAttachmentType> Type,
+                                               ALPSPAttachment* Attachment)
+{
+	//Ignore weapons we no longer hold.
+	if(ChangedWeapon != Weapon.Get())
+		return;
+
+	//Update the matching reference.
+	switch(Type)
+	{
+	case ELPSPAttachmentType::Scope:
+		Scope = Cast<ALPSPScope>(Attachment);
+		break;
+	case ELPSPAttachmentType::Magazine:
+		Magazine = Cast<ALPSPMagazine>(Attachment);
+		break;
+	case ELPSPAttachmentType::Laser:
+		Laser = Cast<ALPSPLaser>(Attachment);
+		break;
+	case ELPSPAttachmentType::Muzzle:
+		Muzzle = Cast<ALPSPMuzzle>(Attachment);
+		break;
+	default:
+		break;
+	}
+}
+
 void ALPSPCharacter::Destroyed()
 {
 	//Base.
@@ -4,6 +4,7 @@
 #include "LPSPMagazine.h"
 #include "LPSPWeapon.h"
 #include "LPSPCasing.h"
+#include "LPSPCasingPool.h"
 #include "Runtime/Engine/Classes/Kismet/KismetMathLibrary.h"
 
 void ULPSPEjectCasingNotify::Notify(USkeletalMeshComponent* Weapon, UAnimSequenceBase* Animation)
@@ -29,10 +30,26 @@ void ULPSPEjectCasingNotify::Notify(USkeletalMeshComponent* Weapon, UAnimSequenc
 		const FVector SocketForward = UKismetMathLibrary::GetForwardVector(SocketRotation);
 		const FVector SocketLocation = Weapon->GetSocketLocation(EjectSocketName) + (SocketForward * (Offset + Magazine->GetCasingOffset()));
 			
-		//Spawn casing.
+		//Take a casing from the pool. Casings are cosmetic, so servers skip them, and worlds without a pool spawn one.
 		const FRotator SpawnRotation = bRandomizeInitialRotation ? UKismetMathLibrary::RandomRotator(true) : SocketRotation;
-		ALPSPCasing* SpawnedCasing = Cast<ALPSPCasing>(Weapon->GetWorld()->SpawnActor(Casing, &SocketLocation, &SpawnRotation));
-		SpawnedCasing->OnSpawn();
+		ALPSPCasing* SpawnedCasing = nullptr;
+		UWorld* World = Weapon->GetWorld();
+		if(World->GetNetMode() == NM_DedicatedServer)
+			return;
+
+		if(ULPSPCasingPoolSubsystem* Pool = World->GetSubsystem<ULPSPCasingPoolSubsystem>())
+		{
+			SpawnedCasing = Pool->Acquire(Casing, SocketLocation, SpawnRotation);
+		}
+		else
+		{
+			SpawnedCasing = Cast<ALPSPCasing>(World->SpawnActor(Casing, &SocketLocation, &SpawnRotation));
+			if(SpawnedCasing != nullptr)
+				SpawnedCasing->OnSpawn();
+		}
+
+		if(SpawnedCasing == nullptr)
+			return;
 		
 		//Add impulse.
 		const FVector2D ImpulseRange = Magazine->GetCasingImpulseRange();
@@ -13,6 +13,7 @@ void ULPSPViewmodelAnimInstance::NativeUpdateAnimation(const float DeltaSeconds)
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
 	//Character validity check.
+	bHasViewInputs = false;
 	if(!Character.IsValid())
 		return;
 
@@ -23,94 +24,157 @@ void ULPSPViewmodelAnimInstance::NativeUpdateAnimation(const float DeltaSeconds)
 	//Update states.
 	WeaponHolsterState = Character->GetWeaponHolsterState();
 
-	//Lag multiplier.
-	FLPSPLagValues LagMultiplier = FLPSPLagValues();
-
-	//Reset attachments offset.
-	AttachmentsOffset = FLPSPOffset();
-
-	//Get a reference to the character's weapon.
+	//Attachment values only change when the weapon tells us they do.
 	ALPSPWeapon* Weapon = Character->GetWeapon();
-	if(IsValid(Weapon))
+	BindWeapon(Weapon);
+	if(bAttachmentsDirty)
 	{
-		//Include attachment offsets in our offset calculation.
-		TArray<ALPSPAttachment*> Attachments = Weapon->GetAttachments();
-		for(const ALPSPAttachment* Attachment : Attachments)
-			AttachmentsOffset = AttachmentsOffset + Attachment->GetOffset();
-		
-		//Get a reference to the equipped scope on the character's weapon.
-		ALPSPScope* Scope = nullptr;
-		if(Weapon->TryGetScope(Scope))
-		{
-			//Get scope aiming offset.
-			ScopeAimOffset = Scope->GetAimOffset();
-
-			//Get aiming field of view multiplier.
-			AimFieldOfViewMultiplier = Scope->GetFieldOfViewMultiplier();
-
-			//Get lag multiplier.
-			LagMultiplier = Scope->GetLagMultiplier();
-		}
+		RefreshAttachments(Weapon);
+		bAttachmentsDirty = false;
 	}
-	
+
+	//Inputs for the thread-safe update. Anything that touches the character has to happen here, on the game thread.
+	bHasViewInputs = true;
+	LookYaw = UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f);
+	MovementInput = Character->GetMovement();
+
 	//Update the movement value.
 	Movement = UKismetMathLibrary::FClamp(Character->GetMappedSpeed(), 0.0f, 1.0f);
 
 	//Update our turning rate. (Used to play nice turning animations)
-	const float Yaw = UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f);
-	TurnRate = UKismetMathLibrary::Abs(Yaw) - Movement;
+	TurnRate = UKismetMathLibrary::Abs(LookYaw) - Movement;
 
 	//Calculate the pitch. This line is useful to get proper pitch values [-90, 90].
-	const float Pitch = UKismetMathLibrary::NormalizedDeltaRotator(Character->GetControlRotation(),
-	                                                               Character->GetActorRotation()).Pitch * -0.1f;
+	LookPitch = UKismetMathLibrary::NormalizedDeltaRotator(Character->GetControlRotation(),
+	                                                       Character->GetActorRotation()).Pitch * -0.1f;
 
 	//Get the pitch acceleration so we can have nice clamped lag!
 	PitchAcceleration = Character->GetPitchAcceleration();
+}
+
+void ULPSPViewmodelAnimInstance::NativeThreadSafeUpdateAnimation(const float DeltaSeconds)
+{
+	//Invoke base.
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	//Nothing to work with until the game thread has seen a character.
+	if(!bHasViewInputs)
+		return;
 
 	//We interpolate the movement to get a smoother result, otherwise direction changes make lag snap.
-	CharacterMovementValue = UKismetMathLibrary::Vector2DInterpTo(CharacterMovementValue, Character->GetMovement(), DeltaSeconds, LagMovementInterpSpeed);
-
-	FVector AimingLocationTarget = FVector();
-	AimingLocationTarget = LagAiming.GetLook().Location.Horizontal * LagMultiplier.GetLook().Location.Horizontal *
-		UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f) + LagAiming.GetLook().Location.Vertical *
-		LagMultiplier.GetLook().Location.Vertical * PitchAcceleration;
-	AimingLocationLag = UKismetMathLibrary::VectorSpringInterp(AimingLocationLag, AimingLocationTarget,
-	                                                           AimingLocationSpringState, LagAiming.GetStiffness(),
-	                                                           LagAiming.GetDamping(), DeltaSeconds, 0.006f);
-
-	FVector AimingRotationTarget = FVector();
-	AimingRotationTarget = LagAiming.GetLook().Rotation.Horizontal * LagMultiplier.GetLook().Rotation.Horizontal *
-		UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f) + LagAiming.GetLook().Rotation.Vertical *
-		LagMultiplier.GetLook().Rotation.Vertical * PitchAcceleration;
-	AimingRotationLag = UKismetMathLibrary::VectorSpringInterp(AimingRotationLag, AimingRotationTarget, AimingRotationSpringState, LagAiming.GetStiffness(), LagAiming.GetDamping(), DeltaSeconds, 0.006f);
-
-	const FVector AimingMovementLocationTarget = LagAiming.GetMovement().Location.Horizontal * LagMultiplier.GetMovement().Location.Horizontal * UKismetMathLibrary::FClamp(CharacterMovementValue.X, -1.0f, 1.0f) + LagAiming.GetMovement().Location.Vertical * LagMultiplier.GetMovement().Location.Vertical * UKismetMathLibrary::FClamp(CharacterMovementValue.Y, -1.0f, 1.0f);
-	AimingMovementLocationLag = UKismetMathLibrary::VectorSpringInterp(AimingMovementLocationLag, AimingMovementLocationTarget, AimingMovementLocationSpringState, LagAiming.GetStiffness(), LagAiming.GetDamping(), DeltaSeconds, 0.006f);
-	
-	const FVector AimingMovementRotationTarget = LagAiming.GetMovement().Rotation.Horizontal * LagMultiplier.GetMovement().Rotation.Horizontal * UKismetMathLibrary::FClamp(CharacterMovementValue.X, -1.0f, 1.0f) + LagAiming.GetMovement().Rotation.Vertical * LagMultiplier.GetMovement().Rotation.Vertical * UKismetMathLibrary::FClamp(CharacterMovementValue.Y, -1.0f, 1.0f);
-	AimingMovementRotationLag = UKismetMathLibrary::VectorSpringInterp(AimingMovementRotationLag, AimingMovementRotationTarget, AimingMovementRotationSpringState, LagAiming.GetStiffness(), LagAiming.GetDamping(), DeltaSeconds, 0.006f);
-	
-	FVector StandingLocationTarget = UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f) * LagStanding
-		.GetLook().Location.Horizontal + LagStanding.GetLook().Location.Vertical * PitchAcceleration;
-	StandingLocationTarget += Pitch * LookOffsetMultiplierLocation;
-	StandingLocationLag = UKismetMathLibrary::VectorSpringInterp(StandingLocationLag, StandingLocationTarget,
-	                                                             StandingLocationSpringState,
-	                                                             LagStanding.GetStiffness(), LagStanding.GetDamping(),
-	                                                             DeltaSeconds, 0.006f);
-
-	FVector StandingRotationTarget;
-	StandingRotationTarget = LagStanding.GetLook().Rotation.Horizontal *
-		UKismetMathLibrary::FClamp(Character->GetLook().X, -1.0f, 1.0f) + LagStanding.GetLook().Rotation.Vertical *
-		PitchAcceleration;
-	StandingRotationTarget += UKismetMathLibrary::Clamp(Pitch, -10.0f, 0.0f) * LookOffsetMultiplierRotation;
-	StandingRotationLag = UKismetMathLibrary::VectorSpringInterp(StandingRotationLag, StandingRotationTarget,
-	                                                             StandingRotationSpringState,
-	                                                             LagStanding.GetStiffness(), LagStanding.GetDamping(),
-	                                                             DeltaSeconds, 0.006f);
+	CharacterMovementValue = UKismetMathLibrary::Vector2DInterpTo(CharacterMovementValue, MovementInput, DeltaSeconds, LagMovementInterpSpeed);
+	const float MovementX = UKismetMathLibrary::FClamp(CharacterMovementValue.X, -1.0f, 1.0f);
+	const float MovementY = UKismetMathLibrary::FClamp(CharacterMovementValue.Y, -1.0f, 1.0f);
+
+	//Aiming lag, scaled by the equipped scope.
+	const FLPSPLagValues& LagMultiplier = AttachmentsLagMultiplier;
+	const FLPSPDirectionTransform& AimingLook = LagAiming.GetLook();
+	const FLPSPDirectionTransform& AimingMovement = LagAiming.GetMovement();
+	const FLPSPDirectionTransform& AimingLookMultiplier = LagMultiplier.GetLook();
+	const FLPSPDirectionTransform& AimingMovementMultiplier = LagMultiplier.GetMovement();
+	Springs.SetChannel(FLPSPViewmodelSprings::AimingLocation,
+	                   AimingLook.Location.Horizontal * AimingLookMultiplier.Location.Horizontal,
+	                   AimingLook.Location.Vertical * AimingLookMultiplier.Location.Vertical,
+	                   LookYaw, PitchAcceleration, LagAiming.GetStiffness(), LagAiming.GetDamping());
+	Springs.SetChannel(FLPSPViewmodelSprings::AimingRotation,
+	                   AimingLook.Rotation.Horizontal * AimingLookMultiplier.Rotation.Horizontal,
+	                   AimingLook.Rotation.Vertical * AimingLookMultiplier.Rotation.Vertical,
+	                   LookYaw, PitchAcceleration, LagAiming.GetStiffness(), LagAiming.GetDamping());
+	Springs.SetChannel(FLPSPViewmodelSprings::AimingMovementLocation,
+	                   AimingMovement.Location.Horizontal * AimingMovementMultiplier.Location.Horizontal,
+	                   AimingMovement.Location.Vertical * AimingMovementMultiplier.Location.Vertical,
+	                   MovementX, MovementY, LagAiming.GetStiffness(), LagAiming.GetDamping());
+	Springs.SetChannel(FLPSPViewmodelSprings::AimingMovementRotation,
+	                   AimingMovement.Rotation.Horizontal * AimingMovementMultiplier.Rotation.Horizontal,
+	                   AimingMovement.Rotation.Vertical * AimingMovementMultiplier.Rotation.Vertical,
+	                   MovementX, MovementY, LagAiming.GetStiffness(), LagAiming.GetDamping());
+
+	//Standing lag, with the look offsets on top.
+	const FLPSPDirectionTransform& StandingLook = LagStanding.GetLook();
+	const FLPSPDirectionTransform& StandingMovement = LagStanding.GetMovement();
+	Springs.SetChannel(FLPSPViewmodelSprings::StandingLocation,
+	                   StandingLook.Location.Horizontal, StandingLook.Location.Vertical,
+	                   LookYaw, PitchAcceleration, LagStanding.GetStiffness(), LagStanding.GetDamping(),
+	                   LookPitch * LookOffsetMultiplierLocation);
+	Springs.SetChannel(FLPSPViewmodelSprings::StandingRotation,
+	                   StandingLook.Rotation.Horizontal, StandingLook.Rotation.Vertical,
+	                   LookYaw, PitchAcceleration, LagStanding.GetStiffness(), LagStanding.GetDamping(),
+	                   UKismetMathLibrary::Clamp(LookPitch, -10.0f, 0.0f) * LookOffsetMultiplierRotation);
+	Springs.SetChannel(FLPSPViewmodelSprings::StandingMovementLocation,
+	                   StandingMovement.Location.Horizontal, StandingMovement.Location.Vertical,
+	                   MovementX, MovementY, LagStanding.GetStiffness(), LagStanding.GetDamping());
+	Springs.SetChannel(FLPSPViewmodelSprings::StandingMovementRotation,
+	                   StandingMovement.Rotation.Horizontal, StandingMovement.Rotation.Vertical,
+	                   MovementX, MovementY, LagStanding.GetStiffness(), LagStanding.GetDamping());
+
+	//Step every spring at once.
+	Springs.Step(DeltaSeconds);
+
+	//Expose the results to the animation graph.
+	AimingLocationLag = Springs.GetValue(FLPSPViewmodelSprings::AimingLocation);
+	AimingRotationLag = Springs.GetValue(FLPSPViewmodelSprings::AimingRotation);
+	AimingMovementLocationLag = Springs.GetValue(FLPSPViewmodelSprings::AimingMovementLocation);
+	AimingMovementRotationLag = Springs.GetValue(FLPSPViewmodelSprings::AimingMovementRotation);
+	StandingLocationLag = Springs.GetValue(FLPSPViewmodelSprings::StandingLocation);
+	StandingRotationLag = Springs.GetValue(FLPSPViewmodelSprings::StandingRotation);
+	StandingMovementLocationLag = Springs.GetValue(FLPSPViewmodelSprings::StandingMovementLocation);
+	StandingMovementRotationLag = Springs.GetValue(FLPSPViewmodelSprings::StandingMovementRotation);
+}
+
+void ULPSPViewmodelAnimInstance::BindWeapon(ALPSPWeapon* Weapon)
+{
+	//Already bound. A destroyed weapon counts as a change so we reset our values.
+	if(Weapon == BoundWeapon.Get() && !BoundWeapon.IsStale())
+		return;
+
+	//Stop listening to the old weapon.
+	if(BoundWeapon.IsValid())
+		BoundWeapon->OnAttachmentChanged.RemoveDynamic(this, &ULPSPViewmodelAnimInstance::OnWeaponAttachmentChanged);
+
+	//Listen to the new one.
+	if(IsValid(Weapon))
+		Weapon->OnAttachmentChanged.AddUniqueDynamic(this, &ULPSPViewmodelAnimInstance::OnWeaponAttachmentChanged);
+
+	//Update.
+	BoundWeapon = Weapon;
+	bAttachmentsDirty = true;
+}
+
+void ULPSPViewmodelAnimInstance::RefreshAttachments(const ALPSPWeapon* Weapon)
+{
+	//Reset.
+	AttachmentsOffset = FLPSPOffset();
+	AttachmentsLagMultiplier = FLPSPLagValues();
+
+	//Validity check.
+	if(!IsValid(Weapon))
+		return;
 	
-	const FVector StandingMovementLocationTarget = LagStanding.GetMovement().Location.Horizontal * UKismetMathLibrary::FClamp(CharacterMovementValue.X, -1.0f, 1.0f) + LagStanding.GetMovement().Location.Vertical * UKismetMathLibrary::FClamp(CharacterMovementValue.Y, -1.0f, 1.0f);
-	StandingMovementLocationLag = UKismetMathLibrary::VectorSpringInterp(StandingMovementLocationLag, StandingMovementLocationTarget, StandingMovementLocationSpringState, LagStanding.GetStiffness(), LagStanding.GetDamping(), DeltaSeconds, 0.006f);
+	//Include attachment offsets in our offset calculation.
+	for(const ALPSPAttachment* Attachment : Weapon->GetEquippedAttachments())
+	{
+		if(IsValid(Attachment))
+			AttachmentsOffset = AttachmentsOffset + Attachment->GetOffset();
+	}
+
+	//Get a reference to the equipped scope on the character's weapon.
+	const ALPSPScope* Scope = Cast<ALPSPScope>(Weapon->GetAttachmentInSlot(ELPSPAttachmentType::Scope));
+	if(IsValid(Scope))
+	{
+		//Get scope aiming offset.
+		ScopeAimOffset = Scope->GetAimOffset();
 
-	const FVector StandingMovementRotationTarget = LagStanding.GetMovement().Rotation.Horizontal * UKismetMathLibrary::FClamp(CharacterMovementValue.X, -1.0f, 1.0f) + LagStanding.GetMovement().Rotation.Vertical * UKismetMathLibrary::FClamp(CharacterMovementValue.Y, -1.0f, 1.0f);
-	StandingMovementRotationLag = UKismetMathLibrary::VectorSpringInterp(StandingMovementRotationLag, StandingMovementRotationTarget, StandingMovementRotationSpringState, LagStanding.GetStiffness(), LagStanding.GetDamping(), DeltaSeconds, 0.006f);
-}
\ No newline at end of file
+		//Get aiming field of view multiplier.
+		AimFieldOfViewMultiplier = Scope->GetFieldOfViewMultiplier();
+
+		//Get lag multiplier.
+		AttachmentsLagMultiplier = Scope->GetLagMultiplier();
+	}
+}
+
+void ULPSPViewmodelAnimInstance::OnWeaponAttachmentChanged(ALPSPWeapon* Weapon, TEnumAsByte<ELPSPAttachmentType> Type,
+                                                           ALPSPAttachment* Attachment)
+{
+	//Read everything again on the next update.
+	bAttachmentsDirty = true;
+}
@@ -0,0 +1,27 @@
+//Copyright 2021, Infima Games. All Rights Reserved.
+
+#include "LPSPViewmodelSprings.h"
+
+FLPSPViewmodelSprings::FLPSPViewmodelSprings()
+{
+	for(int32 Channel = 0; Channel < ChannelCount; Channel++)
+	{
+		Horizontals[Channel] = FVector::ZeroVector;
+		Verticals[Channel] = FVector::ZeroVector;
+		Extras[Channel] = FVector::ZeroVector;
+		Targets[Channel] = FVector::ZeroVector;
+		Values[Channel] = FVector::ZeroVector;
+	}
+}
+
+void FLPSPViewmodelSprings::Step(const float DeltaSeconds)
+{
+	//Targets first. Straight arithmetic over contiguous arrays, which the compiler can vectorize.
+	for(int32 Channel = 0; Channel < ChannelCount; Channel++)
+		Targets[Channel] = Horizontals[Channel] * HorizontalInputs[Channel] + Verticals[Channel] * VerticalInputs[Channel] + Extras[Channel];
+
+	//Then the springs. We keep the engine's spring so the lag feels exactly like it always has.
+	for(int32 Channel = 0; Channel < ChannelCount; Channel++)
+		Values[Channel] = UKismetMathLibrary::VectorSpringInterp(Values[Channel], Targets[Channel], States[Channel],
+		                                                         Stiffnesses[Channel], Dampings[Channel], DeltaSeconds, Mass);
+}
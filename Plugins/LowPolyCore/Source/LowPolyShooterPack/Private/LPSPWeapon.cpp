@@ -7,6 +7,7 @@
 #include "LPSPMagazine.h"
 #include "LPSPScope.h"
 #include "Components/ArrowComponent.h"
+#include "Components/ChildActorComponent.h"
 
 ALPSPWeapon::ALPSPWeapon()
 {
@@ -55,31 +56,39 @@ void ALPSPWeapon::OnConstruction(const FTransform& Transform)
 {
 	//Base.
 	Super::OnConstruction(Transform);
+
+	//Empty all slots.
+	Attachments = TArray<ALPSPAttachment*>{};
+	AttachmentSlots.Init(nullptr, AttachmentSlotCount);
 	
 	//Get all child actor components.
-	TArray<AActor*> Actors;
-	GetAllChildActors(Actors, false);
-	for (AActor* const Actor : Actors)
+	TInlineComponentArray<UChildActorComponent*> Components;
+	GetComponents(Components);
+
+	//Disable all attachments, keeping them by component name so each equipped reference is a single lookup.
+	TMap<FName, ALPSPAttachment*> ChildAttachments;
+	for(UChildActorComponent* const Component : Components)
 	{
-		//Disable all attachments.
-		ALPSPAttachment* const Attachment = Cast<ALPSPAttachment>(Actor);
-		if(IsValid(Attachment))
-			Attachment->TrySetEnabled(Attachment->IsAlwaysVisible());
+		ALPSPAttachment* const Attachment = Cast<ALPSPAttachment>(Component->GetChildActor());
+		if(!IsValid(Attachment))
+			continue;
+
+		Attachment->TrySetEnabled(Attachment->IsAlwaysVisible());
+		ChildAttachments.Add(Component->GetFName(), Attachment);
 	}
 
 	//Select the correct attachments.
-	Attachments = TArray<ALPSPAttachment*>{};
-	CacheAttachment<ALPSPMuzzle>(EquippedMuzzle);
-	CacheAttachment<ALPSPScope>(EquippedScope);
-	CacheAttachment<ALPSPLaser>(EquippedLaser);
-	CacheAttachment<ALPSPMagazine>(EquippedMagazine);
-	CacheAttachment<ALPSPGrip>(EquippedGrip);
+	CacheAttachment<ALPSPMuzzle>(EquippedMuzzle, ChildAttachments);
+	CacheAttachment<ALPSPScope>(EquippedScope, ChildAttachments);
+	CacheAttachment<ALPSPLaser>(EquippedLaser, ChildAttachments);
+	CacheAttachment<ALPSPMagazine>(EquippedMagazine, ChildAttachments);
+	CacheAttachment<ALPSPGrip>(EquippedGrip, ChildAttachments);
 }
 
 bool ALPSPWeapon::TryGetAttachment(const TSubclassOf<ALPSPAttachment> Class, ALPSPAttachment*& OutAttachment)
 {
-	//Try finding a muzzle attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
+	//There's at most one attachment per slot, so this only ever checks a handful.
+	for(ALPSPAttachment* Attachment : AttachmentSlots)
 	{
 		//Validity check.
 		if(!IsValid(Attachment))
@@ -96,92 +105,111 @@ bool ALPSPWeapon::TryGetAttachment(const TSubclassOf<ALPSPAttachment> Class, ALP
 	return false;
 }
 
-bool ALPSPWeapon::TryGetMuzzle(ALPSPMuzzle*& Muzzle)
+ALPSPAttachment* ALPSPWeapon::GetAttachmentInSlot(const TEnumAsByte<ELPSPAttachmentType> Type) const
 {
-	//Try finding a muzzle attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
+	//Slots are only filled in once the weapon is constructed.
+	return AttachmentSlots.IsValidIndex(Type) ? AttachmentSlots[Type] : nullptr;
+}
+
+bool ALPSPWeapon::TryEquipAttachment(ALPSPAttachment* Attachment)
+{
+	//Find the slot.
+	TEnumAsByte<ELPSPAttachmentType> Type;
+	if(!IsValid(Attachment) || !TryGetAttachmentType(Attachment, Type))
+		return false;
+
+	//Make sure we have slots even if we haven't been constructed yet.
+	if(AttachmentSlots.Num() != AttachmentSlotCount)
+		AttachmentSlots.SetNumZeroed(AttachmentSlotCount);
+
+	//Nothing to do.
+	ALPSPAttachment* const Previous = AttachmentSlots[Type];
+	if(Previous == Attachment)
+		return true;
+
+	//Disable the old one, unless it wants to stay visible.
+	if(IsValid(Previous))
 	{
-		//Validity check.
-		if(!IsValid(Attachment))
-			continue;
-		
-		//Cast.
-		Muzzle = Cast<ALPSPMuzzle>(Attachment);
-		if(IsValid(Muzzle))
-			return true;
+		Previous->TrySetEnabled(Previous->IsAlwaysVisible());
+		Attachments.Remove(Previous);
 	}
 
-	return false;
+	//Enable.
+	Attachment->TrySetEnabled(true);
+	
+	//Save it to our attachments.
+	AttachmentSlots[Type] = Attachment;
+	Attachments.AddUnique(Attachment);
+
+	//Notify.
+	OnAttachmentChanged.Broadcast(this, Type, Attachment);
+	return true;
 }
 
-bool ALPSPWeapon::TryGetScope(ALPSPScope*& Scope)
+void ALPSPWeapon::UnequipAttachment(const TEnumAsByte<ELPSPAttachmentType> Type)
 {
-	//Try finding a scope attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
-	{
-		//Validity check.
-		if(!IsValid(Attachment))
-			continue;
-		
-		//Cast.
-		Scope = Cast<ALPSPScope>(Attachment);
-		if(IsValid(Scope))
-			return true;
-	}
+	//Check there's something to remove.
+	ALPSPAttachment* const Previous = GetAttachmentInSlot(Type);
+	if(Previous == nullptr)
+		return;
 
-	return false;
+	//Disable, unless it wants to stay visible.
+	if(IsValid(Previous))
+		Previous->TrySetEnabled(Previous->IsAlwaysVisible());
+
+	//Remove it from our attachments.
+	AttachmentSlots[Type] = nullptr;
+	Attachments.Remove(Previous);
+
+	//Notify.
+	OnAttachmentChanged.Broadcast(this, Type, nullptr);
 }
 
-bool ALPSPWeapon::TryGetLaser(ALPSPLaser*& Laser)
+bool ALPSPWeapon::TryGetAttachmentType(const ALPSPAttachment* Attachment, TEnumAsByte<ELPSPAttachmentType>& OutType)
 {
-	//Try finding a laser attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
-	{
-		//Validity check.
-		if(!IsValid(Attachment))
-			continue;
-		
-		//Cast.
-		Laser = Cast<ALPSPLaser>(Attachment);
-		if(IsValid(Laser))
-			return true;
-	}
+	//Attachment classes are final, so checking the class is enough.
+	if(Attachment->IsA<ALPSPMuzzle>())
+		OutType = ELPSPAttachmentType::Muzzle;
+	else if(Attachment->IsA<ALPSPScope>())
+		OutType = ELPSPAttachmentType::Scope;
+	else if(Attachment->IsA<ALPSPLaser>())
+		OutType = ELPSPAttachmentType::Laser;
+	else if(Attachment->IsA<ALPSPMagazine>())
+		OutType = ELPSPAttachmentType::Magazine;
+	else if(Attachment->IsA<ALPSPGrip>())
+		OutType = ELPSPAttachmentType::Grip;
+	else
+		return false;
+
+	return true;
+}
 
-	return false;
+bool ALPSPWeapon::TryGetMuzzle(ALPSPMuzzle*& Muzzle)
+{
+	//Get the muzzle slot.
+	return TryGetSlot(ELPSPAttachmentType::Muzzle, Muzzle);
 }
 
-bool ALPSPWeapon::TryGetMag(ALPSPMagazine*& Mag)
+bool ALPSPWeapon::TryGetScope(ALPSPScope*& Scope)
 {
-	//Try finding a mag attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
-	{
-		//Validity check.
-		if(!IsValid(Attachment))
-			continue;
-		
-		//Cast.
-		Mag = Cast<ALPSPMagazine>(Attachment);
-		if(IsValid(Mag))
-			return true;
-	}
+	//Get the scope slot.
+	return TryGetSlot(ELPSPAttachmentType::Scope, Scope);
+}
 
-	return false;
+bool ALPSPWeapon::TryGetLaser(ALPSPLaser*& Laser)
+{
+	//Get the laser slot.
+	return TryGetSlot(ELPSPAttachmentType::Laser, Laser);
 }
 
-bool ALPSPWeapon::TryGetGrip(ALPSPGrip*& Grip)
+bool ALPSPWeapon::TryGetMag(ALPSPMagazine*& Mag)
 {
-	//Try finding a mag attachment.
-	for(ALPSPAttachment* Attachment : Attachments)
-	{
-		//Validity check.
-		if(!IsValid(Attachment))
-			continue;
-		
-		//Cast.
-		Grip = Cast<ALPSPGrip>(Attachment);
-		if(IsValid(Grip))
-			return true;
-	}
+	//Get the magazine slot.
+	return TryGetSlot(ELPSPAttachmentType::Magazine, Mag);
+}
 
-	return false;
-}
\ No newline at end of file
+bool ALPSPWeapon::TryGetGrip(ALPSPGrip*& Grip)
+{
+	//Get the grip slot.
+	return TryGetSlot(ELPSPAttachmentType::Grip, Grip);
+}
@@ -36,6 +36,24 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Low Poly Shooter Pack | Casing")
 	float GetDestroyDelay() const { return DestroyDelay; }
 
+	/**Returns the time since this casing was last spawned or activated by its pool.*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Low Poly Shooter Pack | Casing")
+	float GetLifeTime() const;
+
+	/**Hands this casing over to a pool. Instead of being destroyed, it goes dormant once its DestroyDelay is over.*/
+	void MakePooled();
+
+	/**Wakes a pooled casing up at the given location, then calls OnSpawn.
+	 * A casing that is still active starts over.
+	 */
+	void Activate(const FVector& Location, const FRotator& Rotation);
+
+	/**Hides a pooled casing and stops its tick, collision and physics until it is activated again.*/
+	void Deactivate();
+
+	/**Returns true if this casing is currently visible and moving. Casings that aren't pooled are always active.*/
+	bool IsActive() const { return bActive; }
+
 protected:
 	/*Pivot.*/
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Low Poly Shooter Pack")
@@ -72,11 +90,29 @@ private:
 	/**Amount of time required to pass before destroying this object. Works like object life time.*/
 	float DestroyDelay = 1.0f;
 
+	/**World time at which this casing was last spawned or activated.*/
+	float ActivationTime = 0.0f;
+
+	/**Mesh transform relative to the pivot, as authored. Physics detaches the mesh, so this is restored on activation.*/
+	FTransform MeshRelativeTransform;
+
+	/**Whether the mesh simulates physics when active.*/
+	bool bMeshSimulatesPhysics = false;
+
+	/**True if a pool owns this casing.*/
+	bool bPooled = false;
+
+	/**True while visible and moving.*/
+	bool bActive = true;
+
 	/**Start Implementation.*/
 	void OnSpawn_Implementation();
 	void ApplyImpulse_Implementation(FVector Direction, const FVector Strength) const;
 	/**End Implementation.*/
 
+	/**Begin Play.*/
+	virtual void BeginPlay() override;
+
 	/**Tick.*/
 	virtual void Tick(float DeltaTime) override;
 };
\ No newline at end of file
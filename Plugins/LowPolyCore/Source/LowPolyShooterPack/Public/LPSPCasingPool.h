@@ -0,0 +1,56 @@
+//Copyright 2021, Infima Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LPSPCasingPool.generated.h"
+
+class ALPSPCasing;
+
+/**Casings of a single type, recycled in the order they were fired.*/
+USTRUCT()
+struct FLPSPCasingRing
+{
+	GENERATED_BODY()
+
+	/**Every casing created for this type, active or dormant.*/
+	UPROPERTY(Transient)
+	TArray<ALPSPCasing*> Casings;
+
+	/**Index of the casing that will be handed out next. Always the oldest one.*/
+	int32 Next = 0;
+};
+
+/**Keeps a capped ring of casings per casing type, so firing never spawns or destroys actors.
+ * Dormant casings stay in the world hidden, with tick, collision and physics disabled.
+ * Casings are cosmetic, so this subsystem doesn't exist on dedicated servers.
+ */
+UCLASS()
+class LOWPOLYSHOOTERPACK_API ULPSPCasingPoolSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//Begin USubsystem interface.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	//End USubsystem interface.
+
+	/**Activates a casing of CasingType at the given location, recycling the oldest one when the type is at its cap.
+	 * The first call for a type creates that type's preallocated casings.
+	 */
+	ALPSPCasing* Acquire(TSubclassOf<ALPSPCasing> CasingType, const FVector& Location, const FRotator& Rotation);
+
+	/**Creates dormant casings of CasingType until it has Count of them, so the first shots don't spawn anything.*/
+	UFUNCTION(BlueprintCallable, Category = "Low Poly Shooter Pack | Casing")
+	void Preallocate(TSubclassOf<ALPSPCasing> CasingType, int32 Count);
+
+private:
+	/**Spawns a dormant casing owned by this pool.*/
+	ALPSPCasing* SpawnDormant(TSubclassOf<ALPSPCasing> CasingType) const;
+
+	/**Casing rings, by casing type.*/
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<ALPSPCasing>, FLPSPCasingRing> Rings;
+};
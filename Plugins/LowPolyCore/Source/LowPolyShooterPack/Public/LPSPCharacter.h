@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "LPSPAttachmentType.h"
 #include "LPSPGameAbility.h"
 #include "LPSPGameInstance.h"
 #include "LPSPWeaponHolsterState.h"
@@ -27,6 +28,9 @@ public:
 	//Called while in-blueprint.
 	virtual void OnConstruction(const FTransform& Transform) override;
 
+	/**Called every frame. Runs our Update.*/
+	virtual void Tick(float DeltaSeconds) override;
+
 	/**Called when the object is destroyed.*/
 	virtual void Destroyed() override;
 
@@ -217,9 +221,8 @@ protected:
 	//Called when the game starts or when spawned.
 	virtual void BeginPlay() override;
 	
-	/**Update. Basically a Tick function using a special delay setup.*/
-	UFUNCTION()
-	virtual void Update();
+	/**Update. Runs once per frame, skipping any work whose inputs haven't changed.*/
+	virtual void Update(float DeltaSeconds);
 
 	/**Blueprint version of our Update function. Allows us to do more custom work in Blueprints.*/
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Low Poly Shooter Pack | Character")
@@ -254,10 +257,6 @@ private:
 	UPROPERTY(EditInstanceOnly, BlueprintGetter = GetArms, Category = "Low Poly Shooter Pack")
 	class USkeletalMeshComponent* Arms;
 
-	/**Interval between each Update call.*/
-	UPROPERTY(EditAnywhere, Category = "Low Poly Shooter Pack | Character | Update")
-	float UpdateInterval = 0.01f;
-	
 	/**Field Of View value used when running.*/
 	// UPROPERTY(EditAnywhere, Category = "Low Poly Shooter Pack | Character | Camera", meta = (DisplayName = "Field Of View Running Multiplier"))
 	// float RunningFieldOfViewMultiplier = 1.06f;
@@ -286,8 +285,18 @@ private:
 	/**Settings object.*/
 	TWeakObjectPtr<ULPSPGameInstance> GInstance;
 	
-	/**Handle for the Update Timer. Helps us pause or stop the Timer if we ever need to.*/
-	FTimerHandle UpdateTimerHandle;
+	/**Arms mesh the camera socket below was looked up for.*/
+	TWeakObjectPtr<USkeletalMesh> CameraSocketMesh;
+
+	/**Bone the camera socket is attached to. INDEX_NONE if the arms mesh has no camera socket.*/
+	int32 CameraSocketBoneIndex = INDEX_NONE;
+
+	/**Transform of the camera socket relative to its bone.*/
+	FTransform CameraSocketLocalTransform;
+
+	/**Velocity and maximum speed MappedSpeed was last calculated from.*/
+	FVector MappedSpeedVelocity = FVector::ZeroVector;
+	float MappedSpeedMaxSpeed = 0.0f;
 
 	/**Speed Of Aiming. Don't change this.*/
 	const float AimBlendTime = 0.25f;
@@ -295,6 +304,16 @@ private:
 	/**Current holster state the character's equipped weapon is in.*/
 	TEnumAsByte<ELPSPWeaponHolsterState> WeaponHolsterState;
 
+	/**Returns true if this character should do work that only matters to whoever is looking through its camera.*/
+	bool ShouldUpdateView() const;
+
+	/**Returns the component space transform of the camera socket on the arms, using the cached bone instead of looking up the socket by name.*/
+	bool TryGetCameraSocketTransform(FTransform& OutTransform);
+
+	/**Keeps the cached attachment references up to date with the weapon's slots.*/
+	UFUNCTION()
+	void OnWeaponAttachmentChanged(class ALPSPWeapon* ChangedWeapon, TEnumAsByte<ELPSPAttachmentType> Type, class ALPSPAttachment* Attachment);
+
 	/**Default Implementation.*/
 	bool IsCrosshairVisible_Implementation() const { return !bAiming && WeaponHolsterState == Available; }
 };
\ No newline at end of file
@@ -14,10 +14,10 @@ struct LOWPOLYSHOOTERPACK_API FLPSPLagValues
 
 public:
 	/**Returns the value of Movement.*/
-	FLPSPDirectionTransform GetMovement() const { return Movement; }
+	const FLPSPDirectionTransform& GetMovement() const { return Movement; }
 
 	/**Returns the value of Look.*/
-	FLPSPDirectionTransform GetLook() const { return Look; }
+	const FLPSPDirectionTransform& GetLook() const { return Look; }
 
 	/**Returns the value of Stiffness.*/
 	float GetStiffness() const { return Stiffness; }
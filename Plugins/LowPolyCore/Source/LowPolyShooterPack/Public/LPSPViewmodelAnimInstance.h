@@ -3,10 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "LPSPAttachmentType.h"
 #include "LPSPCharacter.h"
 #include "LPSPCharacterAnimInstance.h"
 #include "LPSPLagValues.h"
 #include "LPSPOffset.h"
+#include "LPSPViewmodelSprings.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "LPSPViewmodelAnimInstance.generated.h"
 
@@ -16,9 +18,12 @@ class LOWPOLYSHOOTERPACK_API ULPSPViewmodelAnimInstance final : public ULPSPChar
 	GENERATED_BODY()
 
 public:
-	/**Animation value update.*/
+	/**Animation value update. Gathers everything the thread-safe update needs from the character.*/
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+	/**Thread-safe animation value update. Steps the lag springs, on a worker thread when multi-threaded animation update is enabled.*/
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
 protected:
 	/**Weapon offset applied while standing. (Idle Pose)*/
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Low Poly Shooter Pack | Viewmodel | Offsets", meta = (DisplayName = "Offset Standing"))
@@ -145,15 +150,35 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Low Poly Shooter Pack | Viewmodel | Look Offsets", meta = (DisplayName = "Look Offset Multiplier Rotation"))
 	FVector LookOffsetMultiplierRotation = FVector(0.0f, 0.5f, 0.0f);
 	
+	/**Weapon whose attachment changes we're listening to.*/
+	TWeakObjectPtr<class ALPSPWeapon> BoundWeapon;
+
+	/**True when the attachment values below need to be read from the weapon again.*/
+	bool bAttachmentsDirty = true;
+
+	/**Lag multiplier coming from the currently equipped scope.*/
+	FLPSPLagValues AttachmentsLagMultiplier;
+
+	/**Makes sure we're listening to the character's current weapon.*/
+	void BindWeapon(class ALPSPWeapon* Weapon);
+
+	/**Reads the offsets and multipliers of the weapon's attachments.*/
+	void RefreshAttachments(const class ALPSPWeapon* Weapon);
+
+	/**Called when the bound weapon's attachments change.*/
+	UFUNCTION()
+	void OnWeaponAttachmentChanged(class ALPSPWeapon* Weapon, TEnumAsByte<ELPSPAttachmentType> Type, class ALPSPAttachment* Attachment);
+	
+	/**True when the inputs below were gathered from a valid character this frame.*/
+	bool bHasViewInputs = false;
+
+	/**Character values gathered on the game thread for the thread-safe update.*/
+	float LookYaw = 0.0f;
+	float LookPitch = 0.0f;
+	FVector2D MovementInput = FVector2D::ZeroVector;
+
 	FVector2D CharacterMovementValue;
-	FVectorSpringState AimingLocationSpringState;
-	FVectorSpringState AimingRotationSpringState;
-	FVectorSpringState AimingMovementLocationSpringState;
-	FVectorSpringState AimingMovementRotationSpringState;
-	FVectorSpringState StandingLocationSpringState;
-	FVectorSpringState StandingRotationSpringState;
-	FVectorSpringState StandingMovementLocationSpringState;
-	FVectorSpringState StandingMovementRotationSpringState;
-	FVectorSpringState StandingOffsetLocationSpringState;
-	FVectorSpringState StandingOffsetRotationSpringState;
+
+	/**Every lag spring, stepped together.*/
+	FLPSPViewmodelSprings Springs;
 };
\ No newline at end of file
@@ -0,0 +1,71 @@
+//Copyright 2021, Infima Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/KismetMathLibrary.h"
+
+/**
+ * All of the viewmodel's lag springs, stored channel by channel instead of spread across the anim instance.
+ * Every channel has the same shape, Target = Horizontal * HorizontalInput + Vertical * VerticalInput + Extra,
+ * so the whole block is stepped in one pass. Touches no UObjects, so it is safe to step from a worker thread.
+ */
+struct LOWPOLYSHOOTERPACK_API FLPSPViewmodelSprings
+{
+	/**Spring channels.*/
+	enum EChannel
+	{
+		AimingLocation,
+		AimingRotation,
+		AimingMovementLocation,
+		AimingMovementRotation,
+		StandingLocation,
+		StandingRotation,
+		StandingMovementLocation,
+		StandingMovementRotation,
+		ChannelCount
+	};
+
+	/**Constructor. Every channel starts at rest at zero.*/
+	FLPSPViewmodelSprings();
+
+	/**Sets the target inputs and spring settings of a channel for the next step.*/
+	void SetChannel(const EChannel Channel, const FVector& Horizontal, const FVector& Vertical, const float HorizontalInput,
+	                const float VerticalInput, const float Stiffness, const float Damping, const FVector& Extra = FVector::ZeroVector)
+	{
+		Horizontals[Channel] = Horizontal;
+		Verticals[Channel] = Vertical;
+		HorizontalInputs[Channel] = HorizontalInput;
+		VerticalInputs[Channel] = VerticalInput;
+		Extras[Channel] = Extra;
+		Stiffnesses[Channel] = Stiffness;
+		Dampings[Channel] = Damping;
+	}
+
+	/**Moves every channel towards its target.*/
+	void Step(float DeltaSeconds);
+
+	/**Returns the current value of a channel.*/
+	const FVector& GetValue(const EChannel Channel) const { return Values[Channel]; }
+
+	/**Mass used by every spring.*/
+	static constexpr float Mass = 0.006f;
+
+private:
+	FVector Horizontals[ChannelCount];
+	FVector Verticals[ChannelCount];
+	float HorizontalInputs[ChannelCount] = {};
+	float VerticalInputs[ChannelCount] = {};
+	FVector Extras[ChannelCount];
+	float Stiffnesses[ChannelCount] = {};
+	float Dampings[ChannelCount] = {};
+
+	/**Targets computed at the start of each step.*/
+	FVector Targets[ChannelCount];
+
+	/**Current values.*/
+	FVector Values[ChannelCount];
+
+	/**Spring velocity and error of each channel.*/
+	FVectorSpringState States[ChannelCount];
+};
@@ -5,10 +5,14 @@
 #include "CoreMinimal.h"
 
 #include "LPSPAttachment.h"
+#include "LPSPAttachmentType.h"
 #include "LPSPChildActorRef.h"
 #include "LPSPRepresentation.h"
 #include "LPSPWeapon.generated.h"
 
+/**Called when the attachment in one of a weapon's slots changes. Attachment is null if the slot was emptied.*/
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FLPSPOnAttachmentChanged, class ALPSPWeapon*, Weapon, TEnumAsByte<ELPSPAttachmentType>, Type, ALPSPAttachment*, Attachment);
+
 /**Base Weapon Class. All Weapons inherit from this.*/
 UCLASS(Abstract)
 class LOWPOLYSHOOTERPACK_API ALPSPWeapon final : public ALPSPRepresentation
@@ -18,6 +22,10 @@ class LOWPOLYSHOOTERPACK_API ALPSPWeapon final : public ALPSPRepresentation
 public:
 	ALPSPWeapon();
 
+	/**Called whenever an attachment slot changes. Lets other systems cache attachments instead of asking for them every time.*/
+	UPROPERTY(BlueprintAssignable, Category = "Low Poly Shooter Pack | Weapon")
+	FLPSPOnAttachmentChanged OnAttachmentChanged;
+
 	/**Returns the value of Mesh.*/
 	UFUNCTION(BlueprintGetter, Category = "Low Poly Shooter Pack | Weapon")
 	USkeletalMeshComponent* GetMesh() const { return Mesh; }
@@ -38,10 +46,28 @@ public:
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
 	TArray<ALPSPAttachment*> GetAttachments() const { return Attachments; }
 
+	/**Returns the equipped attachment array without copying it.*/
+	const TArray<ALPSPAttachment*>& GetEquippedAttachments() const { return Attachments; }
+
 	/**Returns an attachment of a specific class.*/
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
 	bool TryGetAttachment(TSubclassOf<ALPSPAttachment> Class, ALPSPAttachment*& OutAttachment);
 
+	/**Returns the attachment equipped in a slot, or null if the slot is empty.*/
+	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
+	ALPSPAttachment* GetAttachmentInSlot(const TEnumAsByte<ELPSPAttachmentType> Type) const;
+
+	/**Equips an attachment in the slot of its type, replacing whatever was there. Returns false if the attachment has no slot.*/
+	UFUNCTION(BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
+	bool TryEquipAttachment(ALPSPAttachment* Attachment);
+
+	/**Empties a slot, disabling the attachment that was in it.*/
+	UFUNCTION(BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
+	void UnequipAttachment(const TEnumAsByte<ELPSPAttachmentType> Type);
+
+	/**Returns the slot an attachment goes into. Returns false for attachments that don't fit any slot.*/
+	static bool TryGetAttachmentType(const ALPSPAttachment* Attachment, TEnumAsByte<ELPSPAttachmentType>& OutType);
+
 	/**Returns true if there is a muzzle equipped. Also returns the actual equipped muzzle.*/
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "Low Poly Shooter Pack | Weapon")
     bool TryGetMuzzle(class ALPSPMuzzle* &Muzzle);
@@ -142,22 +168,32 @@ private:
 	UPROPERTY()
 	TArray<ALPSPAttachment*> Attachments;
 
+	/**Number of attachment slots, one for each ELPSPAttachmentType.*/
+	static constexpr int32 AttachmentSlotCount = Grip + 1;
+
+	/**Equipped attachment of each type, indexed by ELPSPAttachmentType.*/
+	UPROPERTY()
+	TArray<ALPSPAttachment*> AttachmentSlots;
+
 	/**Construction.*/
 	virtual void OnConstruction(const FTransform& Transform) override;
 	
 	/***Used to get a reference to an attachment, enable it and save it to our equipped attachments.*/
 	template <typename T>
-    void CacheAttachment(const FLPSPChildActorRef ActorRef)
+	void CacheAttachment(const FLPSPChildActorRef ActorRef, const TMap<FName, ALPSPAttachment*>& ChildAttachments)
 	{
 		//Get the attachment with the correct type.
-		T* const Attachment = ActorRef.GetComponent<T>(this);
+		ALPSPAttachment* const* Found = ChildAttachments.Find(ActorRef.ComponentName);
+		T* const Attachment = Found != nullptr ? Cast<T>(*Found) : nullptr;
 		if(IsValid(Attachment))
-		{
-			//Enable.
-			Attachment->TrySetEnabled(true);
+			TryEquipAttachment(Attachment);
+	}
 
-			//Save it to our attachments array.
-			Attachments.AddUnique(Attachment);
-		}
+	/**Returns the typed attachment in a slot.*/
+	template <typename T>
+	bool TryGetSlot(const ELPSPAttachmentType Type, T*& OutAttachment) const
+	{
+		OutAttachment = Cast<T>(GetAttachmentInSlot(Type));
+		return IsValid(OutAttachment);
 	}
 };
\ No newline at end of file
@@ -53,7 +53,7 @@ struct PLAYFAB_API FPlayFabBaseModel
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Error | Models")
         FPlayFabError responseError = {};
 
-    /** Holds the full JSON recieved from playfab. */
+    /** Holds the full JSON recieved from playfab. For Client API calls it is reused by the next call, so copy out what you need before the callback returns. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Error | Models")
         UPlayFabJsonObject* responseData = nullptr;
 
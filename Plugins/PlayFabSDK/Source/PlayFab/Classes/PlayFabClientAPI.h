@@ -31,6 +31,7 @@ class PLAYFAB_API UPlayFabClientAPI : public UOnlineBlueprintCallProxyBase
 public:
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnFailurePlayFabError, FPlayFabError, error, UObject*, customData);
 
+    /** Fired once per call, after which the proxy returns to the pool and the response's responseData is emptied */
     UPROPERTY(BlueprintAssignable)
         FOnPlayFabClientRequestCompleted OnPlayFabResponse;
 
@@ -48,6 +49,15 @@ public:
     /** Reset saved response data */
     void ResetResponseData();
 
+    /**
+     * Get a proxy for a new call. Proxies go back to a pool once their call's callbacks have run and are handed out
+     * again, instead of rooting a new object per call, so a proxy and its response object are only valid until then.
+     */
+    static UPlayFabClientAPI* AcquireProxy();
+
+    /** Get the proxy's request Json object, emptied so its fields are built into the previous call's storage */
+    UPlayFabJsonObject* AcquireRequestObject();
+
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
@@ -65,6 +75,8 @@ public:
      * Adds the specified generic service identifier to the player's PlayFab account. This is designed to allow for a PlayFab
      * ID lookup of any arbitrary service identifier a title wants to add. This identifier should never be used as
      * authentication credentials, as the intent is that it is easily accessible by other players.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddGenericID(FClientAddGenericIDRequest request,
@@ -78,7 +90,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessAddOrUpdateContactEmail, FClientAddOrUpdateContactEmailResult, result, UObject*, customData);
 
-    /** Adds or updates a contact email to the player's profile. */
+    /**
+     * Adds or updates a contact email to the player's profile.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddOrUpdateContactEmail(FClientAddOrUpdateContactEmailRequest request,
             FDelegateOnSuccessAddOrUpdateContactEmail onSuccess,
@@ -94,6 +110,8 @@ public:
     /**
      * Adds playfab username/password auth to an existing account created via an anonymous auth method, e.g. automatic device
      * ID login.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddUsernamePassword(FClientAddUsernamePasswordRequest request,
@@ -107,7 +125,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetAccountInfo, FClientGetAccountInfoResult, result, UObject*, customData);
 
-    /** Retrieves the user's PlayFab account details */
+    /**
+     * Retrieves the user's PlayFab account details
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetAccountInfo(FClientGetAccountInfoRequest request,
             FDelegateOnSuccessGetAccountInfo onSuccess,
@@ -120,7 +142,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerCombinedInfo, FClientGetPlayerCombinedInfoResult, result, UObject*, customData);
 
-    /** Retrieves all of the user's different kinds of info. */
+    /**
+     * Retrieves all of the user's different kinds of info.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerCombinedInfo(FClientGetPlayerCombinedInfoRequest request,
             FDelegateOnSuccessGetPlayerCombinedInfo onSuccess,
@@ -133,7 +159,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerProfile, FClientGetPlayerProfileResult, result, UObject*, customData);
 
-    /** Retrieves the player's profile */
+    /**
+     * Retrieves the player's profile
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerProfile(FClientGetPlayerProfileRequest request,
             FDelegateOnSuccessGetPlayerProfile onSuccess,
@@ -146,7 +176,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs, FClientGetPlayFabIDsFromFacebookIDsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of Facebook identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of Facebook identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromFacebookIDs(FClientGetPlayFabIDsFromFacebookIDsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs onSuccess,
@@ -159,7 +193,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromFacebookInstantGamesIds, FClientGetPlayFabIDsFromFacebookInstantGamesIdsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of Facebook Instant Game identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of Facebook Instant Game identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromFacebookInstantGamesIds(FClientGetPlayFabIDsFromFacebookInstantGamesIdsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromFacebookInstantGamesIds onSuccess,
@@ -175,6 +213,8 @@ public:
     /**
      * Retrieves the unique PlayFab identifiers for the given set of Game Center identifiers (referenced in the Game Center
      * Programming Guide as the Player Identifier).
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromGameCenterIDs(FClientGetPlayFabIDsFromGameCenterIDsRequest request,
@@ -192,6 +232,8 @@ public:
      * Retrieves the unique PlayFab identifiers for the given set of generic service identifiers. A generic identifier is the
      * service name plus the service-specific ID for the player, as specified by the title when the generic identifier was
      * added to the player account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromGenericIDs(FClientGetPlayFabIDsFromGenericIDsRequest request,
@@ -208,6 +250,8 @@ public:
     /**
      * Retrieves the unique PlayFab identifiers for the given set of Google identifiers. The Google identifiers are the IDs for
      * the user accounts, available as "id" in the Google+ People API calls.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromGoogleIDs(FClientGetPlayFabIDsFromGoogleIDsRequest request,
@@ -225,6 +269,8 @@ public:
      * Retrieves the unique PlayFab identifiers for the given set of Kongregate identifiers. The Kongregate identifiers are the
      * IDs for the user accounts, available as "user_id" from the Kongregate API methods(ex:
      * http://developers.kongregate.com/docs/client/getUserId).
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromKongregateIDs(FClientGetPlayFabIDsFromKongregateIDsRequest request,
@@ -238,7 +284,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromNintendoServiceAccountIds, FClientGetPlayFabIDsFromNintendoServiceAccountIdsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Service Account identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of Nintendo Service Account identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromNintendoServiceAccountIds(FClientGetPlayFabIDsFromNintendoServiceAccountIdsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromNintendoServiceAccountIds onSuccess,
@@ -251,7 +301,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds, FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Switch Device identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of Nintendo Switch Device identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromNintendoSwitchDeviceIds(FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds onSuccess,
@@ -264,7 +318,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromPSNAccountIDs, FClientGetPlayFabIDsFromPSNAccountIDsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of PlayStation Network identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of PlayStation Network identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromPSNAccountIDs(FClientGetPlayFabIDsFromPSNAccountIDsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromPSNAccountIDs onSuccess,
@@ -280,6 +338,8 @@ public:
     /**
      * Retrieves the unique PlayFab identifiers for the given set of Steam identifiers. The Steam identifiers are the profile
      * IDs for the user accounts, available as SteamId in the Steamworks Community API calls.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromSteamIDs(FClientGetPlayFabIDsFromSteamIDsRequest request,
@@ -297,6 +357,8 @@ public:
      * Retrieves the unique PlayFab identifiers for the given set of Twitch identifiers. The Twitch identifiers are the IDs for
      * the user accounts, available as "_id" from the Twitch API methods (ex:
      * https://github.com/justintv/Twitch-API/blob/master/v3_resources/users.md#get-usersuser).
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromTwitchIDs(FClientGetPlayFabIDsFromTwitchIDsRequest request,
@@ -310,7 +372,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayFabIDsFromXboxLiveIDs, FClientGetPlayFabIDsFromXboxLiveIDsResult, result, UObject*, customData);
 
-    /** Retrieves the unique PlayFab identifiers for the given set of XboxLive identifiers. */
+    /**
+     * Retrieves the unique PlayFab identifiers for the given set of XboxLive identifiers.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayFabIDsFromXboxLiveIDs(FClientGetPlayFabIDsFromXboxLiveIDsRequest request,
             FDelegateOnSuccessGetPlayFabIDsFromXboxLiveIDs onSuccess,
@@ -323,7 +389,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkAndroidDeviceID, FClientLinkAndroidDeviceIDResult, result, UObject*, customData);
 
-    /** Links the Android device identifier to the user's PlayFab account */
+    /**
+     * Links the Android device identifier to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkAndroidDeviceID(FClientLinkAndroidDeviceIDRequest request,
             FDelegateOnSuccessLinkAndroidDeviceID onSuccess,
@@ -336,7 +406,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkApple, FClientEmptyResult, result, UObject*, customData);
 
-    /** Links the Apple account associated with the token to the user's PlayFab account. */
+    /**
+     * Links the Apple account associated with the token to the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkApple(FClientLinkAppleRequest request,
             FDelegateOnSuccessLinkApple onSuccess,
@@ -349,7 +423,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkCustomID, FClientLinkCustomIDResult, result, UObject*, customData);
 
-    /** Links the custom identifier, generated by the title, to the user's PlayFab account */
+    /**
+     * Links the custom identifier, generated by the title, to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkCustomID(FClientLinkCustomIDRequest request,
             FDelegateOnSuccessLinkCustomID onSuccess,
@@ -362,7 +440,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkFacebookAccount, FClientLinkFacebookAccountResult, result, UObject*, customData);
 
-    /** Links the Facebook account associated with the provided Facebook access token to the user's PlayFab account */
+    /**
+     * Links the Facebook account associated with the provided Facebook access token to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkFacebookAccount(FClientLinkFacebookAccountRequest request,
             FDelegateOnSuccessLinkFacebookAccount onSuccess,
@@ -375,7 +457,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkFacebookInstantGamesId, FClientLinkFacebookInstantGamesIdResult, result, UObject*, customData);
 
-    /** Links the Facebook Instant Games Id to the user's PlayFab account */
+    /**
+     * Links the Facebook Instant Games Id to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkFacebookInstantGamesId(FClientLinkFacebookInstantGamesIdRequest request,
             FDelegateOnSuccessLinkFacebookInstantGamesId onSuccess,
@@ -393,6 +479,8 @@ public:
      * a Game Center ID is insecure if you do not include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters
      * in this request. It is recommended you require these parameters on all Game Center calls by going to the Apple Add-ons
      * page in the PlayFab Game Manager and enabling the 'Require secure authentication only for this app' option.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkGameCenterAccount(FClientLinkGameCenterAccountRequest request,
@@ -406,7 +494,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkGoogleAccount, FClientLinkGoogleAccountResult, result, UObject*, customData);
 
-    /** Links the currently signed-in user account to their Google account, using their Google account credentials */
+    /**
+     * Links the currently signed-in user account to their Google account, using their Google account credentials
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkGoogleAccount(FClientLinkGoogleAccountRequest request,
             FDelegateOnSuccessLinkGoogleAccount onSuccess,
@@ -419,7 +511,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkIOSDeviceID, FClientLinkIOSDeviceIDResult, result, UObject*, customData);
 
-    /** Links the vendor-specific iOS device identifier to the user's PlayFab account */
+    /**
+     * Links the vendor-specific iOS device identifier to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkIOSDeviceID(FClientLinkIOSDeviceIDRequest request,
             FDelegateOnSuccessLinkIOSDeviceID onSuccess,
@@ -432,7 +528,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkKongregate, FClientLinkKongregateAccountResult, result, UObject*, customData);
 
-    /** Links the Kongregate identifier to the user's PlayFab account */
+    /**
+     * Links the Kongregate identifier to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkKongregate(FClientLinkKongregateAccountRequest request,
             FDelegateOnSuccessLinkKongregate onSuccess,
@@ -445,7 +545,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkNintendoServiceAccount, FClientEmptyResult, result, UObject*, customData);
 
-    /** Links the Nintendo account associated with the token to the user's PlayFab account. */
+    /**
+     * Links the Nintendo account associated with the token to the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkNintendoServiceAccount(FClientLinkNintendoServiceAccountRequest request,
             FDelegateOnSuccessLinkNintendoServiceAccount onSuccess,
@@ -458,7 +562,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkNintendoSwitchDeviceId, FClientLinkNintendoSwitchDeviceIdResult, result, UObject*, customData);
 
-    /** Links the NintendoSwitchDeviceId to the user's PlayFab account */
+    /**
+     * Links the NintendoSwitchDeviceId to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkNintendoSwitchDeviceId(FClientLinkNintendoSwitchDeviceIdRequest request,
             FDelegateOnSuccessLinkNintendoSwitchDeviceId onSuccess,
@@ -474,6 +582,8 @@ public:
     /**
      * Links an OpenID Connect account to a user's PlayFab account, based on an existing relationship between a title and an
      * Open ID Connect provider and the OpenId Connect JWT from that provider.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkOpenIdConnect(FClientLinkOpenIdConnectRequest request,
@@ -487,7 +597,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkPSNAccount, FClientLinkPSNAccountResult, result, UObject*, customData);
 
-    /** Links the PlayStation Network account associated with the provided access code to the user's PlayFab account */
+    /**
+     * Links the PlayStation Network account associated with the provided access code to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkPSNAccount(FClientLinkPSNAccountRequest request,
             FDelegateOnSuccessLinkPSNAccount onSuccess,
@@ -500,7 +614,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkSteamAccount, FClientLinkSteamAccountResult, result, UObject*, customData);
 
-    /** Links the Steam account associated with the provided Steam authentication ticket to the user's PlayFab account */
+    /**
+     * Links the Steam account associated with the provided Steam authentication ticket to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkSteamAccount(FClientLinkSteamAccountRequest request,
             FDelegateOnSuccessLinkSteamAccount onSuccess,
@@ -513,7 +631,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkTwitch, FClientLinkTwitchAccountResult, result, UObject*, customData);
 
-    /** Links the Twitch account associated with the token to the user's PlayFab account. */
+    /**
+     * Links the Twitch account associated with the token to the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkTwitch(FClientLinkTwitchAccountRequest request,
             FDelegateOnSuccessLinkTwitch onSuccess,
@@ -526,7 +648,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLinkXboxAccount, FClientLinkXboxAccountResult, result, UObject*, customData);
 
-    /** Links the Xbox Live account associated with the provided access code to the user's PlayFab account */
+    /**
+     * Links the Xbox Live account associated with the provided access code to the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LinkXboxAccount(FClientLinkXboxAccountRequest request,
             FDelegateOnSuccessLinkXboxAccount onSuccess,
@@ -539,7 +665,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRemoveContactEmail, FClientRemoveContactEmailResult, result, UObject*, customData);
 
-    /** Removes a contact email from the player's profile. */
+    /**
+     * Removes a contact email from the player's profile.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RemoveContactEmail(FClientRemoveContactEmailRequest request,
             FDelegateOnSuccessRemoveContactEmail onSuccess,
@@ -552,7 +682,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRemoveGenericID, FClientRemoveGenericIDResult, result, UObject*, customData);
 
-    /** Removes the specified generic service identifier from the player's PlayFab account. */
+    /**
+     * Removes the specified generic service identifier from the player's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RemoveGenericID(FClientRemoveGenericIDRequest request,
             FDelegateOnSuccessRemoveGenericID onSuccess,
@@ -568,6 +702,8 @@ public:
     /**
      * Submit a report for another player (due to bad bahavior, etc.), so that customer service representatives for the title
      * can take action concerning potentially toxic players.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ReportPlayer(FClientReportPlayerClientRequest request,
@@ -585,6 +721,8 @@ public:
      * Forces an email to be sent to the registered email address for the user's account, with a link allowing the user to
      * change the password.If an account recovery email template ID is provided, an email using the custom email template will
      * be used.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* SendAccountRecoveryEmail(FClientSendAccountRecoveryEmailRequest request,
@@ -598,7 +736,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkAndroidDeviceID, FClientUnlinkAndroidDeviceIDResult, result, UObject*, customData);
 
-    /** Unlinks the related Android device identifier from the user's PlayFab account */
+    /**
+     * Unlinks the related Android device identifier from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkAndroidDeviceID(FClientUnlinkAndroidDeviceIDRequest request,
             FDelegateOnSuccessUnlinkAndroidDeviceID onSuccess,
@@ -611,7 +753,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkApple, FClientEmptyResponse, result, UObject*, customData);
 
-    /** Unlinks the related Apple account from the user's PlayFab account. */
+    /**
+     * Unlinks the related Apple account from the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkApple(FClientUnlinkAppleRequest request,
             FDelegateOnSuccessUnlinkApple onSuccess,
@@ -624,7 +770,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkCustomID, FClientUnlinkCustomIDResult, result, UObject*, customData);
 
-    /** Unlinks the related custom identifier from the user's PlayFab account */
+    /**
+     * Unlinks the related custom identifier from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkCustomID(FClientUnlinkCustomIDRequest request,
             FDelegateOnSuccessUnlinkCustomID onSuccess,
@@ -637,7 +787,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkFacebookAccount, FClientUnlinkFacebookAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Facebook account from the user's PlayFab account */
+    /**
+     * Unlinks the related Facebook account from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkFacebookAccount(FClientUnlinkFacebookAccountRequest request,
             FDelegateOnSuccessUnlinkFacebookAccount onSuccess,
@@ -650,7 +804,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkFacebookInstantGamesId, FClientUnlinkFacebookInstantGamesIdResult, result, UObject*, customData);
 
-    /** Unlinks the related Facebook Instant Game Ids from the user's PlayFab account */
+    /**
+     * Unlinks the related Facebook Instant Game Ids from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkFacebookInstantGamesId(FClientUnlinkFacebookInstantGamesIdRequest request,
             FDelegateOnSuccessUnlinkFacebookInstantGamesId onSuccess,
@@ -663,7 +821,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkGameCenterAccount, FClientUnlinkGameCenterAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Game Center account from the user's PlayFab account */
+    /**
+     * Unlinks the related Game Center account from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkGameCenterAccount(FClientUnlinkGameCenterAccountRequest request,
             FDelegateOnSuccessUnlinkGameCenterAccount onSuccess,
@@ -679,6 +841,8 @@ public:
     /**
      * Unlinks the related Google account from the user's PlayFab account
      * (https://developers.google.com/android/reference/com/google/android/gms/auth/GoogleAuthUtil#public-methods).
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkGoogleAccount(FClientUnlinkGoogleAccountRequest request,
@@ -692,7 +856,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkIOSDeviceID, FClientUnlinkIOSDeviceIDResult, result, UObject*, customData);
 
-    /** Unlinks the related iOS device identifier from the user's PlayFab account */
+    /**
+     * Unlinks the related iOS device identifier from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkIOSDeviceID(FClientUnlinkIOSDeviceIDRequest request,
             FDelegateOnSuccessUnlinkIOSDeviceID onSuccess,
@@ -705,7 +873,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkKongregate, FClientUnlinkKongregateAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Kongregate identifier from the user's PlayFab account */
+    /**
+     * Unlinks the related Kongregate identifier from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkKongregate(FClientUnlinkKongregateAccountRequest request,
             FDelegateOnSuccessUnlinkKongregate onSuccess,
@@ -718,7 +890,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkNintendoServiceAccount, FClientEmptyResponse, result, UObject*, customData);
 
-    /** Unlinks the related Nintendo account from the user's PlayFab account. */
+    /**
+     * Unlinks the related Nintendo account from the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkNintendoServiceAccount(FClientUnlinkNintendoServiceAccountRequest request,
             FDelegateOnSuccessUnlinkNintendoServiceAccount onSuccess,
@@ -731,7 +907,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkNintendoSwitchDeviceId, FClientUnlinkNintendoSwitchDeviceIdResult, result, UObject*, customData);
 
-    /** Unlinks the related NintendoSwitchDeviceId from the user's PlayFab account */
+    /**
+     * Unlinks the related NintendoSwitchDeviceId from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkNintendoSwitchDeviceId(FClientUnlinkNintendoSwitchDeviceIdRequest request,
             FDelegateOnSuccessUnlinkNintendoSwitchDeviceId onSuccess,
@@ -747,6 +927,8 @@ public:
     /**
      * Unlinks an OpenID Connect account from a user's PlayFab account, based on the connection ID of an existing relationship
      * between a title and an Open ID Connect provider.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkOpenIdConnect(FClientUnlinkOpenIdConnectRequest request,
@@ -760,7 +942,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkPSNAccount, FClientUnlinkPSNAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related PSN account from the user's PlayFab account */
+    /**
+     * Unlinks the related PSN account from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkPSNAccount(FClientUnlinkPSNAccountRequest request,
             FDelegateOnSuccessUnlinkPSNAccount onSuccess,
@@ -773,7 +959,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkSteamAccount, FClientUnlinkSteamAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Steam account from the user's PlayFab account */
+    /**
+     * Unlinks the related Steam account from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkSteamAccount(FClientUnlinkSteamAccountRequest request,
             FDelegateOnSuccessUnlinkSteamAccount onSuccess,
@@ -786,7 +976,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkTwitch, FClientUnlinkTwitchAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Twitch account from the user's PlayFab account. */
+    /**
+     * Unlinks the related Twitch account from the user's PlayFab account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkTwitch(FClientUnlinkTwitchAccountRequest request,
             FDelegateOnSuccessUnlinkTwitch onSuccess,
@@ -799,7 +993,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUnlinkXboxAccount, FClientUnlinkXboxAccountResult, result, UObject*, customData);
 
-    /** Unlinks the related Xbox Live account from the user's PlayFab account */
+    /**
+     * Unlinks the related Xbox Live account from the user's PlayFab account
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlinkXboxAccount(FClientUnlinkXboxAccountRequest request,
             FDelegateOnSuccessUnlinkXboxAccount onSuccess,
@@ -812,7 +1010,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUpdateAvatarUrl, FClientEmptyResponse, result, UObject*, customData);
 
-    /** Update the avatar URL of the player */
+    /**
+     * Update the avatar URL of the player
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateAvatarUrl(FClientUpdateAvatarUrlRequest request,
             FDelegateOnSuccessUpdateAvatarUrl onSuccess,
@@ -825,7 +1027,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUpdateUserTitleDisplayName, FClientUpdateUserTitleDisplayNameResult, result, UObject*, customData);
 
-    /** Updates the title specific display name for the user */
+    /**
+     * Updates the title specific display name for the user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateUserTitleDisplayName(FClientUpdateUserTitleDisplayNameRequest request,
             FDelegateOnSuccessUpdateUserTitleDisplayName onSuccess,
@@ -842,7 +1048,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessAttributeInstall, FClientAttributeInstallResult, result, UObject*, customData);
 
-    /** Attributes an install for advertisment. */
+    /**
+     * Attributes an install for advertisment.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Advertising ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AttributeInstall(FClientAttributeInstallRequest request,
             FDelegateOnSuccessAttributeInstall onSuccess,
@@ -855,7 +1065,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetAdPlacements, FClientGetAdPlacementsResult, result, UObject*, customData);
 
-    /** Returns a list of ad placements and a reward for each */
+    /**
+     * Returns a list of ad placements and a reward for each
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Advertising ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetAdPlacements(FClientGetAdPlacementsRequest request,
             FDelegateOnSuccessGetAdPlacements onSuccess,
@@ -868,7 +1082,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessReportAdActivity, FClientReportAdActivityResult, result, UObject*, customData);
 
-    /** Report player's ad activity */
+    /**
+     * Report player's ad activity
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Advertising ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ReportAdActivity(FClientReportAdActivityRequest request,
             FDelegateOnSuccessReportAdActivity onSuccess,
@@ -881,7 +1099,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRewardAdActivity, FClientRewardAdActivityResult, result, UObject*, customData);
 
-    /** Reward player's ad activity */
+    /**
+     * Reward player's ad activity
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Advertising ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RewardAdActivity(FClientRewardAdActivityRequest request,
             FDelegateOnSuccessRewardAdActivity onSuccess,
@@ -901,6 +1123,8 @@ public:
     /**
      * Write a PlayStream event to describe the provided player device information. This API method is not designed to be
      * called directly by developers. Each PlayFab client SDK will eventually report this information automatically.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Analytics ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ReportDeviceInfo(FClientDeviceInfoRequest request,
@@ -914,7 +1138,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessWriteCharacterEvent, FClientWriteEventResponse, result, UObject*, customData);
 
-    /** Writes a character-based event into PlayStream. */
+    /**
+     * Writes a character-based event into PlayStream.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Analytics ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* WriteCharacterEvent(FClientWriteClientCharacterEventRequest request,
             FDelegateOnSuccessWriteCharacterEvent onSuccess,
@@ -927,7 +1155,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessWritePlayerEvent, FClientWriteEventResponse, result, UObject*, customData);
 
-    /** Writes a player-based event into PlayStream. */
+    /**
+     * Writes a player-based event into PlayStream.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Analytics ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* WritePlayerEvent(FClientWriteClientPlayerEventRequest request,
             FDelegateOnSuccessWritePlayerEvent onSuccess,
@@ -940,7 +1172,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessWriteTitleEvent, FClientWriteEventResponse, result, UObject*, customData);
 
-    /** Writes a title-based event into PlayStream. */
+    /**
+     * Writes a title-based event into PlayStream.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Analytics ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* WriteTitleEvent(FClientWriteTitleEventRequest request,
             FDelegateOnSuccessWriteTitleEvent onSuccess,
@@ -960,6 +1196,8 @@ public:
     /**
      * Gets a Photon custom authentication token that can be used to securely join the player into a Photon room. See
      * https://docs.microsoft.com/gaming/playfab/features/multiplayer/photon/quickstart for more details.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPhotonAuthenticationToken(FClientGetPhotonAuthenticationTokenRequest request,
@@ -973,7 +1211,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetTitlePublicKey, FClientGetTitlePublicKeyResult, result, UObject*, customData);
 
-    /** Returns the title's base 64 encoded RSA CSP blob. */
+    /**
+     * Returns the title's base 64 encoded RSA CSP blob.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetTitlePublicKey(FClientGetTitlePublicKeyRequest request,
             FDelegateOnSuccessGetTitlePublicKey onSuccess,
@@ -989,6 +1231,8 @@ public:
     /**
      * Signs the user in using the Android device identifier, returning a session identifier that can subsequently be used for
      * API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithAndroidDeviceID(FClientLoginWithAndroidDeviceIDRequest request,
@@ -1002,7 +1246,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLoginWithApple, FClientLoginResult, result, UObject*, customData);
 
-    /** Signs in the user with a Sign in with Apple identity token. */
+    /**
+     * Signs in the user with a Sign in with Apple identity token.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithApple(FClientLoginWithAppleRequest request,
             FDelegateOnSuccessLoginWithApple onSuccess,
@@ -1018,6 +1266,8 @@ public:
     /**
      * Signs the user in using a custom unique identifier generated by the title, returning a session identifier that can
      * subsequently be used for API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithCustomID(FClientLoginWithCustomIDRequest request,
@@ -1036,6 +1286,8 @@ public:
      * which require an authenticated user. Unlike most other login API calls, LoginWithEmailAddress does not permit the
      * creation of new accounts via the CreateAccountFlag. Email addresses may be used to create accounts via
      * RegisterPlayFabUser.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithEmailAddress(FClientLoginWithEmailAddressRequest request,
@@ -1052,6 +1304,8 @@ public:
     /**
      * Signs the user in using a Facebook access token, returning a session identifier that can subsequently be used for API
      * calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithFacebook(FClientLoginWithFacebookRequest request,
@@ -1068,6 +1322,8 @@ public:
     /**
      * Signs the user in using a Facebook Instant Games ID, returning a session identifier that can subsequently be used for
      * API calls which require an authenticated user. Requires Facebook Instant Games to be configured.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithFacebookInstantGamesId(FClientLoginWithFacebookInstantGamesIdRequest request,
@@ -1087,6 +1343,8 @@ public:
      * include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters in this request. It is recommended you
      * require these parameters on all Game Center calls by going to the Apple Add-ons page in the PlayFab Game Manager and
      * enabling the 'Require secure authentication only for this app' option.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithGameCenter(FClientLoginWithGameCenterRequest request,
@@ -1100,7 +1358,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLoginWithGoogleAccount, FClientLoginResult, result, UObject*, customData);
 
-    /** Signs the user in using their Google account credentials */
+    /**
+     * Signs the user in using their Google account credentials
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithGoogleAccount(FClientLoginWithGoogleAccountRequest request,
             FDelegateOnSuccessLoginWithGoogleAccount onSuccess,
@@ -1116,6 +1378,8 @@ public:
     /**
      * Signs the user in using the vendor-specific iOS device identifier, returning a session identifier that can subsequently
      * be used for API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithIOSDeviceID(FClientLoginWithIOSDeviceIDRequest request,
@@ -1129,7 +1393,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLoginWithKongregate, FClientLoginResult, result, UObject*, customData);
 
-    /** Signs the user in using a Kongregate player account. */
+    /**
+     * Signs the user in using a Kongregate player account.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithKongregate(FClientLoginWithKongregateRequest request,
             FDelegateOnSuccessLoginWithKongregate onSuccess,
@@ -1142,7 +1410,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLoginWithNintendoServiceAccount, FClientLoginResult, result, UObject*, customData);
 
-    /** Signs in the user with a Nintendo service account token. */
+    /**
+     * Signs in the user with a Nintendo service account token.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithNintendoServiceAccount(FClientLoginWithNintendoServiceAccountRequest request,
             FDelegateOnSuccessLoginWithNintendoServiceAccount onSuccess,
@@ -1158,6 +1430,8 @@ public:
     /**
      * Signs the user in using a Nintendo Switch Device ID, returning a session identifier that can subsequently be used for
      * API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithNintendoSwitchDeviceId(FClientLoginWithNintendoSwitchDeviceIdRequest request,
@@ -1174,6 +1448,8 @@ public:
     /**
      * Logs in a user with an Open ID Connect JWT created by an existing relationship between a title and an Open ID Connect
      * provider.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithOpenIdConnect(FClientLoginWithOpenIdConnectRequest request,
@@ -1192,6 +1468,8 @@ public:
      * which require an authenticated user. Unlike most other login API calls, LoginWithPlayFab does not permit the creation of
      * new accounts via the CreateAccountFlag. Username/Password credentials may be used to create accounts via
      * RegisterPlayFabUser, or added to existing accounts using AddUsernamePassword.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithPlayFab(FClientLoginWithPlayFabRequest request,
@@ -1208,6 +1486,8 @@ public:
     /**
      * Signs the user in using a PlayStation Network authentication code, returning a session identifier that can subsequently
      * be used for API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithPSN(FClientLoginWithPSNRequest request,
@@ -1224,6 +1504,8 @@ public:
     /**
      * Signs the user in using a Steam authentication ticket, returning a session identifier that can subsequently be used for
      * API calls which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithSteam(FClientLoginWithSteamRequest request,
@@ -1237,7 +1519,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessLoginWithTwitch, FClientLoginResult, result, UObject*, customData);
 
-    /** Signs the user in using a Twitch access token. */
+    /**
+     * Signs the user in using a Twitch access token.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithTwitch(FClientLoginWithTwitchRequest request,
             FDelegateOnSuccessLoginWithTwitch onSuccess,
@@ -1253,6 +1539,8 @@ public:
     /**
      * Signs the user in using a Xbox Live Token, returning a session identifier that can subsequently be used for API calls
      * which require an authenticated user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* LoginWithXbox(FClientLoginWithXboxRequest request,
@@ -1269,6 +1557,8 @@ public:
     /**
      * Registers a new Playfab user account, returning a session identifier that can subsequently be used for API calls which
      * require an authenticated user. You must supply either a username or an email address.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RegisterPlayFabUser(FClientRegisterPlayFabUserRequest request,
@@ -1285,6 +1575,8 @@ public:
     /**
      * Sets the player's secret if it is not already set. Player secrets are used to sign API requests. To reset a player's
      * secret use the Admin or Server API method SetPlayerSecret.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* SetPlayerSecret(FClientSetPlayerSecretRequest request,
@@ -1302,7 +1594,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCharacterData, FClientGetCharacterDataResult, result, UObject*, customData);
 
-    /** Retrieves the title-specific custom data for the character which is readable and writable by the client */
+    /**
+     * Retrieves the title-specific custom data for the character which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Character Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCharacterData(FClientGetCharacterDataRequest request,
             FDelegateOnSuccessGetCharacterData onSuccess,
@@ -1315,7 +1611,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCharacterReadOnlyData, FClientGetCharacterDataResult, result, UObject*, customData);
 
-    /** Retrieves the title-specific custom data for the character which can only be read by the client */
+    /**
+     * Retrieves the title-specific custom data for the character which can only be read by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Character Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCharacterReadOnlyData(FClientGetCharacterDataRequest request,
             FDelegateOnSuccessGetCharacterReadOnlyData onSuccess,
@@ -1328,7 +1628,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUpdateCharacterData, FClientUpdateCharacterDataResult, result, UObject*, customData);
 
-    /** Creates and updates the title-specific custom data for the user's character which is readable and writable by the client */
+    /**
+     * Creates and updates the title-specific custom data for the user's character which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Character Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateCharacterData(FClientUpdateCharacterDataRequest request,
             FDelegateOnSuccessUpdateCharacterData onSuccess,
@@ -1348,6 +1652,8 @@ public:
     /**
      * Lists all of the characters that belong to a specific user. CharacterIds are not globally unique; characterId must be
      * evaluated with the parent PlayFabId to guarantee uniqueness.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetAllUsersCharacters(FClientListUsersCharactersRequest request,
@@ -1361,7 +1667,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCharacterLeaderboard, FClientGetCharacterLeaderboardResult, result, UObject*, customData);
 
-    /** Retrieves a list of ranked characters for the given statistic, starting from the indicated point in the leaderboard */
+    /**
+     * Retrieves a list of ranked characters for the given statistic, starting from the indicated point in the leaderboard
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCharacterLeaderboard(FClientGetCharacterLeaderboardRequest request,
             FDelegateOnSuccessGetCharacterLeaderboard onSuccess,
@@ -1374,7 +1684,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCharacterStatistics, FClientGetCharacterStatisticsResult, result, UObject*, customData);
 
-    /** Retrieves the details of all title-specific statistics for the user */
+    /**
+     * Retrieves the details of all title-specific statistics for the user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCharacterStatistics(FClientGetCharacterStatisticsRequest request,
             FDelegateOnSuccessGetCharacterStatistics onSuccess,
@@ -1387,7 +1701,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetLeaderboardAroundCharacter, FClientGetLeaderboardAroundCharacterResult, result, UObject*, customData);
 
-    /** Retrieves a list of ranked characters for the given statistic, centered on the requested Character ID */
+    /**
+     * Retrieves a list of ranked characters for the given statistic, centered on the requested Character ID
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetLeaderboardAroundCharacter(FClientGetLeaderboardAroundCharacterRequest request,
             FDelegateOnSuccessGetLeaderboardAroundCharacter onSuccess,
@@ -1400,7 +1718,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetLeaderboardForUserCharacters, FClientGetLeaderboardForUsersCharactersResult, result, UObject*, customData);
 
-    /** Retrieves a list of all of the user's characters for the given statistic. */
+    /**
+     * Retrieves a list of all of the user's characters for the given statistic.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetLeaderboardForUserCharacters(FClientGetLeaderboardForUsersCharactersRequest request,
             FDelegateOnSuccessGetLeaderboardForUserCharacters onSuccess,
@@ -1416,6 +1738,8 @@ public:
     /**
      * Grants the specified character type to the user. CharacterIds are not globally unique; characterId must be evaluated
      * with the parent PlayFabId to guarantee uniqueness.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GrantCharacterToUser(FClientGrantCharacterToUserRequest request,
@@ -1432,6 +1756,8 @@ public:
     /**
      * Updates the values of the specified title-specific statistics for the specific character. By default, clients are not
      * permitted to update statistics. Developers may override this setting in the Game Manager > Settings > API Features.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateCharacterStatistics(FClientUpdateCharacterStatisticsRequest request,
@@ -1456,6 +1782,8 @@ public:
      * the query to retrieve the data will fail. See this post for more information:
      * https://community.playfab.com/hc/community/posts/205469488-How-to-upload-files-to-PlayFab-s-Content-Service. Also,
      * please be aware that the Content service is specifically PlayFab's CDN offering, for which standard CDN rates apply.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Content ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetContentDownloadUrl(FClientGetContentDownloadUrlRequest request,
@@ -1476,6 +1804,8 @@ public:
     /**
      * Adds the PlayFab user, based upon a match against a supplied unique identifier, to the friend list of the local user. At
      * least one of FriendPlayFabId,FriendUsername,FriendEmail, or FriendTitleDisplayName should be initialized.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddFriend(FClientAddFriendRequest request,
@@ -1492,6 +1822,8 @@ public:
     /**
      * Retrieves the current friend list for the local user, constrained to users who have PlayFab accounts. Friends from
      * linked accounts (Facebook, Steam) are also included. You may optionally exclude some linked services' friends.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetFriendsList(FClientGetFriendsListRequest request,
@@ -1505,7 +1837,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRemoveFriend, FClientRemoveFriendResult, result, UObject*, customData);
 
-    /** Removes a specified user from the friend list of the local user */
+    /**
+     * Removes a specified user from the friend list of the local user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RemoveFriend(FClientRemoveFriendRequest request,
             FDelegateOnSuccessRemoveFriend onSuccess,
@@ -1518,7 +1854,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessSetFriendTags, FClientSetFriendTagsResult, result, UObject*, customData);
 
-    /** Updates the tag list for a specified user in the friend list of the local user */
+    /**
+     * Updates the tag list for a specified user in the friend list of the local user
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* SetFriendTags(FClientSetFriendTagsRequest request,
             FDelegateOnSuccessSetFriendTags onSuccess,
@@ -1535,7 +1875,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCurrentGames, FClientCurrentGamesResult, result, UObject*, customData);
 
-    /** Get details about all current running game servers matching the given parameters. */
+    /**
+     * Get details about all current running game servers matching the given parameters.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCurrentGames(FClientCurrentGamesRequest request,
             FDelegateOnSuccessGetCurrentGames onSuccess,
@@ -1548,7 +1892,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetGameServerRegions, FClientGameServerRegionsResult, result, UObject*, customData);
 
-    /** Get details about the regions hosting game servers matching the given parameters. */
+    /**
+     * Get details about the regions hosting game servers matching the given parameters.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetGameServerRegions(FClientGameServerRegionsRequest request,
             FDelegateOnSuccessGetGameServerRegions onSuccess,
@@ -1568,6 +1916,8 @@ public:
      * found in a server instance matching the parameters, the slot will be assigned to that player, removing it from the
      * availabe set. In that case, the information on the game session will be returned, otherwise the Status returned will be
      * GameNotFound.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* Matchmake(FClientMatchmakeRequest request,
@@ -1585,7 +1935,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessAndroidDevicePushNotificationRegistration, FClientAndroidDevicePushNotificationRegistrationResult, result, UObject*, customData);
 
-    /** Registers the Android device to receive push notifications */
+    /**
+     * Registers the Android device to receive push notifications
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AndroidDevicePushNotificationRegistration(FClientAndroidDevicePushNotificationRegistrationRequest request,
             FDelegateOnSuccessAndroidDevicePushNotificationRegistration onSuccess,
@@ -1598,7 +1952,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessConsumeMicrosoftStoreEntitlements, FClientConsumeMicrosoftStoreEntitlementsResponse, result, UObject*, customData);
 
-    /** Grants the player's current entitlements from Microsoft Store's Collection API */
+    /**
+     * Grants the player's current entitlements from Microsoft Store's Collection API
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConsumeMicrosoftStoreEntitlements(FClientConsumeMicrosoftStoreEntitlementsRequest request,
             FDelegateOnSuccessConsumeMicrosoftStoreEntitlements onSuccess,
@@ -1614,6 +1972,8 @@ public:
     /**
      * Checks for any new PS5 entitlements. If any are found, they are consumed (if they're consumables) and added as PlayFab
      * items
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConsumePS5Entitlements(FClientConsumePS5EntitlementsRequest request,
@@ -1627,7 +1987,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessConsumePSNEntitlements, FClientConsumePSNEntitlementsResult, result, UObject*, customData);
 
-    /** Checks for any new consumable entitlements. If any are found, they are consumed and added as PlayFab items */
+    /**
+     * Checks for any new consumable entitlements. If any are found, they are consumed and added as PlayFab items
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConsumePSNEntitlements(FClientConsumePSNEntitlementsRequest request,
             FDelegateOnSuccessConsumePSNEntitlements onSuccess,
@@ -1643,6 +2007,8 @@ public:
     /**
      * Grants the player's current entitlements from Xbox Live, consuming all availble items in Xbox and granting them to the
      * player's PlayFab inventory. This call is idempotent and will not grant previously granted items to the player.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConsumeXboxEntitlements(FClientConsumeXboxEntitlementsRequest request,
@@ -1656,7 +2022,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRefreshPSNAuthToken, FClientEmptyResponse, result, UObject*, customData);
 
-    /** Uses the supplied OAuth code to refresh the internally cached player PSN auth token */
+    /**
+     * Uses the supplied OAuth code to refresh the internally cached player PSN auth token
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RefreshPSNAuthToken(FClientRefreshPSNAuthTokenRequest request,
             FDelegateOnSuccessRefreshPSNAuthToken onSuccess,
@@ -1669,7 +2039,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRegisterForIOSPushNotification, FClientRegisterForIOSPushNotificationResult, result, UObject*, customData);
 
-    /** Registers the iOS device to receive push notifications */
+    /**
+     * Registers the iOS device to receive push notifications
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RegisterForIOSPushNotification(FClientRegisterForIOSPushNotificationRequest request,
             FDelegateOnSuccessRegisterForIOSPushNotification onSuccess,
@@ -1682,7 +2056,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessRestoreIOSPurchases, FClientRestoreIOSPurchasesResult, result, UObject*, customData);
 
-    /** Restores all in-app purchases based on the given restore receipt */
+    /**
+     * Restores all in-app purchases based on the given restore receipt
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RestoreIOSPurchases(FClientRestoreIOSPurchasesRequest request,
             FDelegateOnSuccessRestoreIOSPurchases onSuccess,
@@ -1698,6 +2076,8 @@ public:
     /**
      * Validates with Amazon that the receipt for an Amazon App Store in-app purchase is valid and that it matches the
      * purchased catalog item
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ValidateAmazonIAPReceipt(FClientValidateAmazonReceiptRequest request,
@@ -1711,7 +2091,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessValidateGooglePlayPurchase, FClientValidateGooglePlayPurchaseResult, result, UObject*, customData);
 
-    /** Validates a Google Play purchase and gives the corresponding item to the player. */
+    /**
+     * Validates a Google Play purchase and gives the corresponding item to the player.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ValidateGooglePlayPurchase(FClientValidateGooglePlayPurchaseRequest request,
             FDelegateOnSuccessValidateGooglePlayPurchase onSuccess,
@@ -1727,6 +2111,8 @@ public:
     /**
      * Validates with the Apple store that the receipt for an iOS in-app purchase is valid and that it matches the purchased
      * catalog item
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ValidateIOSReceipt(FClientValidateIOSReceiptRequest request,
@@ -1743,6 +2129,8 @@ public:
     /**
      * Validates with Windows that the receipt for an Windows App Store in-app purchase is valid and that it matches the
      * purchased catalog item
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ValidateWindowsStoreReceipt(FClientValidateWindowsReceiptRequest request,
@@ -1763,6 +2151,8 @@ public:
     /**
      * Retrieves a list of ranked friends of the current player for the given statistic, starting from the indicated point in
      * the leaderboard
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetFriendLeaderboard(FClientGetFriendLeaderboardRequest request,
@@ -1779,6 +2169,8 @@ public:
     /**
      * Retrieves a list of ranked friends of the current player for the given statistic, centered on the requested PlayFab
      * user. If PlayFabId is empty or null will return currently logged in user.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetFriendLeaderboardAroundPlayer(FClientGetFriendLeaderboardAroundPlayerRequest request,
@@ -1792,7 +2184,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetLeaderboard, FClientGetLeaderboardResult, result, UObject*, customData);
 
-    /** Retrieves a list of ranked users for the given statistic, starting from the indicated point in the leaderboard */
+    /**
+     * Retrieves a list of ranked users for the given statistic, starting from the indicated point in the leaderboard
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetLeaderboard(FClientGetLeaderboardRequest request,
             FDelegateOnSuccessGetLeaderboard onSuccess,
@@ -1808,6 +2204,8 @@ public:
     /**
      * Retrieves a list of ranked users for the given statistic, centered on the requested player. If PlayFabId is empty or
      * null will return currently logged in user.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetLeaderboardAroundPlayer(FClientGetLeaderboardAroundPlayerRequest request,
@@ -1824,6 +2222,8 @@ public:
     /**
      * Retrieves the indicated statistics (current version and values for all statistics, if none are specified), for the local
      * player.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerStatistics(FClientGetPlayerStatisticsRequest request,
@@ -1837,7 +2237,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerStatisticVersions, FClientGetPlayerStatisticVersionsResult, result, UObject*, customData);
 
-    /** Retrieves the information on the available versions of the specified statistic. */
+    /**
+     * Retrieves the information on the available versions of the specified statistic.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerStatisticVersions(FClientGetPlayerStatisticVersionsRequest request,
             FDelegateOnSuccessGetPlayerStatisticVersions onSuccess,
@@ -1850,7 +2254,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetUserData, FClientGetUserDataResult, result, UObject*, customData);
 
-    /** Retrieves the title-specific custom data for the user which is readable and writable by the client */
+    /**
+     * Retrieves the title-specific custom data for the user which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetUserData(FClientGetUserDataRequest request,
             FDelegateOnSuccessGetUserData onSuccess,
@@ -1863,7 +2271,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetUserPublisherData, FClientGetUserDataResult, result, UObject*, customData);
 
-    /** Retrieves the publisher-specific custom data for the user which is readable and writable by the client */
+    /**
+     * Retrieves the publisher-specific custom data for the user which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetUserPublisherData(FClientGetUserDataRequest request,
             FDelegateOnSuccessGetUserPublisherData onSuccess,
@@ -1876,7 +2288,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetUserPublisherReadOnlyData, FClientGetUserDataResult, result, UObject*, customData);
 
-    /** Retrieves the publisher-specific custom data for the user which can only be read by the client */
+    /**
+     * Retrieves the publisher-specific custom data for the user which can only be read by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetUserPublisherReadOnlyData(FClientGetUserDataRequest request,
             FDelegateOnSuccessGetUserPublisherReadOnlyData onSuccess,
@@ -1889,7 +2305,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetUserReadOnlyData, FClientGetUserDataResult, result, UObject*, customData);
 
-    /** Retrieves the title-specific custom data for the user which can only be read by the client */
+    /**
+     * Retrieves the title-specific custom data for the user which can only be read by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetUserReadOnlyData(FClientGetUserDataRequest request,
             FDelegateOnSuccessGetUserReadOnlyData onSuccess,
@@ -1905,6 +2325,8 @@ public:
     /**
      * Updates the values of the specified title-specific statistics for the user. By default, clients are not permitted to
      * update statistics. Developers may override this setting in the Game Manager > Settings > API Features.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdatePlayerStatistics(FClientUpdatePlayerStatisticsRequest request,
@@ -1918,7 +2340,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUpdateUserData, FClientUpdateUserDataResult, result, UObject*, customData);
 
-    /** Creates and updates the title-specific custom data for the user which is readable and writable by the client */
+    /**
+     * Creates and updates the title-specific custom data for the user which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateUserData(FClientUpdateUserDataRequest request,
             FDelegateOnSuccessUpdateUserData onSuccess,
@@ -1931,7 +2357,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessUpdateUserPublisherData, FClientUpdateUserDataResult, result, UObject*, customData);
 
-    /** Creates and updates the publisher-specific custom data for the user which is readable and writable by the client */
+    /**
+     * Creates and updates the publisher-specific custom data for the user which is readable and writable by the client
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateUserPublisherData(FClientUpdateUserDataRequest request,
             FDelegateOnSuccessUpdateUserPublisherData onSuccess,
@@ -1948,7 +2378,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessAddUserVirtualCurrency, FClientModifyUserVirtualCurrencyResult, result, UObject*, customData);
 
-    /** Increments the user's balance of the specified virtual currency by the stated amount */
+    /**
+     * Increments the user's balance of the specified virtual currency by the stated amount
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddUserVirtualCurrency(FClientAddUserVirtualCurrencyRequest request,
             FDelegateOnSuccessAddUserVirtualCurrency onSuccess,
@@ -1964,6 +2398,8 @@ public:
     /**
      * Confirms with the payment provider that the purchase was approved (if applicable) and adjusts inventory and virtual
      * currency balances as appropriate
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConfirmPurchase(FClientConfirmPurchaseRequest request,
@@ -1977,7 +2413,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessConsumeItem, FClientConsumeItemResult, result, UObject*, customData);
 
-    /** Consume uses of a consumable item. When all uses are consumed, it will be removed from the player's inventory. */
+    /**
+     * Consume uses of a consumable item. When all uses are consumed, it will be removed from the player's inventory.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ConsumeItem(FClientConsumeItemRequest request,
             FDelegateOnSuccessConsumeItem onSuccess,
@@ -1990,7 +2430,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCharacterInventory, FClientGetCharacterInventoryResult, result, UObject*, customData);
 
-    /** Retrieves the specified character's current inventory of virtual goods */
+    /**
+     * Retrieves the specified character's current inventory of virtual goods
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCharacterInventory(FClientGetCharacterInventoryRequest request,
             FDelegateOnSuccessGetCharacterInventory onSuccess,
@@ -2007,6 +2451,8 @@ public:
      * For payments flows where the provider requires playfab (the fulfiller) to initiate the transaction, but the client
      * completes the rest of the flow. In the Xsolla case, the token returned here will be passed to Xsolla by the client to
      * create a cart. Poll GetPurchase using the returned OrderId once you've completed the payment.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPaymentToken(FClientGetPaymentTokenRequest request,
@@ -2023,6 +2469,8 @@ public:
     /**
      * Retrieves a purchase along with its current PlayFab status. Returns inventory items from the purchase that are still
      * active.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPurchase(FClientGetPurchaseRequest request,
@@ -2036,7 +2484,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetUserInventory, FClientGetUserInventoryResult, result, UObject*, customData);
 
-    /** Retrieves the user's current inventory of virtual goods */
+    /**
+     * Retrieves the user's current inventory of virtual goods
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetUserInventory(FClientGetUserInventoryRequest request,
             FDelegateOnSuccessGetUserInventory onSuccess,
@@ -2049,7 +2501,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessPayForPurchase, FClientPayForPurchaseResult, result, UObject*, customData);
 
-    /** Selects a payment option for purchase order created via StartPurchase */
+    /**
+     * Selects a payment option for purchase order created via StartPurchase
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* PayForPurchase(FClientPayForPurchaseRequest request,
             FDelegateOnSuccessPayForPurchase onSuccess,
@@ -2065,6 +2521,8 @@ public:
     /**
      * Buys a single item with virtual currency. You must specify both the virtual currency to use to purchase, as well as what
      * the client believes the price to be. This lets the server fail the purchase if the price has changed.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* PurchaseItem(FClientPurchaseItemRequest request,
@@ -2081,6 +2539,8 @@ public:
     /**
      * Adds the virtual goods associated with the coupon to the user's inventory. Coupons can be generated via the
      * Economy->Catalogs tab in the PlayFab Game Manager.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RedeemCoupon(FClientRedeemCouponRequest request,
@@ -2094,7 +2554,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessStartPurchase, FClientStartPurchaseResult, result, UObject*, customData);
 
-    /** Creates an order for a list of items from the title catalog */
+    /**
+     * Creates an order for a list of items from the title catalog
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* StartPurchase(FClientStartPurchaseRequest request,
             FDelegateOnSuccessStartPurchase onSuccess,
@@ -2110,6 +2574,8 @@ public:
     /**
      * Decrements the user's balance of the specified virtual currency by the stated amount. It is possible to make a VC
      * balance negative with this API.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* SubtractUserVirtualCurrency(FClientSubtractUserVirtualCurrencyRequest request,
@@ -2127,6 +2593,8 @@ public:
      * Opens the specified container, with the specified key (when required), and returns the contents of the opened container.
      * If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented,
      * consistent with the operation of ConsumeItem.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlockContainerInstance(FClientUnlockContainerInstanceRequest request,
@@ -2144,6 +2612,8 @@ public:
      * Searches target inventory for an ItemInstance matching the given CatalogItemId, if necessary unlocks it using an
      * appropriate key, and returns the contents of the opened container. If the container (and key when relevant) are
      * consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UnlockContainerItem(FClientUnlockContainerItemRequest request,
@@ -2161,7 +2631,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerSegments, FClientGetPlayerSegmentsResult, result, UObject*, customData);
 
-    /** List all segments that a player currently belongs to at this moment in time. */
+    /**
+     * List all segments that a player currently belongs to at this moment in time.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | PlayStream ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerSegments(FClientGetPlayerSegmentsRequest request,
             FDelegateOnSuccessGetPlayerSegments onSuccess,
@@ -2174,7 +2648,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerTags, FClientGetPlayerTagsResult, result, UObject*, customData);
 
-    /** Get all tags with a given Namespace (optional) from a player profile. */
+    /**
+     * Get all tags with a given Namespace (optional) from a player profile.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | PlayStream ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerTags(FClientGetPlayerTagsRequest request,
             FDelegateOnSuccessGetPlayerTags onSuccess,
@@ -2194,6 +2672,8 @@ public:
     /**
      * Executes a CloudScript function, with the 'currentPlayerId' set to the PlayFab ID of the authenticated player. The
      * PlayFab ID is the entity ID of the player's master_player_account entity.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Server-Side Cloud Script ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* ExecuteCloudScript(FClientExecuteCloudScriptRequest request,
@@ -2215,6 +2695,8 @@ public:
      * Adds users to the set of those able to update both the shared data, as well as the set of users in the group. Only users
      * in the group can add new members. Shared Groups are designed for sharing data between a very small number of players,
      * please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AddSharedGroupMembers(FClientAddSharedGroupMembersRequest request,
@@ -2233,6 +2715,8 @@ public:
      * group. Upon creation, the current user will be the only member of the group. Shared Groups are designed for sharing data
      * between a very small number of players, please see our guide:
      * https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* CreateSharedGroup(FClientCreateSharedGroupRequest request,
@@ -2251,6 +2735,8 @@ public:
      * may use this to retrieve group data, including membership, but they will not receive data for keys marked as private.
      * Shared Groups are designed for sharing data between a very small number of players, please see our guide:
      * https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetSharedGroupData(FClientGetSharedGroupDataRequest request,
@@ -2269,6 +2755,8 @@ public:
      * group can remove members. If as a result of the call, zero users remain with access, the group and its associated data
      * will be deleted. Shared Groups are designed for sharing data between a very small number of players, please see our
      * guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* RemoveSharedGroupMembers(FClientRemoveSharedGroupMembersRequest request,
@@ -2288,6 +2776,8 @@ public:
      * Regardless of the permission setting, only members of the group can update the data. Shared Groups are designed for
      * sharing data between a very small number of players, please see our guide:
      * https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* UpdateSharedGroupData(FClientUpdateSharedGroupDataRequest request,
@@ -2305,7 +2795,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetCatalogItems, FClientGetCatalogItemsResult, result, UObject*, customData);
 
-    /** Retrieves the specified version of the title's catalog of virtual goods, including all defined properties */
+    /**
+     * Retrieves the specified version of the title's catalog of virtual goods, including all defined properties
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetCatalogItems(FClientGetCatalogItemsRequest request,
             FDelegateOnSuccessGetCatalogItems onSuccess,
@@ -2318,7 +2812,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPublisherData, FClientGetPublisherDataResult, result, UObject*, customData);
 
-    /** Retrieves the key-value store of custom publisher settings */
+    /**
+     * Retrieves the key-value store of custom publisher settings
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPublisherData(FClientGetPublisherDataRequest request,
             FDelegateOnSuccessGetPublisherData onSuccess,
@@ -2331,7 +2829,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetStoreItems, FClientGetStoreItemsResult, result, UObject*, customData);
 
-    /** Retrieves the set of items defined for the specified store, including all prices defined */
+    /**
+     * Retrieves the set of items defined for the specified store, including all prices defined
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetStoreItems(FClientGetStoreItemsRequest request,
             FDelegateOnSuccessGetStoreItems onSuccess,
@@ -2344,7 +2846,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetTime, FClientGetTimeResult, result, UObject*, customData);
 
-    /** Retrieves the current server time */
+    /**
+     * Retrieves the current server time
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetTime(FClientGetTimeRequest request,
             FDelegateOnSuccessGetTime onSuccess,
@@ -2357,7 +2863,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetTitleData, FClientGetTitleDataResult, result, UObject*, customData);
 
-    /** Retrieves the key-value store of custom title settings */
+    /**
+     * Retrieves the key-value store of custom title settings
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetTitleData(FClientGetTitleDataRequest request,
             FDelegateOnSuccessGetTitleData onSuccess,
@@ -2370,7 +2880,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetTitleNews, FClientGetTitleNewsResult, result, UObject*, customData);
 
-    /** Retrieves the title news feed, as configured in the developer portal */
+    /**
+     * Retrieves the title news feed, as configured in the developer portal
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetTitleNews(FClientGetTitleNewsRequest request,
             FDelegateOnSuccessGetTitleNews onSuccess,
@@ -2391,6 +2905,8 @@ public:
      * Accepts an open trade (one that has not yet been accepted or cancelled), if the locally signed-in player is in the
      * allowed player list for the trade, or it is open to all players. If the call is successful, the offered and accepted
      * items will be swapped between the two players' inventories.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* AcceptTrade(FClientAcceptTradeRequest request,
@@ -2408,6 +2924,8 @@ public:
      * Cancels an open trade (one that has not yet been accepted or cancelled). Note that only the player who created the trade
      * can cancel it via this API call, to prevent griefing of the trade system (cancelling trades in order to prevent other
      * players from accepting them, for trades that can be claimed by more than one player).
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
      */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* CancelTrade(FClientCancelTradeRequest request,
@@ -2421,7 +2939,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetPlayerTrades, FClientGetPlayerTradesResponse, result, UObject*, customData);
 
-    /** Gets all trades the player has either opened or accepted, optionally filtered by trade status. */
+    /**
+     * Gets all trades the player has either opened or accepted, optionally filtered by trade status.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetPlayerTrades(FClientGetPlayerTradesRequest request,
             FDelegateOnSuccessGetPlayerTrades onSuccess,
@@ -2434,7 +2956,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessGetTradeStatus, FClientGetTradeStatusResponse, result, UObject*, customData);
 
-    /** Gets the current status of an existing trade. */
+    /**
+     * Gets the current status of an existing trade.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* GetTradeStatus(FClientGetTradeStatusRequest request,
             FDelegateOnSuccessGetTradeStatus onSuccess,
@@ -2447,7 +2973,11 @@ public:
     // callbacks
     DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateOnSuccessOpenTrade, FClientOpenTradeResponse, result, UObject*, customData);
 
-    /** Opens a new outstanding trade. Note that a given item instance may only be in one open trade at a time. */
+    /**
+     * Opens a new outstanding trade. Note that a given item instance may only be in one open trade at a time.
+     *
+     * The proxy is pooled, so it and the response's responseData are only valid until this call's callbacks have returned.
+     */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading ", meta = (BlueprintInternalUseOnly = "true"))
         static UPlayFabClientAPI* OpenTrade(FClientOpenTradeRequest request,
             FDelegateOnSuccessOpenTrade onSuccess,
@@ -2645,6 +3175,9 @@ private:
     /** Internal bind function for the IHTTPRequest::OnProcessRequestCompleted() event */
     void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
+    /** Clear the finished call and return the proxy to the pool */
+    void ReleaseToPool();
+
 protected:
     /** Internal request data stored as JSON */
     UPROPERTY()
@@ -35,6 +35,9 @@ class PLAYFAB_API UPlayFabJsonObject : public UObject
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Json")
         void Reset();
 
+    /** Remove all fields, keeping the root object's storage for the next fields unless the root is shared */
+    void ClearFields();
+
     /** Get the root Json object */
     TSharedPtr<FJsonObject>& GetRootObject();
 
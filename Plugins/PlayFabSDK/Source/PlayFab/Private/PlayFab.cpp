@@ -12,6 +12,7 @@
 #include "PlayFabPrivate.h"
 #include "PlayFabJsonValue.h"
 #include "PlayFabJsonObject.h"
+#include "HAL/IConsoleManager.h"
 
 
 #include "PlayFabAdminAPI.h" 
@@ -67,3 +68,22 @@ IMPLEMENT_MODULE(FPlayFab, PlayFab)
 
 DEFINE_LOG_CATEGORY(LogPlayFab);
 DEFINE_LOG_CATEGORY(LogPlayFabTests);
+DEFINE_LOG_CATEGORY(LogPlayFabBody);
+
+static TAutoConsoleVariable<int32> CVarPlayFabLogBodyMaxChars(
+    TEXT("PlayFab.LogBodyMaxChars"),
+    1024,
+    TEXT("Request and response bodies logged to LogPlayFabBody are cut to this many characters, 0 logs them whole."));
+
+void PlayFabLogBodyTruncated(const TCHAR* Label, const FString& Body)
+{
+    const int32 MaxChars = CVarPlayFabLogBodyMaxChars.GetValueOnAnyThread();
+    if (MaxChars <= 0 || Body.Len() <= MaxChars)
+    {
+        UE_LOG(LogPlayFabBody, Verbose, TEXT("%s: %s"), Label, *Body);
+    }
+    else
+    {
+        UE_LOG(LogPlayFabBody, Verbose, TEXT("%s: %s... (%d of %d characters)"), Label, *Body.Left(MaxChars), MaxChars, Body.Len());
+    }
+}
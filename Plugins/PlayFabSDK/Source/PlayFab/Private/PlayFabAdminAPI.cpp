@@ -6741,7 +6741,7 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabLogBody(TEXT("Response"), ResponseContent);
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -6823,7 +6823,7 @@ void UPlayFabAdminAPI::Activate()
     // Set Json content
     HttpRequest->SetContentAsString(OutputString);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabLogBody(TEXT("Request"), OutputString);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabAdminAPI::OnProcessRequestComplete);
@@ -238,7 +238,7 @@ void UPlayFabAuthenticationAPI::OnProcessRequestComplete(FHttpRequestPtr Request
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabLogBody(TEXT("Response"), ResponseContent);
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -320,7 +320,7 @@ void UPlayFabAuthenticationAPI::Activate()
     // Set Json content
     HttpRequest->SetContentAsString(OutputString);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabLogBody(TEXT("Request"), OutputString);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabAuthenticationAPI::OnProcessRequestComplete);
@@ -17,12 +17,228 @@
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
 
+namespace
+{
+    // Finished proxies, still rooted. Only touched on the game thread, where the calls are made and completed
+    TArray<UPlayFabClientAPI*> ProxyPool;
+    const int32 MaxPooledProxies = 32;
+}
+
 UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , CallAuthenticationContext(nullptr)
 {
 }
 
+UPlayFabClientAPI* UPlayFabClientAPI::AcquireProxy()
+{
+    check(IsInGameThread());
+    if (ProxyPool.Num() > 0)
+    {
+        return ProxyPool.Pop(false);
+    }
+
+    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
+    if (manager->IsSafeForRootSet()) manager->AddToRoot();
+    return manager;
+}
+
+UPlayFabJsonObject* UPlayFabClientAPI::AcquireRequestObject()
+{
+    if (RequestJsonObj != nullptr)
+        RequestJsonObj->ClearFields();
+    else
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    return RequestJsonObj;
+}
+
+void UPlayFabClientAPI::ReleaseToPool()
+{
+    // Drop every delegate so a pooled proxy doesn't keep the previous caller's objects alive or call them again
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccessAddGenericID.Unbind();
+    OnSuccessAddOrUpdateContactEmail.Unbind();
+    OnSuccessAddUsernamePassword.Unbind();
+    OnSuccessGetAccountInfo.Unbind();
+    OnSuccessGetPlayerCombinedInfo.Unbind();
+    OnSuccessGetPlayerProfile.Unbind();
+    OnSuccessGetPlayFabIDsFromFacebookIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Unbind();
+    OnSuccessGetPlayFabIDsFromGameCenterIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromGenericIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromGoogleIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromKongregateIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromNintendoServiceAccountIds.Unbind();
+    OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Unbind();
+    OnSuccessGetPlayFabIDsFromPSNAccountIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromSteamIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromTwitchIDs.Unbind();
+    OnSuccessGetPlayFabIDsFromXboxLiveIDs.Unbind();
+    OnSuccessLinkAndroidDeviceID.Unbind();
+    OnSuccessLinkApple.Unbind();
+    OnSuccessLinkCustomID.Unbind();
+    OnSuccessLinkFacebookAccount.Unbind();
+    OnSuccessLinkFacebookInstantGamesId.Unbind();
+    OnSuccessLinkGameCenterAccount.Unbind();
+    OnSuccessLinkGoogleAccount.Unbind();
+    OnSuccessLinkIOSDeviceID.Unbind();
+    OnSuccessLinkKongregate.Unbind();
+    OnSuccessLinkNintendoServiceAccount.Unbind();
+    OnSuccessLinkNintendoSwitchDeviceId.Unbind();
+    OnSuccessLinkOpenIdConnect.Unbind();
+    OnSuccessLinkPSNAccount.Unbind();
+    OnSuccessLinkSteamAccount.Unbind();
+    OnSuccessLinkTwitch.Unbind();
+    OnSuccessLinkXboxAccount.Unbind();
+    OnSuccessRemoveContactEmail.Unbind();
+    OnSuccessRemoveGenericID.Unbind();
+    OnSuccessReportPlayer.Unbind();
+    OnSuccessSendAccountRecoveryEmail.Unbind();
+    OnSuccessUnlinkAndroidDeviceID.Unbind();
+    OnSuccessUnlinkApple.Unbind();
+    OnSuccessUnlinkCustomID.Unbind();
+    OnSuccessUnlinkFacebookAccount.Unbind();
+    OnSuccessUnlinkFacebookInstantGamesId.Unbind();
+    OnSuccessUnlinkGameCenterAccount.Unbind();
+    OnSuccessUnlinkGoogleAccount.Unbind();
+    OnSuccessUnlinkIOSDeviceID.Unbind();
+    OnSuccessUnlinkKongregate.Unbind();
+    OnSuccessUnlinkNintendoServiceAccount.Unbind();
+    OnSuccessUnlinkNintendoSwitchDeviceId.Unbind();
+    OnSuccessUnlinkOpenIdConnect.Unbind();
+    OnSuccessUnlinkPSNAccount.Unbind();
+    OnSuccessUnlinkSteamAccount.Unbind();
+    OnSuccessUnlinkTwitch.Unbind();
+    OnSuccessUnlinkXboxAccount.Unbind();
+    OnSuccessUpdateAvatarUrl.Unbind();
+    OnSuccessUpdateUserTitleDisplayName.Unbind();
+    OnSuccessAttributeInstall.Unbind();
+    OnSuccessGetAdPlacements.Unbind();
+    OnSuccessReportAdActivity.Unbind();
+    OnSuccessRewardAdActivity.Unbind();
+    OnSuccessReportDeviceInfo.Unbind();
+    OnSuccessWriteCharacterEvent.Unbind();
+    OnSuccessWritePlayerEvent.Unbind();
+    OnSuccessWriteTitleEvent.Unbind();
+    OnSuccessGetPhotonAuthenticationToken.Unbind();
+    OnSuccessGetTitlePublicKey.Unbind();
+    OnSuccessLoginWithAndroidDeviceID.Unbind();
+    OnSuccessLoginWithApple.Unbind();
+    OnSuccessLoginWithCustomID.Unbind();
+    OnSuccessLoginWithEmailAddress.Unbind();
+    OnSuccessLoginWithFacebook.Unbind();
+    OnSuccessLoginWithFacebookInstantGamesId.Unbind();
+    OnSuccessLoginWithGameCenter.Unbind();
+    OnSuccessLoginWithGoogleAccount.Unbind();
+    OnSuccessLoginWithIOSDeviceID.Unbind();
+    OnSuccessLoginWithKongregate.Unbind();
+    OnSuccessLoginWithNintendoServiceAccount.Unbind();
+    OnSuccessLoginWithNintendoSwitchDeviceId.Unbind();
+    OnSuccessLoginWithOpenIdConnect.Unbind();
+    OnSuccessLoginWithPlayFab.Unbind();
+    OnSuccessLoginWithPSN.Unbind();
+    OnSuccessLoginWithSteam.Unbind();
+    OnSuccessLoginWithTwitch.Unbind();
+    OnSuccessLoginWithXbox.Unbind();
+    OnSuccessRegisterPlayFabUser.Unbind();
+    OnSuccessSetPlayerSecret.Unbind();
+    OnSuccessGetCharacterData.Unbind();
+    OnSuccessGetCharacterReadOnlyData.Unbind();
+    OnSuccessUpdateCharacterData.Unbind();
+    OnSuccessGetAllUsersCharacters.Unbind();
+    OnSuccessGetCharacterLeaderboard.Unbind();
+    OnSuccessGetCharacterStatistics.Unbind();
+    OnSuccessGetLeaderboardAroundCharacter.Unbind();
+    OnSuccessGetLeaderboardForUserCharacters.Unbind();
+    OnSuccessGrantCharacterToUser.Unbind();
+    OnSuccessUpdateCharacterStatistics.Unbind();
+    OnSuccessGetContentDownloadUrl.Unbind();
+    OnSuccessAddFriend.Unbind();
+    OnSuccessGetFriendsList.Unbind();
+    OnSuccessRemoveFriend.Unbind();
+    OnSuccessSetFriendTags.Unbind();
+    OnSuccessGetCurrentGames.Unbind();
+    OnSuccessGetGameServerRegions.Unbind();
+    OnSuccessMatchmake.Unbind();
+    OnSuccessAndroidDevicePushNotificationRegistration.Unbind();
+    OnSuccessConsumeMicrosoftStoreEntitlements.Unbind();
+    OnSuccessConsumePS5Entitlements.Unbind();
+    OnSuccessConsumePSNEntitlements.Unbind();
+    OnSuccessConsumeXboxEntitlements.Unbind();
+    OnSuccessRefreshPSNAuthToken.Unbind();
+    OnSuccessRegisterForIOSPushNotification.Unbind();
+    OnSuccessRestoreIOSPurchases.Unbind();
+    OnSuccessValidateAmazonIAPReceipt.Unbind();
+    OnSuccessValidateGooglePlayPurchase.Unbind();
+    OnSuccessValidateIOSReceipt.Unbind();
+    OnSuccessValidateWindowsStoreReceipt.Unbind();
+    OnSuccessGetFriendLeaderboard.Unbind();
+    OnSuccessGetFriendLeaderboardAroundPlayer.Unbind();
+    OnSuccessGetLeaderboard.Unbind();
+    OnSuccessGetLeaderboardAroundPlayer.Unbind();
+    OnSuccessGetPlayerStatistics.Unbind();
+    OnSuccessGetPlayerStatisticVersions.Unbind();
+    OnSuccessGetUserData.Unbind();
+    OnSuccessGetUserPublisherData.Unbind();
+    OnSuccessGetUserPublisherReadOnlyData.Unbind();
+    OnSuccessGetUserReadOnlyData.Unbind();
+    OnSuccessUpdatePlayerStatistics.Unbind();
+    OnSuccessUpdateUserData.Unbind();
+    OnSuccessUpdateUserPublisherData.Unbind();
+    OnSuccessAddUserVirtualCurrency.Unbind();
+    OnSuccessConfirmPurchase.Unbind();
+    OnSuccessConsumeItem.Unbind();
+    OnSuccessGetCharacterInventory.Unbind();
+    OnSuccessGetPaymentToken.Unbind();
+    OnSuccessGetPurchase.Unbind();
+    OnSuccessGetUserInventory.Unbind();
+    OnSuccessPayForPurchase.Unbind();
+    OnSuccessPurchaseItem.Unbind();
+    OnSuccessRedeemCoupon.Unbind();
+    OnSuccessStartPurchase.Unbind();
+    OnSuccessSubtractUserVirtualCurrency.Unbind();
+    OnSuccessUnlockContainerInstance.Unbind();
+    OnSuccessUnlockContainerItem.Unbind();
+    OnSuccessGetPlayerSegments.Unbind();
+    OnSuccessGetPlayerTags.Unbind();
+    OnSuccessExecuteCloudScript.Unbind();
+    OnSuccessAddSharedGroupMembers.Unbind();
+    OnSuccessCreateSharedGroup.Unbind();
+    OnSuccessGetSharedGroupData.Unbind();
+    OnSuccessRemoveSharedGroupMembers.Unbind();
+    OnSuccessUpdateSharedGroupData.Unbind();
+    OnSuccessGetCatalogItems.Unbind();
+    OnSuccessGetPublisherData.Unbind();
+    OnSuccessGetStoreItems.Unbind();
+    OnSuccessGetTime.Unbind();
+    OnSuccessGetTitleData.Unbind();
+    OnSuccessGetTitleNews.Unbind();
+    OnSuccessAcceptTrade.Unbind();
+    OnSuccessCancelTrade.Unbind();
+    OnSuccessGetPlayerTrades.Unbind();
+    OnSuccessGetTradeStatus.Unbind();
+    OnSuccessOpenTrade.Unbind();
+    CallAuthenticationContext = nullptr;
+    mCustomData = nullptr;
+    RequestHeaders.Reset();
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    if (RequestJsonObj != nullptr)
+        RequestJsonObj->ClearFields();
+    ResetResponseData();
+    ResponseContent.Reset();
+
+    if (IsRooted() && ProxyPool.Num() < MaxPooledProxies)
+        ProxyPool.Push(this);
+    else
+        RemoveFromRoot();
+}
+
 void UPlayFabClientAPI::SetCallAuthenticationContext(UPlayFabAuthenticationContext* InAuthenticationContext)
 {
     CallAuthenticationContext = InAuthenticationContext;
@@ -82,9 +298,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -120,7 +335,6 @@ void UPlayFabClientAPI::HelperAddGenericID(FPlayFabBaseModel response, UObject*
         FClientAddGenericIDResult ResultStruct = UPlayFabClientModelDecoder::decodeAddGenericIDResultResponse(response.responseData);
         OnSuccessAddGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Adds or updates a contact email to the player's profile. */
@@ -130,9 +344,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddOrUpdateContactEmail(FClientAddOrUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -173,7 +386,6 @@ void UPlayFabClientAPI::HelperAddOrUpdateContactEmail(FPlayFabBaseModel response
         FClientAddOrUpdateContactEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeAddOrUpdateContactEmailResultResponse(response.responseData);
         OnSuccessAddOrUpdateContactEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Adds playfab username/password auth to an existing account created via an anonymous auth method, e.g. automatic device ID login. */
@@ -183,9 +395,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -236,7 +447,6 @@ void UPlayFabClientAPI::HelperAddUsernamePassword(FPlayFabBaseModel response, UO
         FClientAddUsernamePasswordResult ResultStruct = UPlayFabClientModelDecoder::decodeAddUsernamePasswordResultResponse(response.responseData);
         OnSuccessAddUsernamePassword.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the user's PlayFab account details */
@@ -246,9 +456,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -303,7 +512,6 @@ void UPlayFabClientAPI::HelperGetAccountInfo(FPlayFabBaseModel response, UObject
         FClientGetAccountInfoResult ResultStruct = UPlayFabClientModelDecoder::decodeGetAccountInfoResultResponse(response.responseData);
         OnSuccessGetAccountInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves all of the user's different kinds of info. */
@@ -313,9 +521,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -357,7 +564,6 @@ void UPlayFabClientAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
         FClientGetPlayerCombinedInfoResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
         OnSuccessGetPlayerCombinedInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the player's profile */
@@ -367,9 +573,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -411,7 +616,6 @@ void UPlayFabClientAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
         FClientGetPlayerProfileResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
         OnSuccessGetPlayerProfile.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook identifiers. */
@@ -421,9 +625,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -466,7 +669,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
         FClientGetPlayFabIDsFromFacebookIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook Instant Game identifiers. */
@@ -476,9 +678,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -521,7 +722,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookInstantGamesIds(FPlayFabB
         FClientGetPlayFabIDsFromFacebookInstantGamesIdsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookInstantGamesIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Game Center identifiers (referenced in the Game Center Programming Guide as the Player Identifier). */
@@ -531,9 +731,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -576,7 +775,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromGameCenterIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGameCenterIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGameCenterIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of generic service identifiers. A generic identifier is the service name plus the service-specific ID for the player, as specified by the title when the generic identifier was added to the player account. */
@@ -586,9 +784,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -628,7 +825,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs(FPlayFabBaseModel resp
         FClientGetPlayFabIDsFromGenericIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGenericIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Google identifiers. The Google identifiers are the IDs for the user accounts, available as "id" in the Google+ People API calls. */
@@ -638,9 +834,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -683,7 +878,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs(FPlayFabBaseModel respo
         FClientGetPlayFabIDsFromGoogleIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGoogleIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGoogleIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Kongregate identifiers. The Kongregate identifiers are the IDs for the user accounts, available as "user_id" from the Kongregate API methods(ex: http://developers.kongregate.com/docs/client/getUserId). */
@@ -693,9 +887,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -738,7 +931,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromKongregateIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromKongregateIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromKongregateIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Service Account identifiers. */
@@ -748,9 +940,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromNintendoServiceAccountIds
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -793,7 +984,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromNintendoServiceAccountIds(FPlayFa
         FClientGetPlayFabIDsFromNintendoServiceAccountIdsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromNintendoServiceAccountIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromNintendoServiceAccountIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Switch Device identifiers. */
@@ -803,9 +993,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -848,7 +1037,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromNintendoSwitchDeviceIds(FPlayFabB
         FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromNintendoSwitchDeviceIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of PlayStation Network identifiers. */
@@ -858,9 +1046,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -904,7 +1091,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromPSNAccountIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromPSNAccountIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromPSNAccountIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromPSNAccountIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Steam identifiers. The Steam identifiers are the profile IDs for the user accounts, available as SteamId in the Steamworks Community API calls. */
@@ -914,9 +1100,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -959,7 +1144,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
         FClientGetPlayFabIDsFromSteamIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromSteamIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Twitch identifiers. The Twitch identifiers are the IDs for the user accounts, available as "_id" from the Twitch API methods (ex: https://github.com/justintv/Twitch-API/blob/master/v3_resources/users.md#get-usersuser). */
@@ -969,9 +1153,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1014,7 +1197,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs(FPlayFabBaseModel respo
         FClientGetPlayFabIDsFromTwitchIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromTwitchIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromTwitchIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of XboxLive identifiers. */
@@ -1024,9 +1206,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1074,7 +1255,6 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromXboxLiveIDs(FPlayFabBaseModel res
         FClientGetPlayFabIDsFromXboxLiveIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromXboxLiveIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromXboxLiveIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Android device identifier to the user's PlayFab account */
@@ -1084,9 +1264,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1138,7 +1317,6 @@ void UPlayFabClientAPI::HelperLinkAndroidDeviceID(FPlayFabBaseModel response, UO
         FClientLinkAndroidDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkAndroidDeviceIDResultResponse(response.responseData);
         OnSuccessLinkAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Apple account associated with the token to the user's PlayFab account. */
@@ -1148,9 +1326,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkApple(FClientLinkAppleRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1192,7 +1369,6 @@ void UPlayFabClientAPI::HelperLinkApple(FPlayFabBaseModel response, UObject* cus
         FClientEmptyResult ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
         OnSuccessLinkApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the custom identifier, generated by the title, to the user's PlayFab account */
@@ -1202,9 +1378,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1246,7 +1421,6 @@ void UPlayFabClientAPI::HelperLinkCustomID(FPlayFabBaseModel response, UObject*
         FClientLinkCustomIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkCustomIDResultResponse(response.responseData);
         OnSuccessLinkCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Facebook account associated with the provided Facebook access token to the user's PlayFab account */
@@ -1256,9 +1430,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1300,7 +1473,6 @@ void UPlayFabClientAPI::HelperLinkFacebookAccount(FPlayFabBaseModel response, UO
         FClientLinkFacebookAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkFacebookAccountResultResponse(response.responseData);
         OnSuccessLinkFacebookAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Facebook Instant Games Id to the user's PlayFab account */
@@ -1310,9 +1482,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookInstantGamesId(FClientLinkFace
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1354,7 +1525,6 @@ void UPlayFabClientAPI::HelperLinkFacebookInstantGamesId(FPlayFabBaseModel respo
         FClientLinkFacebookInstantGamesIdResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkFacebookInstantGamesIdResultResponse(response.responseData);
         OnSuccessLinkFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Game Center account associated with the provided Game Center ID to the user's PlayFab account. Logging in with a Game Center ID is insecure if you do not include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters in this request. It is recommended you require these parameters on all Game Center calls by going to the Apple Add-ons page in the PlayFab Game Manager and enabling the 'Require secure authentication only for this app' option. */
@@ -1364,9 +1534,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1428,7 +1597,6 @@ void UPlayFabClientAPI::HelperLinkGameCenterAccount(FPlayFabBaseModel response,
         FClientLinkGameCenterAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkGameCenterAccountResultResponse(response.responseData);
         OnSuccessLinkGameCenterAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the currently signed-in user account to their Google account, using their Google account credentials */
@@ -1438,9 +1606,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1482,7 +1649,6 @@ void UPlayFabClientAPI::HelperLinkGoogleAccount(FPlayFabBaseModel response, UObj
         FClientLinkGoogleAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkGoogleAccountResultResponse(response.responseData);
         OnSuccessLinkGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the vendor-specific iOS device identifier to the user's PlayFab account */
@@ -1492,9 +1658,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1546,7 +1711,6 @@ void UPlayFabClientAPI::HelperLinkIOSDeviceID(FPlayFabBaseModel response, UObjec
         FClientLinkIOSDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDResultResponse(response.responseData);
         OnSuccessLinkIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Kongregate identifier to the user's PlayFab account */
@@ -1556,9 +1720,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1605,7 +1768,6 @@ void UPlayFabClientAPI::HelperLinkKongregate(FPlayFabBaseModel response, UObject
         FClientLinkKongregateAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkKongregateAccountResultResponse(response.responseData);
         OnSuccessLinkKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Nintendo account associated with the token to the user's PlayFab account. */
@@ -1615,9 +1777,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoServiceAccount(FClientLinkNint
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1660,7 +1821,6 @@ void UPlayFabClientAPI::HelperLinkNintendoServiceAccount(FPlayFabBaseModel respo
         ResultStruct.Request = RequestJsonObj;
         OnSuccessLinkNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the NintendoSwitchDeviceId to the user's PlayFab account */
@@ -1670,9 +1830,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoSwitchDeviceId(FClientLinkNint
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1714,7 +1873,6 @@ void UPlayFabClientAPI::HelperLinkNintendoSwitchDeviceId(FPlayFabBaseModel respo
         FClientLinkNintendoSwitchDeviceIdResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkNintendoSwitchDeviceIdResultResponse(response.responseData);
         OnSuccessLinkNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links an OpenID Connect account to a user's PlayFab account, based on an existing relationship between a title and an Open ID Connect provider and the OpenId Connect JWT from that provider. */
@@ -1724,9 +1882,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkOpenIdConnect(FClientLinkOpenIdConnect
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1774,7 +1931,6 @@ void UPlayFabClientAPI::HelperLinkOpenIdConnect(FPlayFabBaseModel response, UObj
         ResultStruct.Request = RequestJsonObj;
         OnSuccessLinkOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the PlayStation Network account associated with the provided access code to the user's PlayFab account */
@@ -1784,9 +1940,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkPSNAccount(FClientLinkPSNAccountReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1834,7 +1989,6 @@ void UPlayFabClientAPI::HelperLinkPSNAccount(FPlayFabBaseModel response, UObject
         FClientLinkPSNAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkPSNAccountResultResponse(response.responseData);
         OnSuccessLinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Steam account associated with the provided Steam authentication ticket to the user's PlayFab account */
@@ -1844,9 +1998,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1888,7 +2041,6 @@ void UPlayFabClientAPI::HelperLinkSteamAccount(FPlayFabBaseModel response, UObje
         FClientLinkSteamAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkSteamAccountResultResponse(response.responseData);
         OnSuccessLinkSteamAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Twitch account associated with the token to the user's PlayFab account. */
@@ -1898,9 +2050,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1942,7 +2093,6 @@ void UPlayFabClientAPI::HelperLinkTwitch(FPlayFabBaseModel response, UObject* cu
         FClientLinkTwitchAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkTwitchAccountResultResponse(response.responseData);
         OnSuccessLinkTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Links the Xbox Live account associated with the provided access code to the user's PlayFab account */
@@ -1952,9 +2102,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkXboxAccount(FClientLinkXboxAccountRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1996,7 +2145,6 @@ void UPlayFabClientAPI::HelperLinkXboxAccount(FPlayFabBaseModel response, UObjec
         FClientLinkXboxAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkXboxAccountResultResponse(response.responseData);
         OnSuccessLinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Removes a contact email from the player's profile. */
@@ -2006,9 +2154,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveContactEmail(FClientRemoveContactEma
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2044,7 +2191,6 @@ void UPlayFabClientAPI::HelperRemoveContactEmail(FPlayFabBaseModel response, UOb
         FClientRemoveContactEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveContactEmailResultResponse(response.responseData);
         OnSuccessRemoveContactEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Removes the specified generic service identifier from the player's PlayFab account. */
@@ -2054,9 +2200,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2092,7 +2237,6 @@ void UPlayFabClientAPI::HelperRemoveGenericID(FPlayFabBaseModel response, UObjec
         FClientRemoveGenericIDResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveGenericIDResultResponse(response.responseData);
         OnSuccessRemoveGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Submit a report for another player (due to bad bahavior, etc.), so that customer service representatives for the title can take action concerning potentially toxic players. */
@@ -2102,9 +2246,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2150,7 +2293,6 @@ void UPlayFabClientAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
         FClientReportPlayerClientResult ResultStruct = UPlayFabClientModelDecoder::decodeReportPlayerClientResultResponse(response.responseData);
         OnSuccessReportPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Forces an email to be sent to the registered email address for the user's account, with a link allowing the user to change the password.If an account recovery email template ID is provided, an email using the custom email template will be used. */
@@ -2160,9 +2302,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2208,7 +2349,6 @@ void UPlayFabClientAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel respons
         FClientSendAccountRecoveryEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
         OnSuccessSendAccountRecoveryEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Android device identifier from the user's PlayFab account */
@@ -2218,9 +2358,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2261,7 +2400,6 @@ void UPlayFabClientAPI::HelperUnlinkAndroidDeviceID(FPlayFabBaseModel response,
         FClientUnlinkAndroidDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkAndroidDeviceIDResultResponse(response.responseData);
         OnSuccessUnlinkAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Apple account from the user's PlayFab account. */
@@ -2271,9 +2409,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkApple(FClientUnlinkAppleRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2309,7 +2446,6 @@ void UPlayFabClientAPI::HelperUnlinkApple(FPlayFabBaseModel response, UObject* c
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessUnlinkApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related custom identifier from the user's PlayFab account */
@@ -2319,9 +2455,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2362,7 +2497,6 @@ void UPlayFabClientAPI::HelperUnlinkCustomID(FPlayFabBaseModel response, UObject
         FClientUnlinkCustomIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkCustomIDResultResponse(response.responseData);
         OnSuccessUnlinkCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Facebook account from the user's PlayFab account */
@@ -2372,9 +2506,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2410,7 +2543,6 @@ void UPlayFabClientAPI::HelperUnlinkFacebookAccount(FPlayFabBaseModel response,
         FClientUnlinkFacebookAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkFacebookAccountResultResponse(response.responseData);
         OnSuccessUnlinkFacebookAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Facebook Instant Game Ids from the user's PlayFab account */
@@ -2420,9 +2552,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookInstantGamesId(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2463,7 +2594,6 @@ void UPlayFabClientAPI::HelperUnlinkFacebookInstantGamesId(FPlayFabBaseModel res
         FClientUnlinkFacebookInstantGamesIdResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkFacebookInstantGamesIdResultResponse(response.responseData);
         OnSuccessUnlinkFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Game Center account from the user's PlayFab account */
@@ -2473,9 +2603,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2511,7 +2640,6 @@ void UPlayFabClientAPI::HelperUnlinkGameCenterAccount(FPlayFabBaseModel response
         FClientUnlinkGameCenterAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkGameCenterAccountResultResponse(response.responseData);
         OnSuccessUnlinkGameCenterAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Google account from the user's PlayFab account (https://developers.google.com/android/reference/com/google/android/gms/auth/GoogleAuthUtil#public-methods). */
@@ -2521,9 +2649,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2559,7 +2686,6 @@ void UPlayFabClientAPI::HelperUnlinkGoogleAccount(FPlayFabBaseModel response, UO
         FClientUnlinkGoogleAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkGoogleAccountResultResponse(response.responseData);
         OnSuccessUnlinkGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related iOS device identifier from the user's PlayFab account */
@@ -2569,9 +2695,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2612,7 +2737,6 @@ void UPlayFabClientAPI::HelperUnlinkIOSDeviceID(FPlayFabBaseModel response, UObj
         FClientUnlinkIOSDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkIOSDeviceIDResultResponse(response.responseData);
         OnSuccessUnlinkIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Kongregate identifier from the user's PlayFab account */
@@ -2622,9 +2746,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2660,7 +2783,6 @@ void UPlayFabClientAPI::HelperUnlinkKongregate(FPlayFabBaseModel response, UObje
         FClientUnlinkKongregateAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkKongregateAccountResultResponse(response.responseData);
         OnSuccessUnlinkKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Nintendo account from the user's PlayFab account. */
@@ -2670,9 +2792,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoServiceAccount(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2709,7 +2830,6 @@ void UPlayFabClientAPI::HelperUnlinkNintendoServiceAccount(FPlayFabBaseModel res
         ResultStruct.Request = RequestJsonObj;
         OnSuccessUnlinkNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related NintendoSwitchDeviceId from the user's PlayFab account */
@@ -2719,9 +2839,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2762,7 +2881,6 @@ void UPlayFabClientAPI::HelperUnlinkNintendoSwitchDeviceId(FPlayFabBaseModel res
         FClientUnlinkNintendoSwitchDeviceIdResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkNintendoSwitchDeviceIdResultResponse(response.responseData);
         OnSuccessUnlinkNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks an OpenID Connect account from a user's PlayFab account, based on the connection ID of an existing relationship between a title and an Open ID Connect provider. */
@@ -2772,9 +2890,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkOpenIdConnect(FClientUnlinkOpenIdCon
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2816,7 +2933,6 @@ void UPlayFabClientAPI::HelperUnlinkOpenIdConnect(FPlayFabBaseModel response, UO
         ResultStruct.Request = RequestJsonObj;
         OnSuccessUnlinkOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related PSN account from the user's PlayFab account */
@@ -2826,9 +2942,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkPSNAccount(FClientUnlinkPSNAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2864,7 +2979,6 @@ void UPlayFabClientAPI::HelperUnlinkPSNAccount(FPlayFabBaseModel response, UObje
         FClientUnlinkPSNAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkPSNAccountResultResponse(response.responseData);
         OnSuccessUnlinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Steam account from the user's PlayFab account */
@@ -2874,9 +2988,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2912,7 +3025,6 @@ void UPlayFabClientAPI::HelperUnlinkSteamAccount(FPlayFabBaseModel response, UOb
         FClientUnlinkSteamAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkSteamAccountResultResponse(response.responseData);
         OnSuccessUnlinkSteamAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Twitch account from the user's PlayFab account. */
@@ -2922,9 +3034,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2965,7 +3076,6 @@ void UPlayFabClientAPI::HelperUnlinkTwitch(FPlayFabBaseModel response, UObject*
         FClientUnlinkTwitchAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkTwitchAccountResultResponse(response.responseData);
         OnSuccessUnlinkTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Unlinks the related Xbox Live account from the user's PlayFab account */
@@ -2975,9 +3085,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkXboxAccount(FClientUnlinkXboxAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3013,7 +3122,6 @@ void UPlayFabClientAPI::HelperUnlinkXboxAccount(FPlayFabBaseModel response, UObj
         FClientUnlinkXboxAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkXboxAccountResultResponse(response.responseData);
         OnSuccessUnlinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Update the avatar URL of the player */
@@ -3023,9 +3131,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3066,7 +3173,6 @@ void UPlayFabClientAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
         ResultStruct.Request = RequestJsonObj;
         OnSuccessUpdateAvatarUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Updates the title specific display name for the user */
@@ -3076,9 +3182,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3119,7 +3224,6 @@ void UPlayFabClientAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respo
         FClientUpdateUserTitleDisplayNameResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
         OnSuccessUpdateUserTitleDisplayName.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -3133,9 +3237,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AttributeInstall(FClientAttributeInstallRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3180,7 +3283,6 @@ void UPlayFabClientAPI::HelperAttributeInstall(FPlayFabBaseModel response, UObje
         FClientAttributeInstallResult ResultStruct = UPlayFabClientModelDecoder::decodeAttributeInstallResultResponse(response.responseData);
         OnSuccessAttributeInstall.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Returns a list of ad placements and a reward for each */
@@ -3190,9 +3292,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAdPlacements(FClientGetAdPlacementsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3233,7 +3334,6 @@ void UPlayFabClientAPI::HelperGetAdPlacements(FPlayFabBaseModel response, UObjec
         FClientGetAdPlacementsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetAdPlacementsResultResponse(response.responseData);
         OnSuccessGetAdPlacements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Report player's ad activity */
@@ -3243,9 +3343,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportAdActivity(FClientReportAdActivityRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3294,7 +3393,6 @@ void UPlayFabClientAPI::HelperReportAdActivity(FPlayFabBaseModel response, UObje
         FClientReportAdActivityResult ResultStruct = UPlayFabClientModelDecoder::decodeReportAdActivityResultResponse(response.responseData);
         OnSuccessReportAdActivity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Reward player's ad activity */
@@ -3304,9 +3402,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RewardAdActivity(FClientRewardAdActivityRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3352,7 +3449,6 @@ void UPlayFabClientAPI::HelperRewardAdActivity(FPlayFabBaseModel response, UObje
         FClientRewardAdActivityResult ResultStruct = UPlayFabClientModelDecoder::decodeRewardAdActivityResultResponse(response.responseData);
         OnSuccessRewardAdActivity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -3366,9 +3462,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportDeviceInfo(FClientDeviceInfoRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3405,7 +3500,6 @@ void UPlayFabClientAPI::HelperReportDeviceInfo(FPlayFabBaseModel response, UObje
         ResultStruct.Request = RequestJsonObj;
         OnSuccessReportDeviceInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Writes a character-based event into PlayStream. */
@@ -3415,9 +3509,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3469,7 +3562,6 @@ void UPlayFabClientAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
         FClientWriteEventResponse ResultStruct = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
         OnSuccessWriteCharacterEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Writes a player-based event into PlayStream. */
@@ -3479,9 +3571,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3529,7 +3620,6 @@ void UPlayFabClientAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
         ResultStruct.Request = RequestJsonObj;
         OnSuccessWritePlayerEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Writes a title-based event into PlayStream. */
@@ -3539,9 +3629,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3589,7 +3678,6 @@ void UPlayFabClientAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
         ResultStruct.Request = RequestJsonObj;
         OnSuccessWriteTitleEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -3603,9 +3691,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3645,7 +3732,6 @@ void UPlayFabClientAPI::HelperGetPhotonAuthenticationToken(FPlayFabBaseModel res
         FClientGetPhotonAuthenticationTokenResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPhotonAuthenticationTokenResultResponse(response.responseData);
         OnSuccessGetPhotonAuthenticationToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Returns the title's base 64 encoded RSA CSP blob. */
@@ -3655,9 +3741,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3697,7 +3782,6 @@ void UPlayFabClientAPI::HelperGetTitlePublicKey(FPlayFabBaseModel response, UObj
         FClientGetTitlePublicKeyResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitlePublicKeyResultResponse(response.responseData);
         OnSuccessGetTitlePublicKey.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using the Android device identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -3707,9 +3791,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3773,7 +3856,6 @@ void UPlayFabClientAPI::HelperLoginWithAndroidDeviceID(FPlayFabBaseModel respons
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
         OnSuccessLoginWithAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs in the user with a Sign in with Apple identity token. */
@@ -3783,9 +3865,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithApple(FClientLoginWithAppleReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3842,7 +3923,6 @@ void UPlayFabClientAPI::HelperLoginWithApple(FPlayFabBaseModel response, UObject
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a custom unique identifier generated by the title, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -3852,9 +3932,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3911,7 +3990,6 @@ void UPlayFabClientAPI::HelperLoginWithCustomID(FPlayFabBaseModel response, UObj
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user into the PlayFab account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Unlike most other login API calls, LoginWithEmailAddress does not permit the creation of new accounts via the CreateAccountFlag. Email addresses may be used to create accounts via RegisterPlayFabUser. */
@@ -3921,9 +3999,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3974,7 +4051,6 @@ void UPlayFabClientAPI::HelperLoginWithEmailAddress(FPlayFabBaseModel response,
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithEmailAddress.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Facebook access token, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -3984,9 +4060,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4043,7 +4118,6 @@ void UPlayFabClientAPI::HelperLoginWithFacebook(FPlayFabBaseModel response, UObj
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithFacebook.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Facebook Instant Games ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Requires Facebook Instant Games to be configured. */
@@ -4053,9 +4127,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebookInstantGamesId(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4112,7 +4185,6 @@ void UPlayFabClientAPI::HelperLoginWithFacebookInstantGamesId(FPlayFabBaseModel
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using an iOS Game Center player identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Logging in with a Game Center ID is insecure if you do not include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters in this request. It is recommended you require these parameters on all Game Center calls by going to the Apple Add-ons page in the PlayFab Game Manager and enabling the 'Require secure authentication only for this app' option. */
@@ -4122,9 +4194,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4201,7 +4272,6 @@ void UPlayFabClientAPI::HelperLoginWithGameCenter(FPlayFabBaseModel response, UO
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithGameCenter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using their Google account credentials */
@@ -4211,9 +4281,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4270,7 +4339,6 @@ void UPlayFabClientAPI::HelperLoginWithGoogleAccount(FPlayFabBaseModel response,
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using the vendor-specific iOS device identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4280,9 +4348,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4349,7 +4416,6 @@ void UPlayFabClientAPI::HelperLoginWithIOSDeviceID(FPlayFabBaseModel response, U
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Kongregate player account. */
@@ -4359,9 +4425,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4423,7 +4488,6 @@ void UPlayFabClientAPI::HelperLoginWithKongregate(FPlayFabBaseModel response, UO
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs in the user with a Nintendo service account token. */
@@ -4433,9 +4497,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoServiceAccount(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4492,7 +4555,6 @@ void UPlayFabClientAPI::HelperLoginWithNintendoServiceAccount(FPlayFabBaseModel
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Nintendo Switch Device ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4502,9 +4564,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4561,7 +4622,6 @@ void UPlayFabClientAPI::HelperLoginWithNintendoSwitchDeviceId(FPlayFabBaseModel
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Logs in a user with an Open ID Connect JWT created by an existing relationship between a title and an Open ID Connect provider. */
@@ -4571,9 +4631,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithOpenIdConnect(FClientLoginWithOpe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4635,7 +4694,6 @@ void UPlayFabClientAPI::HelperLoginWithOpenIdConnect(FPlayFabBaseModel response,
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user into the PlayFab account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Unlike most other login API calls, LoginWithPlayFab does not permit the creation of new accounts via the CreateAccountFlag. Username/Password credentials may be used to create accounts via RegisterPlayFabUser, or added to existing accounts using AddUsernamePassword. */
@@ -4645,9 +4703,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4698,7 +4755,6 @@ void UPlayFabClientAPI::HelperLoginWithPlayFab(FPlayFabBaseModel response, UObje
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithPlayFab.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a PlayStation Network authentication code, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4708,9 +4764,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPSN(FClientLoginWithPSNRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4773,7 +4828,6 @@ void UPlayFabClientAPI::HelperLoginWithPSN(FPlayFabBaseModel response, UObject*
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithPSN.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Steam authentication ticket, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4783,9 +4837,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4842,7 +4895,6 @@ void UPlayFabClientAPI::HelperLoginWithSteam(FPlayFabBaseModel response, UObject
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithSteam.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Twitch access token. */
@@ -4852,9 +4904,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4911,7 +4962,6 @@ void UPlayFabClientAPI::HelperLoginWithTwitch(FPlayFabBaseModel response, UObjec
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Signs the user in using a Xbox Live Token, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4921,9 +4971,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithXbox(FClientLoginWithXboxRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4980,7 +5029,6 @@ void UPlayFabClientAPI::HelperLoginWithXbox(FPlayFabBaseModel response, UObject*
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithXbox.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Registers a new Playfab user account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. You must supply either a username or an email address. */
@@ -4990,9 +5038,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5061,7 +5108,6 @@ void UPlayFabClientAPI::HelperRegisterPlayFabUser(FPlayFabBaseModel response, UO
         FClientRegisterPlayFabUserResult ResultStruct = UPlayFabClientModelDecoder::decodeRegisterPlayFabUserResultResponse(response.responseData);
         OnSuccessRegisterPlayFabUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Sets the player's secret if it is not already set. Player secrets are used to sign API requests. To reset a player's secret use the Admin or Server API method SetPlayerSecret. */
@@ -5071,9 +5117,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5118,7 +5163,6 @@ void UPlayFabClientAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
         FClientSetPlayerSecretResult ResultStruct = UPlayFabClientModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
         OnSuccessSetPlayerSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -5132,9 +5176,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5188,7 +5231,6 @@ void UPlayFabClientAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
         FClientGetCharacterDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
         OnSuccessGetCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the title-specific custom data for the character which can only be read by the client */
@@ -5198,9 +5240,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5255,7 +5296,6 @@ void UPlayFabClientAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
         ResultStruct.Request = RequestJsonObj;
         OnSuccessGetCharacterReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Creates and updates the title-specific custom data for the user's character which is readable and writable by the client */
@@ -5265,9 +5305,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5320,7 +5359,6 @@ void UPlayFabClientAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
         FClientUpdateCharacterDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
         OnSuccessUpdateCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -5334,9 +5372,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5376,7 +5413,6 @@ void UPlayFabClientAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
         FClientListUsersCharactersResult ResultStruct = UPlayFabClientModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
         OnSuccessGetAllUsersCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, starting from the indicated point in the leaderboard */
@@ -5386,9 +5422,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5435,7 +5470,6 @@ void UPlayFabClientAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
         FClientGetCharacterLeaderboardResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
         OnSuccessGetCharacterLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the details of all title-specific statistics for the user */
@@ -5445,9 +5479,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5487,7 +5520,6 @@ void UPlayFabClientAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
         FClientGetCharacterStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
         OnSuccessGetCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, centered on the requested Character ID */
@@ -5497,9 +5529,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5550,7 +5581,6 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
         FClientGetLeaderboardAroundCharacterResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of all of the user's characters for the given statistic. */
@@ -5560,9 +5590,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5602,7 +5631,6 @@ void UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
         FClientGetLeaderboardForUsersCharactersResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
         OnSuccessGetLeaderboardForUserCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Grants the specified character type to the user. CharacterIds are not globally unique; characterId must be evaluated with the parent PlayFabId to guarantee uniqueness. */
@@ -5612,9 +5640,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5665,7 +5692,6 @@ void UPlayFabClientAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
         FClientGrantCharacterToUserResult ResultStruct = UPlayFabClientModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
         OnSuccessGrantCharacterToUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Updates the values of the specified title-specific statistics for the specific character. By default, clients are not permitted to update statistics. Developers may override this setting in the Game Manager > Settings > API Features. */
@@ -5675,9 +5701,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5719,7 +5744,6 @@ void UPlayFabClientAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
         FClientUpdateCharacterStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
         OnSuccessUpdateCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -5733,9 +5757,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5781,7 +5804,6 @@ void UPlayFabClientAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
         FClientGetContentDownloadUrlResult ResultStruct = UPlayFabClientModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
         OnSuccessGetContentDownloadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -5795,9 +5817,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5852,7 +5873,6 @@ void UPlayFabClientAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
         FClientAddFriendResult ResultStruct = UPlayFabClientModelDecoder::decodeAddFriendResultResponse(response.responseData);
         OnSuccessAddFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the current friend list for the local user, constrained to users who have PlayFab accounts. Friends from linked accounts (Facebook, Steam) are also included. You may optionally exclude some linked services' friends. */
@@ -5862,9 +5882,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5908,7 +5927,6 @@ void UPlayFabClientAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
         FClientGetFriendsListResult ResultStruct = UPlayFabClientModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
         OnSuccessGetFriendsList.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Removes a specified user from the friend list of the local user */
@@ -5918,9 +5936,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5960,7 +5977,6 @@ void UPlayFabClientAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
         FClientRemoveFriendResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveFriendResultResponse(response.responseData);
         OnSuccessRemoveFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Updates the tag list for a specified user in the friend list of the local user */
@@ -5970,9 +5986,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6020,7 +6035,6 @@ void UPlayFabClientAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
         FClientSetFriendTagsResult ResultStruct = UPlayFabClientModelDecoder::decodeSetFriendTagsResultResponse(response.responseData);
         OnSuccessSetFriendTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -6034,9 +6048,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6090,7 +6103,6 @@ void UPlayFabClientAPI::HelperGetCurrentGames(FPlayFabBaseModel response, UObjec
         FClientCurrentGamesResult ResultStruct = UPlayFabClientModelDecoder::decodeCurrentGamesResultResponse(response.responseData);
         OnSuccessGetCurrentGames.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /**  Get details about the regions hosting game servers matching the given parameters. */
@@ -6100,9 +6112,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6143,7 +6154,6 @@ void UPlayFabClientAPI::HelperGetGameServerRegions(FPlayFabBaseModel response, U
         FClientGameServerRegionsResult ResultStruct = UPlayFabClientModelDecoder::decodeGameServerRegionsResultResponse(response.responseData);
         OnSuccessGetGameServerRegions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Attempts to locate a game session matching the given parameters. If the goal is to match the player into a specific active session, only the LobbyId is required. Otherwise, the BuildVersion, GameMode, and Region are all required parameters. Note that parameters specified in the search are required (they are not weighting factors). If a slot is found in a server instance matching the parameters, the slot will be assigned to that player, removing it from the availabe set. In that case, the information on the game session will be returned, otherwise the Status returned will be GameNotFound. */
@@ -6153,9 +6163,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6221,7 +6230,6 @@ void UPlayFabClientAPI::HelperMatchmake(FPlayFabBaseModel response, UObject* cus
         FClientMatchmakeResult ResultStruct = UPlayFabClientModelDecoder::decodeMatchmakeResultResponse(response.responseData);
         OnSuccessMatchmake.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -6235,9 +6243,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6283,7 +6290,6 @@ void UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration(FPlayFab
         FClientAndroidDevicePushNotificationRegistrationResult ResultStruct = UPlayFabClientModelDecoder::decodeAndroidDevicePushNotificationRegistrationResultResponse(response.responseData);
         OnSuccessAndroidDevicePushNotificationRegistration.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Grants the player's current entitlements from Microsoft Store's Collection API */
@@ -6293,9 +6299,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(FClientC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6337,7 +6342,6 @@ void UPlayFabClientAPI::HelperConsumeMicrosoftStoreEntitlements(FPlayFabBaseMode
         FClientConsumeMicrosoftStoreEntitlementsResponse ResultStruct = UPlayFabClientModelDecoder::decodeConsumeMicrosoftStoreEntitlementsResponseResponse(response.responseData);
         OnSuccessConsumeMicrosoftStoreEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Checks for any new PS5 entitlements. If any are found, they are consumed (if they're consumables) and added as PlayFab items */
@@ -6347,9 +6351,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePS5Entitlements(FClientConsumePS5En
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6391,7 +6394,6 @@ void UPlayFabClientAPI::HelperConsumePS5Entitlements(FPlayFabBaseModel response,
         FClientConsumePS5EntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumePS5EntitlementsResultResponse(response.responseData);
         OnSuccessConsumePS5Entitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Checks for any new consumable entitlements. If any are found, they are consumed and added as PlayFab items */
@@ -6401,9 +6403,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePSNEntitlements(FClientConsumePSNEn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6445,7 +6446,6 @@ void UPlayFabClientAPI::HelperConsumePSNEntitlements(FPlayFabBaseModel response,
         FClientConsumePSNEntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumePSNEntitlementsResultResponse(response.responseData);
         OnSuccessConsumePSNEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Grants the player's current entitlements from Xbox Live, consuming all availble items in Xbox and granting them to the player's PlayFab inventory. This call is idempotent and will not grant previously granted items to the player. */
@@ -6455,9 +6455,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeXboxEntitlements(FClientConsumeXbox
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6503,7 +6502,6 @@ void UPlayFabClientAPI::HelperConsumeXboxEntitlements(FPlayFabBaseModel response
         FClientConsumeXboxEntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumeXboxEntitlementsResultResponse(response.responseData);
         OnSuccessConsumeXboxEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Uses the supplied OAuth code to refresh the internally cached player PSN auth token */
@@ -6513,9 +6511,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RefreshPSNAuthToken(FClientRefreshPSNAuthT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6562,7 +6559,6 @@ void UPlayFabClientAPI::HelperRefreshPSNAuthToken(FPlayFabBaseModel response, UO
         ResultStruct.Request = RequestJsonObj;
         OnSuccessRefreshPSNAuthToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Registers the iOS device to receive push notifications */
@@ -6572,9 +6568,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6620,7 +6615,6 @@ void UPlayFabClientAPI::HelperRegisterForIOSPushNotification(FPlayFabBaseModel r
         FClientRegisterForIOSPushNotificationResult ResultStruct = UPlayFabClientModelDecoder::decodeRegisterForIOSPushNotificationResultResponse(response.responseData);
         OnSuccessRegisterForIOSPushNotification.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Restores all in-app purchases based on the given restore receipt */
@@ -6630,9 +6624,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6678,7 +6671,6 @@ void UPlayFabClientAPI::HelperRestoreIOSPurchases(FPlayFabBaseModel response, UO
         FClientRestoreIOSPurchasesResult ResultStruct = UPlayFabClientModelDecoder::decodeRestoreIOSPurchasesResultResponse(response.responseData);
         OnSuccessRestoreIOSPurchases.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Validates with Amazon that the receipt for an Amazon App Store in-app purchase is valid and that it matches the purchased catalog item */
@@ -6688,9 +6680,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6747,7 +6738,6 @@ void UPlayFabClientAPI::HelperValidateAmazonIAPReceipt(FPlayFabBaseModel respons
         FClientValidateAmazonReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateAmazonReceiptResultResponse(response.responseData);
         OnSuccessValidateAmazonIAPReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Validates a Google Play purchase and gives the corresponding item to the player. */
@@ -6757,9 +6747,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6816,7 +6805,6 @@ void UPlayFabClientAPI::HelperValidateGooglePlayPurchase(FPlayFabBaseModel respo
         FClientValidateGooglePlayPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateGooglePlayPurchaseResultResponse(response.responseData);
         OnSuccessValidateGooglePlayPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Validates with the Apple store that the receipt for an iOS in-app purchase is valid and that it matches the purchased catalog item */
@@ -6826,9 +6814,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6880,7 +6867,6 @@ void UPlayFabClientAPI::HelperValidateIOSReceipt(FPlayFabBaseModel response, UOb
         FClientValidateIOSReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateIOSReceiptResultResponse(response.responseData);
         OnSuccessValidateIOSReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Validates with Windows that the receipt for an Windows App Store in-app purchase is valid and that it matches the purchased catalog item */
@@ -6890,9 +6876,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6944,7 +6929,6 @@ void UPlayFabClientAPI::HelperValidateWindowsStoreReceipt(FPlayFabBaseModel resp
         FClientValidateWindowsReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateWindowsReceiptResultResponse(response.responseData);
         OnSuccessValidateWindowsStoreReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -6958,9 +6942,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7013,7 +6996,6 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
         FClientGetLeaderboardResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
         OnSuccessGetFriendLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of ranked friends of the current player for the given statistic, centered on the requested PlayFab user. If PlayFabId is empty or null will return currently logged in user. */
@@ -7023,9 +7005,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7082,7 +7063,6 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer(FPlayFabBaseModel
         FClientGetFriendLeaderboardAroundPlayerResult ResultStruct = UPlayFabClientModelDecoder::decodeGetFriendLeaderboardAroundPlayerResultResponse(response.responseData);
         OnSuccessGetFriendLeaderboardAroundPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of ranked users for the given statistic, starting from the indicated point in the leaderboard */
@@ -7092,9 +7072,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7141,7 +7120,6 @@ void UPlayFabClientAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
         ResultStruct.Request = RequestJsonObj;
         OnSuccessGetLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a list of ranked users for the given statistic, centered on the requested player. If PlayFabId is empty or null will return currently logged in user. */
@@ -7151,9 +7129,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7203,7 +7180,6 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer(FPlayFabBaseModel respo
         FClientGetLeaderboardAroundPlayerResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundPlayerResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the indicated statistics (current version and values for all statistics, if none are specified), for the local player. */
@@ -7213,9 +7189,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7264,7 +7239,6 @@ void UPlayFabClientAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
         FClientGetPlayerStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
         OnSuccessGetPlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the information on the available versions of the specified statistic. */
@@ -7274,9 +7248,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7317,7 +7290,6 @@ void UPlayFabClientAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
         FClientGetPlayerStatisticVersionsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
         OnSuccessGetPlayerStatisticVersions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the title-specific custom data for the user which is readable and writable by the client */
@@ -7327,9 +7299,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7378,7 +7349,6 @@ void UPlayFabClientAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
         FClientGetUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
         OnSuccessGetUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the publisher-specific custom data for the user which is readable and writable by the client */
@@ -7388,9 +7358,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7440,7 +7409,6 @@ void UPlayFabClientAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
         ResultStruct.Request = RequestJsonObj;
         OnSuccessGetUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the publisher-specific custom data for the user which can only be read by the client */
@@ -7450,9 +7418,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7502,7 +7469,6 @@ void UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
         ResultStruct.Request = RequestJsonObj;
         OnSuccessGetUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the title-specific custom data for the user which can only be read by the client */
@@ -7512,9 +7478,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7564,7 +7529,6 @@ void UPlayFabClientAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
         ResultStruct.Request = RequestJsonObj;
         OnSuccessGetUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Updates the values of the specified title-specific statistics for the user. By default, clients are not permitted to update statistics. Developers may override this setting in the Game Manager > Settings > API Features. */
@@ -7574,9 +7538,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7617,7 +7580,6 @@ void UPlayFabClientAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
         FClientUpdatePlayerStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
         OnSuccessUpdatePlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Creates and updates the title-specific custom data for the user which is readable and writable by the client */
@@ -7627,9 +7589,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7677,7 +7638,6 @@ void UPlayFabClientAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
         FClientUpdateUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
         OnSuccessUpdateUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Creates and updates the publisher-specific custom data for the user which is readable and writable by the client */
@@ -7687,9 +7647,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7738,7 +7697,6 @@ void UPlayFabClientAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
         ResultStruct.Request = RequestJsonObj;
         OnSuccessUpdateUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -7752,9 +7710,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7796,7 +7753,6 @@ void UPlayFabClientAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
         FClientModifyUserVirtualCurrencyResult ResultStruct = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
         OnSuccessAddUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Confirms with the payment provider that the purchase was approved (if applicable) and adjusts inventory and virtual currency balances as appropriate */
@@ -7806,9 +7762,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7849,7 +7804,6 @@ void UPlayFabClientAPI::HelperConfirmPurchase(FPlayFabBaseModel response, UObjec
         FClientConfirmPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeConfirmPurchaseResultResponse(response.responseData);
         OnSuccessConfirmPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Consume uses of a consumable item. When all uses are consumed, it will be removed from the player's inventory. */
@@ -7859,9 +7813,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7908,7 +7861,6 @@ void UPlayFabClientAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
         FClientConsumeItemResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumeItemResultResponse(response.responseData);
         OnSuccessConsumeItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the specified character's current inventory of virtual goods */
@@ -7918,9 +7870,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7966,7 +7917,6 @@ void UPlayFabClientAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
         FClientGetCharacterInventoryResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
         OnSuccessGetCharacterInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** For payments flows where the provider requires playfab (the fulfiller) to initiate the transaction, but the client completes the rest of the flow. In the Xsolla case, the token returned here will be passed to Xsolla by the client to create a cart. Poll GetPurchase using the returned OrderId once you've completed the payment. */
@@ -7976,9 +7926,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPaymentToken(FClientGetPaymentTokenRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8018,7 +7967,6 @@ void UPlayFabClientAPI::HelperGetPaymentToken(FPlayFabBaseModel response, UObjec
         FClientGetPaymentTokenResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPaymentTokenResultResponse(response.responseData);
         OnSuccessGetPaymentToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves a purchase along with its current PlayFab status. Returns inventory items from the purchase that are still active. */
@@ -8028,9 +7976,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8070,7 +8017,6 @@ void UPlayFabClientAPI::HelperGetPurchase(FPlayFabBaseModel response, UObject* c
         FClientGetPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPurchaseResultResponse(response.responseData);
         OnSuccessGetPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the user's current inventory of virtual goods */
@@ -8080,9 +8026,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8118,7 +8063,6 @@ void UPlayFabClientAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
         FClientGetUserInventoryResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
         OnSuccessGetUserInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Selects a payment option for purchase order created via StartPurchase */
@@ -8128,9 +8072,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8186,7 +8129,6 @@ void UPlayFabClientAPI::HelperPayForPurchase(FPlayFabBaseModel response, UObject
         FClientPayForPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodePayForPurchaseResultResponse(response.responseData);
         OnSuccessPayForPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Buys a single item with virtual currency. You must specify both the virtual currency to use to purchase, as well as what the client believes the price to be. This lets the server fail the purchase if the price has changed. */
@@ -8196,9 +8138,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8260,7 +8201,6 @@ void UPlayFabClientAPI::HelperPurchaseItem(FPlayFabBaseModel response, UObject*
         FClientPurchaseItemResult ResultStruct = UPlayFabClientModelDecoder::decodePurchaseItemResultResponse(response.responseData);
         OnSuccessPurchaseItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Adds the virtual goods associated with the coupon to the user's inventory. Coupons can be generated via the Economy->Catalogs tab in the PlayFab Game Manager. */
@@ -8270,9 +8210,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8323,7 +8262,6 @@ void UPlayFabClientAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
         FClientRedeemCouponResult ResultStruct = UPlayFabClientModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
         OnSuccessRedeemCoupon.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Creates an order for a list of items from the title catalog */
@@ -8333,9 +8271,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8386,7 +8323,6 @@ void UPlayFabClientAPI::HelperStartPurchase(FPlayFabBaseModel response, UObject*
         FClientStartPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeStartPurchaseResultResponse(response.responseData);
         OnSuccessStartPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Decrements the user's balance of the specified virtual currency by the stated amount. It is possible to make a VC balance negative with this API. */
@@ -8396,9 +8332,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8441,7 +8376,6 @@ void UPlayFabClientAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
         ResultStruct.Request = RequestJsonObj;
         OnSuccessSubtractUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Opens the specified container, with the specified key (when required), and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -8451,9 +8385,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8509,7 +8442,6 @@ void UPlayFabClientAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
         FClientUnlockContainerItemResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
         OnSuccessUnlockContainerInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Searches target inventory for an ItemInstance matching the given CatalogItemId, if necessary unlocks it using an appropriate key, and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -8519,9 +8451,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8573,7 +8504,6 @@ void UPlayFabClientAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
         ResultStruct.Request = RequestJsonObj;
         OnSuccessUnlockContainerItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -8587,9 +8517,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8624,7 +8553,6 @@ void UPlayFabClientAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
         FClientGetPlayerSegmentsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
         OnSuccessGetPlayerSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Get all tags with a given Namespace (optional) from a player profile. */
@@ -8634,9 +8562,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8682,7 +8609,6 @@ void UPlayFabClientAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
         FClientGetPlayerTagsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
         OnSuccessGetPlayerTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -8696,9 +8622,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8745,7 +8670,6 @@ void UPlayFabClientAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
         FClientExecuteCloudScriptResult ResultStruct = UPlayFabClientModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
         OnSuccessExecuteCloudScript.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -8759,9 +8683,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8809,7 +8732,6 @@ void UPlayFabClientAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
         FClientAddSharedGroupMembersResult ResultStruct = UPlayFabClientModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
         OnSuccessAddSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Requests the creation of a shared group object, containing key/value pairs which may be updated by all members of the group. Upon creation, the current user will be the only member of the group. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -8819,9 +8741,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8861,7 +8782,6 @@ void UPlayFabClientAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
         FClientCreateSharedGroupResult ResultStruct = UPlayFabClientModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
         OnSuccessCreateSharedGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves data stored in a shared group object, as well as the list of members in the group. Non-members of the group may use this to retrieve group data, including membership, but they will not receive data for keys marked as private. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -8871,9 +8791,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8922,7 +8841,6 @@ void UPlayFabClientAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
         FClientGetSharedGroupDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
         OnSuccessGetSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Removes users from the set of those able to update the shared data and the set of users in the group. Only users in the group can remove members. If as a result of the call, zero users remain with access, the group and its associated data will be deleted. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -8932,9 +8850,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8982,7 +8899,6 @@ void UPlayFabClientAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
         FClientRemoveSharedGroupMembersResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
         OnSuccessRemoveSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Adds, updates, and removes data keys for a shared group object. If the permission is set to Public, all fields updated or added in this call will be readable by users not in the group. By default, data permissions are set to Private. Regardless of the permission setting, only members of the group can update the data. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -8992,9 +8908,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9047,7 +8962,6 @@ void UPlayFabClientAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
         FClientUpdateSharedGroupDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
         OnSuccessUpdateSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -9061,9 +8975,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9103,7 +9016,6 @@ void UPlayFabClientAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
         FClientGetCatalogItemsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
         OnSuccessGetCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the key-value store of custom publisher settings */
@@ -9113,9 +9025,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9158,7 +9069,6 @@ void UPlayFabClientAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
         FClientGetPublisherDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
         OnSuccessGetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the set of items defined for the specified store, including all prices defined */
@@ -9168,9 +9078,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9215,7 +9124,6 @@ void UPlayFabClientAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
         FClientGetStoreItemsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
         OnSuccessGetStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the current server time */
@@ -9225,9 +9133,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9262,7 +9169,6 @@ void UPlayFabClientAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
         FClientGetTimeResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTimeResultResponse(response.responseData);
         OnSuccessGetTime.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the key-value store of custom title settings */
@@ -9272,9 +9178,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9322,7 +9227,6 @@ void UPlayFabClientAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
         FClientGetTitleDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
         OnSuccessGetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Retrieves the title news feed, as configured in the developer portal */
@@ -9332,9 +9236,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9370,7 +9273,6 @@ void UPlayFabClientAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
         FClientGetTitleNewsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
         OnSuccessGetTitleNews.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -9384,9 +9286,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9439,7 +9340,6 @@ void UPlayFabClientAPI::HelperAcceptTrade(FPlayFabBaseModel response, UObject* c
         FClientAcceptTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeAcceptTradeResponseResponse(response.responseData);
         OnSuccessAcceptTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Cancels an open trade (one that has not yet been accepted or cancelled). Note that only the player who created the trade can cancel it via this API call, to prevent griefing of the trade system (cancelling trades in order to prevent other players from accepting them, for trades that can be claimed by more than one player). */
@@ -9449,9 +9349,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9491,7 +9390,6 @@ void UPlayFabClientAPI::HelperCancelTrade(FPlayFabBaseModel response, UObject* c
         FClientCancelTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeCancelTradeResponseResponse(response.responseData);
         OnSuccessCancelTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Gets all trades the player has either opened or accepted, optionally filtered by trade status. */
@@ -9501,9 +9399,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9541,7 +9438,6 @@ void UPlayFabClientAPI::HelperGetPlayerTrades(FPlayFabBaseModel response, UObjec
         FClientGetPlayerTradesResponse ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerTradesResponseResponse(response.responseData);
         OnSuccessGetPlayerTrades.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Gets the current status of an existing trade. */
@@ -9551,9 +9447,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9598,7 +9493,6 @@ void UPlayFabClientAPI::HelperGetTradeStatus(FPlayFabBaseModel response, UObject
         FClientGetTradeStatusResponse ResultStruct = UPlayFabClientModelDecoder::decodeGetTradeStatusResponseResponse(response.responseData);
         OnSuccessGetTradeStatus.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 /** Opens a new outstanding trade. Note that a given item instance may only be in one open trade at a time. */
@@ -9608,9 +9502,8 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = AcquireProxy();
+    UPlayFabJsonObject* OutRestJsonObj = manager->AcquireRequestObject();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9669,7 +9562,6 @@ void UPlayFabClientAPI::HelperOpenTrade(FPlayFabBaseModel response, UObject* cus
         FClientOpenTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeOpenTradeResponseResponse(response.responseData);
         OnSuccessOpenTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
 }
 
 
@@ -9687,6 +9579,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -9704,6 +9597,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
@@ -9726,7 +9620,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabLogBody(TEXT("Response"), ResponseContent);
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -9765,6 +9659,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     // Broadcast the result event
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
     pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabClientAPI::Activate()
@@ -9822,15 +9717,15 @@ void UPlayFabClientAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
+    // Serialize data to json string, without the indentation nobody reads
     FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
+    TSharedRef< TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> > Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
     FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
 
     // Set Json content
     HttpRequest->SetContentAsString(OutputString);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabLogBody(TEXT("Request"), OutputString);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
@@ -841,7 +841,7 @@ void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabLogBody(TEXT("Response"), ResponseContent);
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -923,7 +923,7 @@ void UPlayFabCloudScriptAPI::Activate()
     // Set Json content
     HttpRequest->SetContentAsString(OutputString);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabLogBody(TEXT("Request"), OutputString);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabCloudScriptAPI::OnProcessRequestComplete);
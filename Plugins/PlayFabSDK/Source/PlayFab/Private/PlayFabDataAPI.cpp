@@ -519,7 +519,7 @@ void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRes
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabLogBody(TEXT("Response"), ResponseContent);
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -601,7 +601,7 @@ void UPlayFabDataAPI::Activate()
     // Set Json content
     HttpRequest->SetContentAsString(OutputString);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabLogBody(TEXT("Request"), OutputString);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabDataAPI::OnProcessRequestComplete);
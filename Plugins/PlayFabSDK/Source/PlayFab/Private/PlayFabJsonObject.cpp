@@ -38,6 +38,18 @@ void UPlayFabJsonObject::Reset()
     JsonObj = MakeShareable(new FJsonObject());
 }
 
+void UPlayFabJsonObject::ClearFields()
+{
+    if (JsonObj.IsValid() && JsonObj.IsUnique())
+    {
+        JsonObj->Values.Reset();
+    }
+    else
+    {
+        Reset();
+    }
+}
+
 TSharedPtr<FJsonObject>& UPlayFabJsonObject::GetRootObject()
 {
     return JsonObj;
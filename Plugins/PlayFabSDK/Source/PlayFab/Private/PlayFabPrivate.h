@@ -20,5 +20,22 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogPlayFab, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogPlayFabTests, Log, All);
+// Request and response bodies, logged at Verbose. Compiled out of shipping builds
+#if UE_BUILD_SHIPPING
+DECLARE_LOG_CATEGORY_EXTERN(LogPlayFabBody, Log, Log);
+#else
+DECLARE_LOG_CATEGORY_EXTERN(LogPlayFabBody, Log, All);
+#endif
+
+void PlayFabLogBodyTruncated(const TCHAR* Label, const FString& Body);
+
+// Logs a request or response body cut to PlayFab.LogBodyMaxChars, without formatting anything unless LogPlayFabBody is verbose
+inline void PlayFabLogBody(const TCHAR* Label, const FString& Body)
+{
+    if (UE_LOG_ACTIVE(LogPlayFabBody, Verbose))
+    {
+        PlayFabLogBodyTruncated(Label, Body);
+    }
+}
 
 #include "PlayFab/Public/IPlayFab.h"
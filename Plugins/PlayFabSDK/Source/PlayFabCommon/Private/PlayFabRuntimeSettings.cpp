@@ -13,5 +13,10 @@ UPlayFabRuntimeSettings::UPlayFabRuntimeSettings()
     , TitleId()
     , DeveloperSecretKey()
     , ConnectionString()
+    , MaxInFlightClientCalls(8)
+    , MaxInFlightServerCalls(16)
+    , MaxInFlightMultiplayerCalls(8)
+    , MaxInFlightEventsCalls(4)
+    , MaxInFlightOtherCalls(8)
 {
 }
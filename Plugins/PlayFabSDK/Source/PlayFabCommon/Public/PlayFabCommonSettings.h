@@ -30,7 +30,8 @@ namespace PlayFabCommon
         static FString GeneratePfUrl(const FString& urlPath)
         {
             const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
-            if (rSettings->ProductionEnvironmentURL.StartsWith(TEXT("https://")))
+            // A full URL is used as it is, plain http only for a stand-in server on this machine outside shipping builds
+            if (rSettings->ProductionEnvironmentURL.StartsWith(TEXT("https://")) || IsLoopbackHttpUrl(rSettings->ProductionEnvironmentURL))
             {
                 return rSettings->ProductionEnvironmentURL
                     + urlPath + TEXT("?sdk=") + versionString;
@@ -41,5 +42,22 @@ namespace PlayFabCommon
                     + urlPath + TEXT("?sdk=") + versionString;
             }
         }
+
+    private:
+        static bool IsLoopbackHttpUrl(const FString& url)
+        {
+#if UE_BUILD_SHIPPING
+            return false;
+#else
+            for (const TCHAR* host : { TEXT("http://127.0.0.1"), TEXT("http://localhost") })
+            {
+                // The host has to end there, http://localhost.example.com isn't this machine
+                const int32 hostLength = FCString::Strlen(host);
+                if (url.StartsWith(host) && (url.Len() == hostLength || url[hostLength] == TEXT(':') || url[hostLength] == TEXT('/')))
+                    return true;
+            }
+            return false;
+#endif
+        }
     };
 }
@@ -33,4 +33,24 @@ public:
 
     UPROPERTY(EditAnywhere, config, Category = Settings)
     FString ConnectionString;
+
+    // Max concurrent Client API calls, further calls wait in a priority queue. 0 is unlimited
+    UPROPERTY(EditAnywhere, config, Category = Scheduler, meta = (ClampMin = 0))
+    int32 MaxInFlightClientCalls;
+
+    // Max concurrent Server API calls, further calls wait in a priority queue. 0 is unlimited
+    UPROPERTY(EditAnywhere, config, Category = Scheduler, meta = (ClampMin = 0))
+    int32 MaxInFlightServerCalls;
+
+    // Max concurrent Multiplayer, Lobby and Match API calls, further calls wait in a priority queue. 0 is unlimited
+    UPROPERTY(EditAnywhere, config, Category = Scheduler, meta = (ClampMin = 0))
+    int32 MaxInFlightMultiplayerCalls;
+
+    // Max concurrent Events API calls, further calls wait in a priority queue. 0 is unlimited
+    UPROPERTY(EditAnywhere, config, Category = Scheduler, meta = (ClampMin = 0))
+    int32 MaxInFlightEventsCalls;
+
+    // Max concurrent calls to every other API, further calls wait in a priority queue. 0 is unlimited
+    UPROPERTY(EditAnywhere, config, Category = Scheduler, meta = (ClampMin = 0))
+    int32 MaxInFlightOtherCalls;
 };
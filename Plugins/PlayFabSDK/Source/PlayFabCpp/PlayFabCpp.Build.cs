@@ -27,5 +27,11 @@ public class PlayFabCpp : ModuleRules
             "JsonUtilities",
             "PlayFabCommon"
         });
+
+        if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+        {
+            // Hosts the local stand-in endpoint used by the automation tests
+            PrivateDependencyModuleNames.Add("HTTPServer");
+        }
     }
 }
@@ -40,7 +40,7 @@ bool UPlayFabAdminAPI::AbortTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AbortTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -70,7 +70,7 @@ bool UPlayFabAdminAPI::AddLocalizedNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddLocalizedNews"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddLocalizedNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -100,7 +100,7 @@ bool UPlayFabAdminAPI::AddNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddNews"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -130,7 +130,7 @@ bool UPlayFabAdminAPI::AddPlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -160,7 +160,7 @@ bool UPlayFabAdminAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -190,7 +190,7 @@ bool UPlayFabAdminAPI::AddVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -220,7 +220,7 @@ bool UPlayFabAdminAPI::BanUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -250,7 +250,7 @@ bool UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCheckLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -280,7 +280,7 @@ bool UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateActionsOnPlayersInSegmentTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -310,7 +310,7 @@ bool UPlayFabAdminAPI::CreateCloudScriptTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateCloudScriptTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -340,7 +340,7 @@ bool UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateInsightsScheduledScalingTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -370,7 +370,7 @@ bool UPlayFabAdminAPI::CreateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -400,7 +400,7 @@ bool UPlayFabAdminAPI::CreatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -430,7 +430,7 @@ bool UPlayFabAdminAPI::CreatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -460,7 +460,7 @@ bool UPlayFabAdminAPI::CreateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/CreateSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -490,7 +490,7 @@ bool UPlayFabAdminAPI::DeleteContent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteContent"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -520,7 +520,7 @@ bool UPlayFabAdminAPI::DeleteMasterPlayerAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -550,7 +550,7 @@ bool UPlayFabAdminAPI::DeleteMembershipSubscription(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteMembershipSubscription"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteMembershipSubscriptionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteMembershipSubscriptionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMembershipSubscriptionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -580,7 +580,7 @@ bool UPlayFabAdminAPI::DeleteOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -610,7 +610,7 @@ bool UPlayFabAdminAPI::DeletePlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -640,7 +640,7 @@ bool UPlayFabAdminAPI::DeletePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -670,7 +670,7 @@ bool UPlayFabAdminAPI::DeleteSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -700,7 +700,7 @@ bool UPlayFabAdminAPI::DeleteStore(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteStore"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStoreDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -730,7 +730,7 @@ bool UPlayFabAdminAPI::DeleteTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -768,7 +768,7 @@ bool UPlayFabAdminAPI::DeleteTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTitle"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -798,7 +798,7 @@ bool UPlayFabAdminAPI::DeleteTitleDataOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDataOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -828,7 +828,7 @@ bool UPlayFabAdminAPI::ExportMasterPlayerData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportMasterPlayerDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -858,7 +858,7 @@ bool UPlayFabAdminAPI::ExportPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ExportPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnExportPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -888,7 +888,7 @@ bool UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetActionsOnPlayersInSegmentTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -926,7 +926,7 @@ bool UPlayFabAdminAPI::GetAllSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -956,7 +956,7 @@ bool UPlayFabAdminAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -986,7 +986,7 @@ bool UPlayFabAdminAPI::GetCloudScriptRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1016,7 +1016,7 @@ bool UPlayFabAdminAPI::GetCloudScriptTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1054,7 +1054,7 @@ bool UPlayFabAdminAPI::GetCloudScriptVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1084,7 +1084,7 @@ bool UPlayFabAdminAPI::GetContentList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetContentList"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1114,7 +1114,7 @@ bool UPlayFabAdminAPI::GetContentUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetContentUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1144,7 +1144,7 @@ bool UPlayFabAdminAPI::GetDataReport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetDataReport"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDataReportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1174,7 +1174,7 @@ bool UPlayFabAdminAPI::GetMatchmakerGameInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetMatchmakerGameInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetMatchmakerGameInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetMatchmakerGameInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1204,7 +1204,7 @@ bool UPlayFabAdminAPI::GetMatchmakerGameModes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetMatchmakerGameModes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetMatchmakerGameModesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameModesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1234,7 +1234,7 @@ bool UPlayFabAdminAPI::GetPlayedTitleList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayedTitleList"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayedTitleListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1264,7 +1264,7 @@ bool UPlayFabAdminAPI::GetPlayerIdFromAuthToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerIdFromAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1294,7 +1294,7 @@ bool UPlayFabAdminAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1324,7 +1324,7 @@ bool UPlayFabAdminAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1362,7 +1362,7 @@ bool UPlayFabAdminAPI::GetPlayerSharedSecrets(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSharedSecretsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1392,7 +1392,7 @@ bool UPlayFabAdminAPI::GetPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1430,7 +1430,7 @@ bool UPlayFabAdminAPI::GetPlayerStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1460,7 +1460,7 @@ bool UPlayFabAdminAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1490,7 +1490,7 @@ bool UPlayFabAdminAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1520,7 +1520,7 @@ bool UPlayFabAdminAPI::GetPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPolicy"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1550,7 +1550,7 @@ bool UPlayFabAdminAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1580,7 +1580,7 @@ bool UPlayFabAdminAPI::GetRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1610,7 +1610,7 @@ bool UPlayFabAdminAPI::GetSegmentExport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetSegmentExport"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetSegmentExportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentExportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1640,7 +1640,7 @@ bool UPlayFabAdminAPI::GetSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1670,7 +1670,7 @@ bool UPlayFabAdminAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1700,7 +1700,7 @@ bool UPlayFabAdminAPI::GetTaskInstances(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTaskInstances"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTaskInstancesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1730,7 +1730,7 @@ bool UPlayFabAdminAPI::GetTasks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTasks"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTasksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1760,7 +1760,7 @@ bool UPlayFabAdminAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1790,7 +1790,7 @@ bool UPlayFabAdminAPI::GetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1820,7 +1820,7 @@ bool UPlayFabAdminAPI::GetUserAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1850,7 +1850,7 @@ bool UPlayFabAdminAPI::GetUserBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1880,7 +1880,7 @@ bool UPlayFabAdminAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1910,7 +1910,7 @@ bool UPlayFabAdminAPI::GetUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1940,7 +1940,7 @@ bool UPlayFabAdminAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1970,7 +1970,7 @@ bool UPlayFabAdminAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2000,7 +2000,7 @@ bool UPlayFabAdminAPI::GetUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2030,7 +2030,7 @@ bool UPlayFabAdminAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2060,7 +2060,7 @@ bool UPlayFabAdminAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2090,7 +2090,7 @@ bool UPlayFabAdminAPI::GrantItemsToUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2120,7 +2120,7 @@ bool UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2150,7 +2150,7 @@ bool UPlayFabAdminAPI::IncrementPlayerStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementPlayerStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2188,7 +2188,7 @@ bool UPlayFabAdminAPI::ListOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ListOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2226,7 +2226,7 @@ bool UPlayFabAdminAPI::ListVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2256,7 +2256,7 @@ bool UPlayFabAdminAPI::ModifyServerBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ModifyServerBuild"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnModifyServerBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnModifyServerBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyServerBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2286,7 +2286,7 @@ bool UPlayFabAdminAPI::RefundPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RefundPurchase"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefundPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2316,7 +2316,7 @@ bool UPlayFabAdminAPI::RemovePlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2346,7 +2346,7 @@ bool UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2376,7 +2376,7 @@ bool UPlayFabAdminAPI::ResetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2406,7 +2406,7 @@ bool UPlayFabAdminAPI::ResetPassword(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetPassword"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetPasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2436,7 +2436,7 @@ bool UPlayFabAdminAPI::ResetUserStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResetUserStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetUserStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2466,7 +2466,7 @@ bool UPlayFabAdminAPI::ResolvePurchaseDispute(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResolvePurchaseDisputeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2496,7 +2496,7 @@ bool UPlayFabAdminAPI::RevokeAllBansForUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2526,7 +2526,7 @@ bool UPlayFabAdminAPI::RevokeBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2556,7 +2556,7 @@ bool UPlayFabAdminAPI::RevokeInventoryItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2586,7 +2586,7 @@ bool UPlayFabAdminAPI::RevokeInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2616,7 +2616,7 @@ bool UPlayFabAdminAPI::RunTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/RunTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRunTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2646,7 +2646,7 @@ bool UPlayFabAdminAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2676,7 +2676,7 @@ bool UPlayFabAdminAPI::SetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2706,7 +2706,7 @@ bool UPlayFabAdminAPI::SetMembershipOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetMembershipOverride"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetMembershipOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetMembershipOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetMembershipOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2736,7 +2736,7 @@ bool UPlayFabAdminAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2766,7 +2766,7 @@ bool UPlayFabAdminAPI::SetPublishedRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPublishedRevision"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublishedRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2796,7 +2796,7 @@ bool UPlayFabAdminAPI::SetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2826,7 +2826,7 @@ bool UPlayFabAdminAPI::SetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2856,7 +2856,7 @@ bool UPlayFabAdminAPI::SetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2886,7 +2886,7 @@ bool UPlayFabAdminAPI::SetTitleDataAndOverrides(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataAndOverridesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2916,7 +2916,7 @@ bool UPlayFabAdminAPI::SetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2946,7 +2946,7 @@ bool UPlayFabAdminAPI::SetupPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SetupPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetupPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2976,7 +2976,7 @@ bool UPlayFabAdminAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3006,7 +3006,7 @@ bool UPlayFabAdminAPI::UpdateBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3036,7 +3036,7 @@ bool UPlayFabAdminAPI::UpdateCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3066,7 +3066,7 @@ bool UPlayFabAdminAPI::UpdateCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3096,7 +3096,7 @@ bool UPlayFabAdminAPI::UpdateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3126,7 +3126,7 @@ bool UPlayFabAdminAPI::UpdatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3156,7 +3156,7 @@ bool UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3186,7 +3186,7 @@ bool UPlayFabAdminAPI::UpdatePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdatePolicy"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3216,7 +3216,7 @@ bool UPlayFabAdminAPI::UpdateRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3246,7 +3246,7 @@ bool UPlayFabAdminAPI::UpdateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3276,7 +3276,7 @@ bool UPlayFabAdminAPI::UpdateStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3306,7 +3306,7 @@ bool UPlayFabAdminAPI::UpdateTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateTask"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3336,7 +3336,7 @@ bool UPlayFabAdminAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3366,7 +3366,7 @@ bool UPlayFabAdminAPI::UpdateUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3396,7 +3396,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3426,7 +3426,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3456,7 +3456,7 @@ bool UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3486,7 +3486,7 @@ bool UPlayFabAdminAPI::UpdateUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3516,7 +3516,7 @@ bool UPlayFabAdminAPI::UpdateUserTitleDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
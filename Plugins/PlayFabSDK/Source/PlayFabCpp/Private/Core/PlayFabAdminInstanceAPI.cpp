@@ -90,7 +90,7 @@ bool UPlayFabAdminInstanceAPI::AbortTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AbortTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -120,7 +120,7 @@ bool UPlayFabAdminInstanceAPI::AddLocalizedNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddLocalizedNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddLocalizedNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -150,7 +150,7 @@ bool UPlayFabAdminInstanceAPI::AddNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -180,7 +180,7 @@ bool UPlayFabAdminInstanceAPI::AddPlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -210,7 +210,7 @@ bool UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -240,7 +240,7 @@ bool UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -270,7 +270,7 @@ bool UPlayFabAdminInstanceAPI::BanUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -300,7 +300,7 @@ bool UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCheckLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -330,7 +330,7 @@ bool UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateActionsOnPlayersInSegmentTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -360,7 +360,7 @@ bool UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateCloudScriptTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -390,7 +390,7 @@ bool UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateInsightsScheduledScalingTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -420,7 +420,7 @@ bool UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -450,7 +450,7 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -480,7 +480,7 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -510,7 +510,7 @@ bool UPlayFabAdminInstanceAPI::CreateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -540,7 +540,7 @@ bool UPlayFabAdminInstanceAPI::DeleteContent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteContent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -570,7 +570,7 @@ bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -600,7 +600,7 @@ bool UPlayFabAdminInstanceAPI::DeleteMembershipSubscription(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMembershipSubscription"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMembershipSubscriptionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMembershipSubscriptionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMembershipSubscriptionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -630,7 +630,7 @@ bool UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -660,7 +660,7 @@ bool UPlayFabAdminInstanceAPI::DeletePlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -690,7 +690,7 @@ bool UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -720,7 +720,7 @@ bool UPlayFabAdminInstanceAPI::DeleteSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -750,7 +750,7 @@ bool UPlayFabAdminInstanceAPI::DeleteStore(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteStore"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStoreDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -780,7 +780,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -818,7 +818,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTitle(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitle"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -848,7 +848,7 @@ bool UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDataOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -878,7 +878,7 @@ bool UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportMasterPlayerDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -908,7 +908,7 @@ bool UPlayFabAdminInstanceAPI::ExportPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnExportPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnExportPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -938,7 +938,7 @@ bool UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetActionsOnPlayersInSegmentTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -976,7 +976,7 @@ bool UPlayFabAdminInstanceAPI::GetAllSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1006,7 +1006,7 @@ bool UPlayFabAdminInstanceAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1036,7 +1036,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1066,7 +1066,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1104,7 +1104,7 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1134,7 +1134,7 @@ bool UPlayFabAdminInstanceAPI::GetContentList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1164,7 +1164,7 @@ bool UPlayFabAdminInstanceAPI::GetContentUploadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1194,7 +1194,7 @@ bool UPlayFabAdminInstanceAPI::GetDataReport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetDataReport"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDataReportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1224,7 +1224,7 @@ bool UPlayFabAdminInstanceAPI::GetMatchmakerGameInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1254,7 +1254,7 @@ bool UPlayFabAdminInstanceAPI::GetMatchmakerGameModes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameModes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameModesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1284,7 +1284,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayedTitleList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayedTitleList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayedTitleListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1314,7 +1314,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerIdFromAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1344,7 +1344,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1374,7 +1374,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1412,7 +1412,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSharedSecretsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1442,7 +1442,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayersInSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1480,7 +1480,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1510,7 +1510,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1540,7 +1540,7 @@ bool UPlayFabAdminInstanceAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1570,7 +1570,7 @@ bool UPlayFabAdminInstanceAPI::GetPolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1600,7 +1600,7 @@ bool UPlayFabAdminInstanceAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1630,7 +1630,7 @@ bool UPlayFabAdminInstanceAPI::GetRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1660,7 +1660,7 @@ bool UPlayFabAdminInstanceAPI::GetSegmentExport(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegmentExport"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetSegmentExportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetSegmentExportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentExportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1690,7 +1690,7 @@ bool UPlayFabAdminInstanceAPI::GetSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1720,7 +1720,7 @@ bool UPlayFabAdminInstanceAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1750,7 +1750,7 @@ bool UPlayFabAdminInstanceAPI::GetTaskInstances(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTaskInstances"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTaskInstancesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1780,7 +1780,7 @@ bool UPlayFabAdminInstanceAPI::GetTasks(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTasks"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTasksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1810,7 +1810,7 @@ bool UPlayFabAdminInstanceAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1840,7 +1840,7 @@ bool UPlayFabAdminInstanceAPI::GetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1870,7 +1870,7 @@ bool UPlayFabAdminInstanceAPI::GetUserAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1900,7 +1900,7 @@ bool UPlayFabAdminInstanceAPI::GetUserBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1930,7 +1930,7 @@ bool UPlayFabAdminInstanceAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1960,7 +1960,7 @@ bool UPlayFabAdminInstanceAPI::GetUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1990,7 +1990,7 @@ bool UPlayFabAdminInstanceAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2020,7 +2020,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2050,7 +2050,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2080,7 +2080,7 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2110,7 +2110,7 @@ bool UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2140,7 +2140,7 @@ bool UPlayFabAdminInstanceAPI::GrantItemsToUsers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2170,7 +2170,7 @@ bool UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2200,7 +2200,7 @@ bool UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementPlayerStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2238,7 +2238,7 @@ bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2276,7 +2276,7 @@ bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2306,7 +2306,7 @@ bool UPlayFabAdminInstanceAPI::ModifyServerBuild(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ModifyServerBuild"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnModifyServerBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnModifyServerBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyServerBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2336,7 +2336,7 @@ bool UPlayFabAdminInstanceAPI::RefundPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RefundPurchase"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefundPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2366,7 +2366,7 @@ bool UPlayFabAdminInstanceAPI::RemovePlayerTag(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2396,7 +2396,7 @@ bool UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2426,7 +2426,7 @@ bool UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2456,7 +2456,7 @@ bool UPlayFabAdminInstanceAPI::ResetPassword(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetPassword"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetPasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2486,7 +2486,7 @@ bool UPlayFabAdminInstanceAPI::ResetUserStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetUserStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetUserStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2516,7 +2516,7 @@ bool UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResolvePurchaseDisputeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2546,7 +2546,7 @@ bool UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2576,7 +2576,7 @@ bool UPlayFabAdminInstanceAPI::RevokeBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2606,7 +2606,7 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2636,7 +2636,7 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2666,7 +2666,7 @@ bool UPlayFabAdminInstanceAPI::RunTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RunTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRunTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2696,7 +2696,7 @@ bool UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2726,7 +2726,7 @@ bool UPlayFabAdminInstanceAPI::SetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2756,7 +2756,7 @@ bool UPlayFabAdminInstanceAPI::SetMembershipOverride(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetMembershipOverride"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetMembershipOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetMembershipOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetMembershipOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2786,7 +2786,7 @@ bool UPlayFabAdminInstanceAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2816,7 +2816,7 @@ bool UPlayFabAdminInstanceAPI::SetPublishedRevision(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublishedRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublishedRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2846,7 +2846,7 @@ bool UPlayFabAdminInstanceAPI::SetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2876,7 +2876,7 @@ bool UPlayFabAdminInstanceAPI::SetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2906,7 +2906,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2936,7 +2936,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataAndOverridesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2966,7 +2966,7 @@ bool UPlayFabAdminInstanceAPI::SetTitleInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2996,7 +2996,7 @@ bool UPlayFabAdminInstanceAPI::SetupPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetupPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetupPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3026,7 +3026,7 @@ bool UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3056,7 +3056,7 @@ bool UPlayFabAdminInstanceAPI::UpdateBans(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3086,7 +3086,7 @@ bool UPlayFabAdminInstanceAPI::UpdateCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3116,7 +3116,7 @@ bool UPlayFabAdminInstanceAPI::UpdateCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3146,7 +3146,7 @@ bool UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3176,7 +3176,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3206,7 +3206,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3236,7 +3236,7 @@ bool UPlayFabAdminInstanceAPI::UpdatePolicy(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3266,7 +3266,7 @@ bool UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3296,7 +3296,7 @@ bool UPlayFabAdminInstanceAPI::UpdateSegment(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3326,7 +3326,7 @@ bool UPlayFabAdminInstanceAPI::UpdateStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3356,7 +3356,7 @@ bool UPlayFabAdminInstanceAPI::UpdateTask(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3386,7 +3386,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3416,7 +3416,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3446,7 +3446,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3476,7 +3476,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3506,7 +3506,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3536,7 +3536,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3566,7 +3566,7 @@ bool UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
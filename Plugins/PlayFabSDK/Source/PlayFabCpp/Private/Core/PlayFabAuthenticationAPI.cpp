@@ -48,7 +48,7 @@ bool UPlayFabAuthenticationAPI::GetEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAuthenticationAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -80,7 +80,7 @@ bool UPlayFabAuthenticationAPI::ValidateEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAuthenticationAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -99,7 +99,7 @@ bool UPlayFabAuthenticationInstanceAPI::GetEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -131,7 +131,7 @@ bool UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
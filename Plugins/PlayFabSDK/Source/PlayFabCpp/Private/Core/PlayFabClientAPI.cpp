@@ -47,7 +47,7 @@ bool UPlayFabClientAPI::AcceptTrade(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AcceptTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -78,7 +78,7 @@ bool UPlayFabClientAPI::AddFriend(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -109,7 +109,7 @@ bool UPlayFabClientAPI::AddGenericID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -140,7 +140,7 @@ bool UPlayFabClientAPI::AddOrUpdateContactEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddOrUpdateContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -171,7 +171,7 @@ bool UPlayFabClientAPI::AddSharedGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -202,7 +202,7 @@ bool UPlayFabClientAPI::AddUsernamePassword(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUsernamePassword"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUsernamePasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -233,7 +233,7 @@ bool UPlayFabClientAPI::AddUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -264,7 +264,7 @@ bool UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAndroidDevicePushNotificationRegistrationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -295,7 +295,7 @@ bool UPlayFabClientAPI::AttributeInstall(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AttributeInstall"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAttributeInstallResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnAttributeInstallResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAttributeInstallDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -326,7 +326,7 @@ bool UPlayFabClientAPI::CancelTrade(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CancelTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -357,7 +357,7 @@ bool UPlayFabClientAPI::ConfirmPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConfirmPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConfirmPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -388,7 +388,7 @@ bool UPlayFabClientAPI::ConsumeItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -419,7 +419,7 @@ bool UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeMicrosoftStoreEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -450,7 +450,7 @@ bool UPlayFabClientAPI::ConsumePS5Entitlements(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePS5EntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -481,7 +481,7 @@ bool UPlayFabClientAPI::ConsumePSNEntitlements(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePSNEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -512,7 +512,7 @@ bool UPlayFabClientAPI::ConsumeXboxEntitlements(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeXboxEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -543,7 +543,7 @@ bool UPlayFabClientAPI::CreateSharedGroup(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CreateSharedGroup"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -574,7 +574,7 @@ bool UPlayFabClientAPI::ExecuteCloudScript(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ExecuteCloudScript"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -605,7 +605,7 @@ bool UPlayFabClientAPI::GetAccountInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAccountInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -636,7 +636,7 @@ bool UPlayFabClientAPI::GetAdPlacements(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAdPlacements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAdPlacementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -667,7 +667,7 @@ bool UPlayFabClientAPI::GetAllUsersCharacters(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -698,7 +698,7 @@ bool UPlayFabClientAPI::GetCatalogItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCatalogItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -729,7 +729,7 @@ bool UPlayFabClientAPI::GetCharacterData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -760,7 +760,7 @@ bool UPlayFabClientAPI::GetCharacterInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -791,7 +791,7 @@ bool UPlayFabClientAPI::GetCharacterLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -822,7 +822,7 @@ bool UPlayFabClientAPI::GetCharacterReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -853,7 +853,7 @@ bool UPlayFabClientAPI::GetCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -884,7 +884,7 @@ bool UPlayFabClientAPI::GetContentDownloadUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -915,7 +915,7 @@ bool UPlayFabClientAPI::GetCurrentGames(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCurrentGames"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCurrentGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetCurrentGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCurrentGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -946,7 +946,7 @@ bool UPlayFabClientAPI::GetFriendLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -977,7 +977,7 @@ bool UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1008,7 +1008,7 @@ bool UPlayFabClientAPI::GetFriendsList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendsList"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1039,7 +1039,7 @@ bool UPlayFabClientAPI::GetGameServerRegions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetGameServerRegions"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetGameServerRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetGameServerRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGameServerRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1070,7 +1070,7 @@ bool UPlayFabClientAPI::GetLeaderboard(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1101,7 +1101,7 @@ bool UPlayFabClientAPI::GetLeaderboardAroundCharacter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1132,7 +1132,7 @@ bool UPlayFabClientAPI::GetLeaderboardAroundPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1163,7 +1163,7 @@ bool UPlayFabClientAPI::GetLeaderboardForUserCharacters(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1194,7 +1194,7 @@ bool UPlayFabClientAPI::GetPaymentToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPaymentToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPaymentTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1225,7 +1225,7 @@ bool UPlayFabClientAPI::GetPhotonAuthenticationToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPhotonAuthenticationTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1256,7 +1256,7 @@ bool UPlayFabClientAPI::GetPlayerCombinedInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1287,7 +1287,7 @@ bool UPlayFabClientAPI::GetPlayerProfile(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerProfile"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1326,7 +1326,7 @@ bool UPlayFabClientAPI::GetPlayerSegments(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerSegments"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1357,7 +1357,7 @@ bool UPlayFabClientAPI::GetPlayerStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1388,7 +1388,7 @@ bool UPlayFabClientAPI::GetPlayerStatisticVersions(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1419,7 +1419,7 @@ bool UPlayFabClientAPI::GetPlayerTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1450,7 +1450,7 @@ bool UPlayFabClientAPI::GetPlayerTrades(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTrades"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTradesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1481,7 +1481,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1512,7 +1512,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1543,7 +1543,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGameCenterIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1574,7 +1574,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1605,7 +1605,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGoogleIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1636,7 +1636,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromKongregateIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1667,7 +1667,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoServiceAccountIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoServiceAccountIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoServiceAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoServiceAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1698,7 +1698,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1729,7 +1729,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1760,7 +1760,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1791,7 +1791,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1822,7 +1822,7 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1853,7 +1853,7 @@ bool UPlayFabClientAPI::GetPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1884,7 +1884,7 @@ bool UPlayFabClientAPI::GetPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1915,7 +1915,7 @@ bool UPlayFabClientAPI::GetSharedGroupData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1946,7 +1946,7 @@ bool UPlayFabClientAPI::GetStoreItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetStoreItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -1985,7 +1985,7 @@ bool UPlayFabClientAPI::GetTime(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTime"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2016,7 +2016,7 @@ bool UPlayFabClientAPI::GetTitleData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2047,7 +2047,7 @@ bool UPlayFabClientAPI::GetTitleNews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleNews"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2073,7 +2073,7 @@ bool UPlayFabClientAPI::GetTitlePublicKey(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitlePublicKey"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePublicKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2104,7 +2104,7 @@ bool UPlayFabClientAPI::GetTradeStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTradeStatus"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTradeStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2135,7 +2135,7 @@ bool UPlayFabClientAPI::GetUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2166,7 +2166,7 @@ bool UPlayFabClientAPI::GetUserInventory(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2197,7 +2197,7 @@ bool UPlayFabClientAPI::GetUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2228,7 +2228,7 @@ bool UPlayFabClientAPI::GetUserPublisherReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2259,7 +2259,7 @@ bool UPlayFabClientAPI::GetUserReadOnlyData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2290,7 +2290,7 @@ bool UPlayFabClientAPI::GrantCharacterToUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GrantCharacterToUser"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2321,7 +2321,7 @@ bool UPlayFabClientAPI::LinkAndroidDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2352,7 +2352,7 @@ bool UPlayFabClientAPI::LinkApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2383,7 +2383,7 @@ bool UPlayFabClientAPI::LinkCustomID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2414,7 +2414,7 @@ bool UPlayFabClientAPI::LinkFacebookAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2445,7 +2445,7 @@ bool UPlayFabClientAPI::LinkFacebookInstantGamesId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2476,7 +2476,7 @@ bool UPlayFabClientAPI::LinkGameCenterAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2507,7 +2507,7 @@ bool UPlayFabClientAPI::LinkGoogleAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2538,7 +2538,7 @@ bool UPlayFabClientAPI::LinkIOSDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2569,7 +2569,7 @@ bool UPlayFabClientAPI::LinkKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2600,7 +2600,7 @@ bool UPlayFabClientAPI::LinkNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2631,7 +2631,7 @@ bool UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2662,7 +2662,7 @@ bool UPlayFabClientAPI::LinkOpenIdConnect(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2693,7 +2693,7 @@ bool UPlayFabClientAPI::LinkPSNAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2724,7 +2724,7 @@ bool UPlayFabClientAPI::LinkSteamAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2755,7 +2755,7 @@ bool UPlayFabClientAPI::LinkTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2786,7 +2786,7 @@ bool UPlayFabClientAPI::LinkXboxAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2814,7 +2814,7 @@ bool UPlayFabClientAPI::LoginWithAndroidDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2856,7 +2856,7 @@ bool UPlayFabClientAPI::LoginWithApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithApple"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2898,7 +2898,7 @@ bool UPlayFabClientAPI::LoginWithCustomID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithCustomID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2940,7 +2940,7 @@ bool UPlayFabClientAPI::LoginWithEmailAddress(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithEmailAddress"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithEmailAddressDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -2982,7 +2982,7 @@ bool UPlayFabClientAPI::LoginWithFacebook(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebook"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3024,7 +3024,7 @@ bool UPlayFabClientAPI::LoginWithFacebookInstantGamesId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3066,7 +3066,7 @@ bool UPlayFabClientAPI::LoginWithGameCenter(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGameCenter"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGameCenterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3108,7 +3108,7 @@ bool UPlayFabClientAPI::LoginWithGoogleAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3150,7 +3150,7 @@ bool UPlayFabClientAPI::LoginWithIOSDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3192,7 +3192,7 @@ bool UPlayFabClientAPI::LoginWithKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithKongregate"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3234,7 +3234,7 @@ bool UPlayFabClientAPI::LoginWithNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3276,7 +3276,7 @@ bool UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3318,7 +3318,7 @@ bool UPlayFabClientAPI::LoginWithOpenIdConnect(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3360,7 +3360,7 @@ bool UPlayFabClientAPI::LoginWithPlayFab(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPlayFab"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPlayFabDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3402,7 +3402,7 @@ bool UPlayFabClientAPI::LoginWithPSN(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPSN"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3444,7 +3444,7 @@ bool UPlayFabClientAPI::LoginWithSteam(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithSteam"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3486,7 +3486,7 @@ bool UPlayFabClientAPI::LoginWithTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithTwitch"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3528,7 +3528,7 @@ bool UPlayFabClientAPI::LoginWithXbox(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithXbox"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3573,7 +3573,7 @@ bool UPlayFabClientAPI::Matchmake(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/Matchmake"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnMatchmakeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnMatchmakeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMatchmakeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3604,7 +3604,7 @@ bool UPlayFabClientAPI::OpenTrade(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/OpenTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FOpenTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3635,7 +3635,7 @@ bool UPlayFabClientAPI::PayForPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PayForPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPayForPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3666,7 +3666,7 @@ bool UPlayFabClientAPI::PurchaseItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PurchaseItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3697,7 +3697,7 @@ bool UPlayFabClientAPI::RedeemCoupon(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RedeemCoupon"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3728,7 +3728,7 @@ bool UPlayFabClientAPI::RefreshPSNAuthToken(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshPSNAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3759,7 +3759,7 @@ bool UPlayFabClientAPI::RegisterForIOSPushNotification(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterForIOSPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3787,7 +3787,7 @@ bool UPlayFabClientAPI::RegisterPlayFabUser(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterPlayFabUser"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterPlayFabUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3822,7 +3822,7 @@ bool UPlayFabClientAPI::RemoveContactEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3853,7 +3853,7 @@ bool UPlayFabClientAPI::RemoveFriend(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3884,7 +3884,7 @@ bool UPlayFabClientAPI::RemoveGenericID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3915,7 +3915,7 @@ bool UPlayFabClientAPI::RemoveSharedGroupMembers(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3946,7 +3946,7 @@ bool UPlayFabClientAPI::ReportAdActivity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -3977,7 +3977,7 @@ bool UPlayFabClientAPI::ReportDeviceInfo(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportDeviceInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportDeviceInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4008,7 +4008,7 @@ bool UPlayFabClientAPI::ReportPlayer(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4039,7 +4039,7 @@ bool UPlayFabClientAPI::RestoreIOSPurchases(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RestoreIOSPurchases"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRestoreIOSPurchasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4070,7 +4070,7 @@ bool UPlayFabClientAPI::RewardAdActivity(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RewardAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRewardAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4096,7 +4096,7 @@ bool UPlayFabClientAPI::SendAccountRecoveryEmail(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONString(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4127,7 +4127,7 @@ bool UPlayFabClientAPI::SetFriendTags(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetFriendTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4158,7 +4158,7 @@ bool UPlayFabClientAPI::SetPlayerSecret(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetPlayerSecret"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4189,7 +4189,7 @@ bool UPlayFabClientAPI::StartPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4220,7 +4220,7 @@ bool UPlayFabClientAPI::SubtractUserVirtualCurrency(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4251,7 +4251,7 @@ bool UPlayFabClientAPI::UnlinkAndroidDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4282,7 +4282,7 @@ bool UPlayFabClientAPI::UnlinkApple(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4313,7 +4313,7 @@ bool UPlayFabClientAPI::UnlinkCustomID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4344,7 +4344,7 @@ bool UPlayFabClientAPI::UnlinkFacebookAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4375,7 +4375,7 @@ bool UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4406,7 +4406,7 @@ bool UPlayFabClientAPI::UnlinkGameCenterAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4437,7 +4437,7 @@ bool UPlayFabClientAPI::UnlinkGoogleAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4468,7 +4468,7 @@ bool UPlayFabClientAPI::UnlinkIOSDeviceID(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4499,7 +4499,7 @@ bool UPlayFabClientAPI::UnlinkKongregate(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4530,7 +4530,7 @@ bool UPlayFabClientAPI::UnlinkNintendoServiceAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4561,7 +4561,7 @@ bool UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4592,7 +4592,7 @@ bool UPlayFabClientAPI::UnlinkOpenIdConnect(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4623,7 +4623,7 @@ bool UPlayFabClientAPI::UnlinkPSNAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4654,7 +4654,7 @@ bool UPlayFabClientAPI::UnlinkSteamAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4685,7 +4685,7 @@ bool UPlayFabClientAPI::UnlinkTwitch(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4716,7 +4716,7 @@ bool UPlayFabClientAPI::UnlinkXboxAccount(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4747,7 +4747,7 @@ bool UPlayFabClientAPI::UnlockContainerInstance(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerInstance"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4778,7 +4778,7 @@ bool UPlayFabClientAPI::UnlockContainerItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4809,7 +4809,7 @@ bool UPlayFabClientAPI::UpdateAvatarUrl(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4840,7 +4840,7 @@ bool UPlayFabClientAPI::UpdateCharacterData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4871,7 +4871,7 @@ bool UPlayFabClientAPI::UpdateCharacterStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4902,7 +4902,7 @@ bool UPlayFabClientAPI::UpdatePlayerStatistics(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4933,7 +4933,7 @@ bool UPlayFabClientAPI::UpdateSharedGroupData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4964,7 +4964,7 @@ bool UPlayFabClientAPI::UpdateUserData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -4995,7 +4995,7 @@ bool UPlayFabClientAPI::UpdateUserPublisherData(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5026,7 +5026,7 @@ bool UPlayFabClientAPI::UpdateUserTitleDisplayName(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5057,7 +5057,7 @@ bool UPlayFabClientAPI::ValidateAmazonIAPReceipt(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateAmazonIAPReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5088,7 +5088,7 @@ bool UPlayFabClientAPI::ValidateGooglePlayPurchase(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateGooglePlayPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5119,7 +5119,7 @@ bool UPlayFabClientAPI::ValidateIOSReceipt(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateIOSReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateIOSReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5150,7 +5150,7 @@ bool UPlayFabClientAPI::ValidateWindowsStoreReceipt(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateWindowsStoreReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5181,7 +5181,7 @@ bool UPlayFabClientAPI::WriteCharacterEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteCharacterEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5212,7 +5212,7 @@ bool UPlayFabClientAPI::WritePlayerEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WritePlayerEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -5243,7 +5243,7 @@ bool UPlayFabClientAPI::WriteTitleEvent(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteTitleEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabClientAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
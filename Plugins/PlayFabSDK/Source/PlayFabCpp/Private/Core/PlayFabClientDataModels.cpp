@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabClientDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::ClientModels;
@@ -2020,6 +2021,59 @@ bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCatalogItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Bundle"))
+            reader.ReadModel(Bundle);
+        else if (reader.IsField("CanBecomeCharacter"))
+            reader.ReadBool(CanBecomeCharacter);
+        else if (reader.IsField("CatalogVersion"))
+            reader.ReadInternedString(CatalogVersion);
+        else if (reader.IsField("Consumable"))
+            reader.ReadModel(Consumable);
+        else if (reader.IsField("Container"))
+            reader.ReadModel(Container);
+        else if (reader.IsField("CustomData"))
+            reader.ReadString(CustomData);
+        else if (reader.IsField("Description"))
+            reader.ReadString(Description);
+        else if (reader.IsField("DisplayName"))
+            reader.ReadString(DisplayName);
+        else if (reader.IsField("InitialLimitedEditionCount"))
+            reader.ReadNumber(InitialLimitedEditionCount);
+        else if (reader.IsField("IsLimitedEdition"))
+            reader.ReadBool(IsLimitedEdition);
+        else if (reader.IsField("IsStackable"))
+            reader.ReadBool(IsStackable);
+        else if (reader.IsField("IsTradable"))
+            reader.ReadBool(IsTradable);
+        else if (reader.IsField("ItemClass"))
+            reader.ReadInternedString(ItemClass);
+        else if (reader.IsField("ItemId"))
+            reader.ReadString(ItemId);
+        else if (reader.IsField("ItemImageUrl"))
+            reader.ReadString(ItemImageUrl);
+        else if (reader.IsField("RealCurrencyPrices"))
+            reader.ReadNumberMap(RealCurrencyPrices);
+        else if (reader.IsField("Tags"))
+            reader.ReadStringArray(Tags);
+        else if (reader.IsField("VirtualCurrencyPrices"))
+            reader.ReadNumberMap(VirtualCurrencyPrices);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FItemInstance::~FItemInstance()
 {
 
@@ -2232,6 +2286,67 @@ bool PlayFab::ClientModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+            reader.ReadString(Annotation);
+        else if (reader.IsField("BundleContents"))
+            reader.ReadStringArray(BundleContents);
+        else if (reader.IsField("BundleParent"))
+            reader.ReadString(BundleParent);
+        else if (reader.IsField("CatalogVersion"))
+            reader.ReadInternedString(CatalogVersion);
+        else if (reader.IsField("CustomData"))
+            reader.ReadStringMap(CustomData);
+        else if (reader.IsField("DisplayName"))
+            reader.ReadString(DisplayName);
+        else if (reader.IsField("Expiration"))
+        {
+            FDateTime TmpValue;
+            reader.ReadDatetime(TmpValue);
+            Expiration = TmpValue;
+        }
+        else if (reader.IsField("ItemClass"))
+            reader.ReadInternedString(ItemClass);
+        else if (reader.IsField("ItemId"))
+            reader.ReadInternedString(ItemId);
+        else if (reader.IsField("ItemInstanceId"))
+            reader.ReadString(ItemInstanceId);
+        else if (reader.IsField("PurchaseDate"))
+        {
+            FDateTime TmpValue;
+            reader.ReadDatetime(TmpValue);
+            PurchaseDate = TmpValue;
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            int32 TmpValue;
+            if (reader.ReadNumber(TmpValue)) { RemainingUses = TmpValue; }
+        }
+        else if (reader.IsField("UnitCurrency"))
+            reader.ReadInternedString(UnitCurrency);
+        else if (reader.IsField("UnitPrice"))
+            reader.ReadNumber(UnitPrice);
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            int32 TmpValue;
+            if (reader.ReadNumber(TmpValue)) { UsesIncrementedBy = TmpValue; }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FCharacterInventory::~FCharacterInventory()
 {
 
@@ -8372,6 +8487,25 @@ bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Catalog"))
+            reader.ReadModelArray(Catalog);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetCharacterDataRequest::~FGetCharacterDataRequest()
 {
 
@@ -8529,6 +8663,33 @@ bool PlayFab::ClientModels::FUserDataRecord::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+            reader.ReadDatetime(LastUpdated);
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            reader.ReadInternedString(TmpValue);
+            Permission = readUserDataPermissionFromValue(TmpValue);
+        }
+        else if (reader.IsField("Value"))
+            reader.ReadString(Value);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetCharacterDataResult::~FGetCharacterDataResult()
 {
 
@@ -9502,6 +9663,33 @@ bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("DisplayName"))
+            reader.ReadString(DisplayName);
+        else if (reader.IsField("PlayFabId"))
+            reader.ReadString(PlayFabId);
+        else if (reader.IsField("Position"))
+            reader.ReadNumber(Position);
+        else if (reader.IsField("Profile"))
+            reader.ReadModel(Profile);
+        else if (reader.IsField("StatValue"))
+            reader.ReadNumber(StatValue);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::~FGetFriendLeaderboardAroundPlayerResult()
 {
 
@@ -10383,6 +10571,33 @@ bool PlayFab::ClientModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+            reader.ReadModelArray(Leaderboard);
+        else if (reader.IsField("NextReset"))
+        {
+            FDateTime TmpValue;
+            reader.ReadDatetime(TmpValue);
+            NextReset = TmpValue;
+        }
+        else if (reader.IsField("Version"))
+            reader.ReadNumber(Version);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetPaymentTokenRequest::~FGetPaymentTokenRequest()
 {
 
@@ -11055,6 +11270,49 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("AccountInfo"))
+            reader.ReadModel(AccountInfo);
+        else if (reader.IsField("CharacterInventories"))
+            reader.ReadModelArray(CharacterInventories);
+        else if (reader.IsField("CharacterList"))
+            reader.ReadModelArray(CharacterList);
+        else if (reader.IsField("PlayerProfile"))
+            reader.ReadModel(PlayerProfile);
+        else if (reader.IsField("PlayerStatistics"))
+            reader.ReadModelArray(PlayerStatistics);
+        else if (reader.IsField("TitleData"))
+            reader.ReadStringMap(TitleData);
+        else if (reader.IsField("UserData"))
+            reader.ReadModelMap(UserData);
+        else if (reader.IsField("UserDataVersion"))
+            reader.ReadNumber(UserDataVersion);
+        else if (reader.IsField("UserInventory"))
+            reader.ReadModelArray(UserInventory);
+        else if (reader.IsField("UserReadOnlyData"))
+            reader.ReadModelMap(UserReadOnlyData);
+        else if (reader.IsField("UserReadOnlyDataVersion"))
+            reader.ReadNumber(UserReadOnlyDataVersion);
+        else if (reader.IsField("UserVirtualCurrency"))
+            reader.ReadNumberMap(UserVirtualCurrency);
+        else if (reader.IsField("UserVirtualCurrencyRechargeTimes"))
+            reader.ReadModelMap(UserVirtualCurrencyRechargeTimes);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetPlayerCombinedInfoResult::~FGetPlayerCombinedInfoResult()
 {
     //if (InfoResultPayload != nullptr) delete InfoResultPayload;
@@ -11100,6 +11358,27 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("InfoResultPayload"))
+            reader.ReadModel(InfoResultPayload);
+        else if (reader.IsField("PlayFabId"))
+            reader.ReadString(PlayFabId);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetPlayerProfileRequest::~FGetPlayerProfileRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
@@ -14205,6 +14484,27 @@ bool PlayFab::ClientModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+            reader.ReadModelMap(Data);
+        else if (reader.IsField("DataVersion"))
+            reader.ReadNumber(DataVersion);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGetUserInventoryRequest::~FGetUserInventoryRequest()
 {
 
@@ -14321,6 +14621,29 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.BeginObject())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.TryReadNull())
+            continue;
+
+        if (reader.IsField("Inventory"))
+            reader.ReadModelArray(Inventory);
+        else if (reader.IsField("VirtualCurrency"))
+            reader.ReadNumberMap(VirtualCurrency);
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+            reader.ReadModelMap(VirtualCurrencyRechargeTimes);
+        else
+            reader.SkipValue();
+    }
+
+    return !reader.HasError();
+}
+
 PlayFab::ClientModels::FGrantCharacterToUserRequest::~FGrantCharacterToUserRequest()
 {
 
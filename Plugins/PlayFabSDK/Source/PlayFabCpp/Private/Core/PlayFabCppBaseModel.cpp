@@ -5,6 +5,7 @@
 
 #include "PlayFabCppBaseModel.h"
 #include "PlayFab.h"
+#include "PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 
@@ -17,6 +18,16 @@ FString FPlayFabCppBaseModel::toJSONString() const
     return JsonOutString;
 }
 
+bool FPlayFabCppBaseModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    const TSharedPtr<FJsonValue> value = reader.ReadJsonValue();
+    if (!value.IsValid())
+        return false;
+
+    const TSharedPtr<FJsonObject>* obj;
+    return value->TryGetObject(obj) ? readFromValue(*obj) : readFromValue(value);
+}
+
 void FJsonKeeper::writeJSON(JsonWriter& writer) const
 {
     switch (JsonValue->Type)
@@ -87,6 +98,12 @@ bool FJsonKeeper::readFromValue(const TSharedPtr<FJsonValue>& value)
     return true;
 }
 
+bool FJsonKeeper::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    const TSharedPtr<FJsonValue> value = reader.ReadJsonValue();
+    return value.IsValid() && readFromValue(value);
+}
+
 void PlayFab::writeDatetime(FDateTime datetime, JsonWriter& writer)
 {
     writer->WriteValue(datetime.ToIso8601());
@@ -90,7 +90,7 @@ bool UPlayFabDataInstanceAPI::AbortFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/AbortFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnAbortFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -120,7 +120,7 @@ bool UPlayFabDataInstanceAPI::DeleteFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/DeleteFiles"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnDeleteFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -150,7 +150,7 @@ bool UPlayFabDataInstanceAPI::FinalizeFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/FinalizeFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnFinalizeFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFinalizeFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -180,7 +180,7 @@ bool UPlayFabDataInstanceAPI::GetFiles(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/GetFiles"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnGetFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -210,7 +210,7 @@ bool UPlayFabDataInstanceAPI::GetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Object/GetObjects"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnGetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -240,7 +240,7 @@ bool UPlayFabDataInstanceAPI::InitiateFileUploads(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/File/InitiateFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnInitiateFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInitiateFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -270,7 +270,7 @@ bool UPlayFabDataInstanceAPI::SetObjects(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Object/SetObjects"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataInstanceAPI::OnSetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabDataInstanceAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -40,7 +40,7 @@ bool UPlayFabEconomyAPI::CreateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/CreateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnCreateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -70,7 +70,7 @@ bool UPlayFabEconomyAPI::CreateUploadUrls(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/CreateUploadUrls"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnCreateUploadUrlsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateUploadUrlsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -100,7 +100,7 @@ bool UPlayFabEconomyAPI::DeleteEntityItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/DeleteEntityItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteEntityItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteEntityItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -130,7 +130,7 @@ bool UPlayFabEconomyAPI::DeleteItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/DeleteItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnDeleteItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -160,7 +160,7 @@ bool UPlayFabEconomyAPI::GetCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -190,7 +190,7 @@ bool UPlayFabEconomyAPI::GetDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -220,7 +220,7 @@ bool UPlayFabEconomyAPI::GetDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -250,7 +250,7 @@ bool UPlayFabEconomyAPI::GetEntityDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetEntityDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetEntityDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -280,7 +280,7 @@ bool UPlayFabEconomyAPI::GetEntityItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetEntityItemReview"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetEntityItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetEntityItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -310,7 +310,7 @@ bool UPlayFabEconomyAPI::GetItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -340,7 +340,7 @@ bool UPlayFabEconomyAPI::GetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -370,7 +370,7 @@ bool UPlayFabEconomyAPI::GetItemPublishStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemPublishStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemPublishStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemPublishStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemPublishStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -400,7 +400,7 @@ bool UPlayFabEconomyAPI::GetItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -430,7 +430,7 @@ bool UPlayFabEconomyAPI::GetItemReviewSummary(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItemReviewSummary"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemReviewSummaryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewSummaryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -460,7 +460,7 @@ bool UPlayFabEconomyAPI::GetItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/GetItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnGetItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -490,7 +490,7 @@ bool UPlayFabEconomyAPI::PublishDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/PublishDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnPublishDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPublishDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -520,7 +520,7 @@ bool UPlayFabEconomyAPI::ReportItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReportItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReportItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnReportItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -550,7 +550,7 @@ bool UPlayFabEconomyAPI::ReportItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReportItemReview"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReportItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -580,7 +580,7 @@ bool UPlayFabEconomyAPI::ReviewItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/ReviewItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnReviewItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReviewItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -610,7 +610,7 @@ bool UPlayFabEconomyAPI::SearchItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SearchItems"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSearchItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSearchItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -640,7 +640,7 @@ bool UPlayFabEconomyAPI::SetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnSetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -670,7 +670,7 @@ bool UPlayFabEconomyAPI::SubmitItemReviewVote(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/SubmitItemReviewVote"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnSubmitItemReviewVoteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubmitItemReviewVoteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -700,7 +700,7 @@ bool UPlayFabEconomyAPI::TakedownItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/TakedownItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnTakedownItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnTakedownItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTakedownItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -730,7 +730,7 @@ bool UPlayFabEconomyAPI::UpdateCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/UpdateCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnUpdateCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -760,7 +760,7 @@ bool UPlayFabEconomyAPI::UpdateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Catalog/UpdateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyAPI::OnUpdateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -90,7 +90,7 @@ bool UPlayFabEconomyInstanceAPI::CreateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/CreateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnCreateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnCreateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -120,7 +120,7 @@ bool UPlayFabEconomyInstanceAPI::CreateUploadUrls(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/CreateUploadUrls"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnCreateUploadUrlsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnCreateUploadUrlsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateUploadUrlsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -150,7 +150,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteEntityItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/DeleteEntityItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteEntityItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteEntityItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteEntityItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -180,7 +180,7 @@ bool UPlayFabEconomyInstanceAPI::DeleteItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/DeleteItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnDeleteItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnDeleteItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -210,7 +210,7 @@ bool UPlayFabEconomyInstanceAPI::GetCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -240,7 +240,7 @@ bool UPlayFabEconomyInstanceAPI::GetDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -270,7 +270,7 @@ bool UPlayFabEconomyInstanceAPI::GetDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -300,7 +300,7 @@ bool UPlayFabEconomyInstanceAPI::GetEntityDraftItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetEntityDraftItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetEntityDraftItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetEntityDraftItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityDraftItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -330,7 +330,7 @@ bool UPlayFabEconomyInstanceAPI::GetEntityItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetEntityItemReview"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetEntityItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetEntityItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -360,7 +360,7 @@ bool UPlayFabEconomyInstanceAPI::GetItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -390,7 +390,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -420,7 +420,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemPublishStatus(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemPublishStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemPublishStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemPublishStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemPublishStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -450,7 +450,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -480,7 +480,7 @@ bool UPlayFabEconomyInstanceAPI::GetItemReviewSummary(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItemReviewSummary"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemReviewSummaryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemReviewSummaryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemReviewSummaryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -510,7 +510,7 @@ bool UPlayFabEconomyInstanceAPI::GetItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/GetItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnGetItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnGetItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -540,7 +540,7 @@ bool UPlayFabEconomyInstanceAPI::PublishDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/PublishDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnPublishDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnPublishDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPublishDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -570,7 +570,7 @@ bool UPlayFabEconomyInstanceAPI::ReportItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReportItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReportItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReportItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -600,7 +600,7 @@ bool UPlayFabEconomyInstanceAPI::ReportItemReview(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReportItemReview"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReportItemReviewResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReportItemReviewResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportItemReviewDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -630,7 +630,7 @@ bool UPlayFabEconomyInstanceAPI::ReviewItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/ReviewItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnReviewItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnReviewItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReviewItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -660,7 +660,7 @@ bool UPlayFabEconomyInstanceAPI::SearchItems(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SearchItems"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSearchItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSearchItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSearchItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -690,7 +690,7 @@ bool UPlayFabEconomyInstanceAPI::SetItemModerationState(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SetItemModerationState"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSetItemModerationStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSetItemModerationStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetItemModerationStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -720,7 +720,7 @@ bool UPlayFabEconomyInstanceAPI::SubmitItemReviewVote(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/SubmitItemReviewVote"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnSubmitItemReviewVoteResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnSubmitItemReviewVoteResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubmitItemReviewVoteDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -750,7 +750,7 @@ bool UPlayFabEconomyInstanceAPI::TakedownItemReviews(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/TakedownItemReviews"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnTakedownItemReviewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnTakedownItemReviewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FTakedownItemReviewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -780,7 +780,7 @@ bool UPlayFabEconomyInstanceAPI::UpdateCatalogConfig(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/UpdateCatalogConfig"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnUpdateCatalogConfigResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnUpdateCatalogConfigResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogConfigDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -810,7 +810,7 @@ bool UPlayFabEconomyInstanceAPI::UpdateDraftItem(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Catalog/UpdateDraftItem"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEconomyInstanceAPI::OnUpdateDraftItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabEconomyInstanceAPI::OnUpdateDraftItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateDraftItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -0,0 +1,607 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "Core/PlayFabJsonPullReader.h"
+#include "PlayFab.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Crc.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    const int32 maxDepth = 256;
+    // Longer strings are rarely repeated, and a table of them would cost more than it saves
+    const int32 maxInternedLength = 64;
+    const int32 maxInternedStrings = 4096;
+
+    bool IsWhitespace(uint8 c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    bool IsNumberStart(uint8 c)
+    {
+        return c == '-' || (c >= '0' && c <= '9');
+    }
+
+    bool ReadHex4(const uint8*& p, const uint8* end, uint32& outValue)
+    {
+        if (end - p < 4)
+            return false;
+
+        outValue = 0;
+        for (int32 i = 0; i < 4; i++)
+        {
+            const uint8 c = p[i];
+            const uint32 digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : 16;
+            if (digit > 15)
+                return false;
+            outValue = (outValue << 4) | digit;
+        }
+        p += 4;
+        return true;
+    }
+
+    void AppendUtf8(TArray<uint8>& out, uint32 codepoint)
+    {
+        if (codepoint < 0x80)
+        {
+            out.Add((uint8)codepoint);
+        }
+        else if (codepoint < 0x800)
+        {
+            out.Add((uint8)(0xC0 | (codepoint >> 6)));
+            out.Add((uint8)(0x80 | (codepoint & 0x3F)));
+        }
+        else if (codepoint < 0x10000)
+        {
+            out.Add((uint8)(0xE0 | (codepoint >> 12)));
+            out.Add((uint8)(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.Add((uint8)(0x80 | (codepoint & 0x3F)));
+        }
+        else
+        {
+            out.Add((uint8)(0xF0 | (codepoint >> 18)));
+            out.Add((uint8)(0x80 | ((codepoint >> 12) & 0x3F)));
+            out.Add((uint8)(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.Add((uint8)(0x80 | (codepoint & 0x3F)));
+        }
+    }
+}
+
+FPlayFabJsonPullReader::FPlayFabJsonPullReader(const uint8* data, int32 length) :
+    begin(data),
+    cursor(data),
+    end(data + length),
+    bAtContainerStart(false),
+    depth(0)
+{
+    // Skip a byte order mark
+    if (length >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF)
+        cursor += 3;
+}
+
+bool FPlayFabJsonPullReader::BeginObject()
+{
+    if (Peek() != '{')
+    {
+        SkipValue();
+        return false;
+    }
+    if (++depth > maxDepth)
+        return SetError(TEXT("Nested too deep"));
+
+    cursor++;
+    bAtContainerStart = true;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::NextField()
+{
+    if (HasError())
+        return false;
+
+    if (Peek() == '}')
+    {
+        cursor++;
+        depth--;
+        bAtContainerStart = false;
+        return false;
+    }
+    if (!bAtContainerStart && !Consume(','))
+        return SetError(TEXT("Expected ',' or '}'"));
+    bAtContainerStart = false;
+
+    if (Peek() != '"' || !ParseRawString(fieldName))
+        return SetError(TEXT("Expected a field name"));
+    if (!Consume(':'))
+        return SetError(TEXT("Expected ':'"));
+    return true;
+}
+
+bool FPlayFabJsonPullReader::IsField(const ANSICHAR* name) const
+{
+    if (fieldName.bEscaped)
+    {
+        FString decoded;
+        DecodeString(fieldName, decoded);
+        return decoded.Equals(ANSI_TO_TCHAR(name), ESearchCase::CaseSensitive);
+    }
+
+    const int32 length = FCStringAnsi::Strlen(name);
+    return length == fieldName.length && FMemory::Memcmp(fieldName.start, name, length) == 0;
+}
+
+void FPlayFabJsonPullReader::ReadFieldName(FString& outName)
+{
+    DecodeInternedString(fieldName, outName);
+}
+
+bool FPlayFabJsonPullReader::BeginArray()
+{
+    if (Peek() != '[')
+    {
+        SkipValue();
+        return false;
+    }
+    if (++depth > maxDepth)
+        return SetError(TEXT("Nested too deep"));
+
+    cursor++;
+    bAtContainerStart = true;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::NextElement()
+{
+    if (HasError())
+        return false;
+
+    if (Peek() == ']')
+    {
+        cursor++;
+        depth--;
+        bAtContainerStart = false;
+        return false;
+    }
+    if (!bAtContainerStart && !Consume(','))
+        return SetError(TEXT("Expected ',' or ']'"));
+    bAtContainerStart = false;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::TryReadNull()
+{
+    return Peek() == 'n' && ParseLiteral("null");
+}
+
+bool FPlayFabJsonPullReader::ReadString(FString& outValue)
+{
+    FRawString rawString;
+    if (Peek() != '"')
+    {
+        SkipValue();
+        return false;
+    }
+    if (!ParseRawString(rawString))
+        return false;
+
+    DecodeString(rawString, outValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadInternedString(FString& outValue)
+{
+    FRawString rawString;
+    if (Peek() != '"')
+    {
+        SkipValue();
+        return false;
+    }
+    if (!ParseRawString(rawString))
+        return false;
+
+    DecodeInternedString(rawString, outValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadBool(bool& outValue)
+{
+    switch (Peek())
+    {
+    case 't':
+        outValue = true;
+        return ParseLiteral("true");
+    case 'f':
+        outValue = false;
+        return ParseLiteral("false");
+    default:
+        SkipValue();
+        return false;
+    }
+}
+
+bool FPlayFabJsonPullReader::ReadNumber(double& outValue)
+{
+    if (!IsNumberStart(Peek()))
+    {
+        SkipValue();
+        return false;
+    }
+    return ParseNumber(outValue);
+}
+
+bool FPlayFabJsonPullReader::ReadDatetime(FDateTime& outValue)
+{
+    FRawString rawString;
+    if (Peek() != '"')
+    {
+        SkipValue();
+        return false;
+    }
+    if (!ParseRawString(rawString))
+        return false;
+
+    // Timestamps are short and plain, so they're parsed from the stack
+    TCHAR buffer[64];
+    bool bParsed;
+    if (!rawString.bEscaped && rawString.length < (int32)UE_ARRAY_COUNT(buffer))
+    {
+        for (int32 i = 0; i < rawString.length; i++)
+            buffer[i] = (TCHAR)rawString.start[i];
+        buffer[rawString.length] = TEXT('\0');
+        bParsed = FDateTime::ParseIso8601(buffer, outValue);
+    }
+    else
+    {
+        FString decoded;
+        DecodeString(rawString, decoded);
+        bParsed = FDateTime::ParseIso8601(*decoded, outValue);
+    }
+
+    if (!bParsed)
+    {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("readDatetime - Unable to import FDateTime from Iso8601 String. If you see FDateTime::MinValue (or FDateTime(0)), investigate the value being passed in and handle possible mis-parsing of ParseIso8601."));
+        outValue = FDateTime::MinValue();
+    }
+    return bParsed;
+}
+
+bool FPlayFabJsonPullReader::ReadStringArray(TArray<FString>& outValue)
+{
+    if (!BeginArray())
+        return false;
+
+    FString value;
+    while (NextElement())
+    {
+        if (ReadInternedString(value))
+            outValue.Add(value);
+    }
+    return !HasError();
+}
+
+bool FPlayFabJsonPullReader::ReadStringMap(TMap<FString, FString>& outValue)
+{
+    if (!BeginObject())
+        return false;
+
+    FString key;
+    while (NextField())
+    {
+        ReadFieldName(key);
+        FString value;
+        ReadString(value);
+        outValue.Add(key, MoveTemp(value));
+    }
+    return !HasError();
+}
+
+bool FPlayFabJsonPullReader::SkipValue()
+{
+    FRawString rawString;
+    double number;
+    switch (Peek())
+    {
+    case '{':
+        if (!BeginObject())
+            return false;
+        while (NextField())
+            SkipValue();
+        return !HasError();
+    case '[':
+        if (!BeginArray())
+            return false;
+        while (NextElement())
+            SkipValue();
+        return !HasError();
+    case '"':
+        return ParseRawString(rawString);
+    case 't':
+        return ParseLiteral("true");
+    case 'f':
+        return ParseLiteral("false");
+    case 'n':
+        return ParseLiteral("null");
+    case 0:
+        return SetError(TEXT("Unexpected end of input"));
+    default:
+        return ParseNumber(number);
+    }
+}
+
+TSharedPtr<FJsonValue> FPlayFabJsonPullReader::ReadJsonValue()
+{
+    switch (Peek())
+    {
+    case '{':
+    {
+        if (!BeginObject())
+            return nullptr;
+
+        TSharedPtr<FJsonObject> object = MakeShareable(new FJsonObject());
+        FString key;
+        while (NextField())
+        {
+            DecodeString(fieldName, key);
+            const TSharedPtr<FJsonValue> value = ReadJsonValue();
+            if (!value.IsValid())
+                return nullptr;
+            object->SetField(key, value);
+        }
+        return HasError() ? nullptr : MakeShareable(new FJsonValueObject(object));
+    }
+    case '[':
+    {
+        if (!BeginArray())
+            return nullptr;
+
+        TArray<TSharedPtr<FJsonValue>> values;
+        while (NextElement())
+        {
+            const TSharedPtr<FJsonValue> value = ReadJsonValue();
+            if (!value.IsValid())
+                return nullptr;
+            values.Add(value);
+        }
+        return HasError() ? nullptr : MakeShareable(new FJsonValueArray(values));
+    }
+    case '"':
+    {
+        FString value;
+        return ReadString(value) ? MakeShareable(new FJsonValueString(value)) : nullptr;
+    }
+    case 't':
+    case 'f':
+    {
+        bool value;
+        return ReadBool(value) ? MakeShareable(new FJsonValueBoolean(value)) : nullptr;
+    }
+    case 'n':
+        return TryReadNull() ? MakeShareable(new FJsonValueNull()) : nullptr;
+    default:
+    {
+        double value;
+        if (!IsNumberStart(Peek()))
+        {
+            SetError(TEXT("Expected a value"));
+            return nullptr;
+        }
+        return ParseNumber(value) ? MakeShareable(new FJsonValueNumber(value)) : nullptr;
+    }
+    }
+}
+
+uint8 FPlayFabJsonPullReader::Peek()
+{
+    while (cursor < end && IsWhitespace(*cursor))
+        cursor++;
+    return cursor < end ? *cursor : 0;
+}
+
+bool FPlayFabJsonPullReader::Consume(uint8 expected)
+{
+    if (Peek() != expected)
+        return false;
+
+    cursor++;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ParseRawString(FRawString& outString)
+{
+    // Past the opening quote
+    cursor++;
+    outString.start = cursor;
+    outString.bEscaped = false;
+
+    while (cursor < end)
+    {
+        const uint8 c = *cursor;
+        if (c == '"')
+        {
+            outString.length = (int32)(cursor - outString.start);
+            cursor++;
+            return true;
+        }
+        if (c == '\\')
+        {
+            outString.bEscaped = true;
+            cursor += 2;
+            continue;
+        }
+        if (c < 0x20)
+            return SetError(TEXT("Control character in string"));
+        cursor++;
+    }
+    return SetError(TEXT("Unterminated string"));
+}
+
+void FPlayFabJsonPullReader::DecodeString(const FRawString& rawString, FString& outValue) const
+{
+    const uint8* utf8 = rawString.start;
+    int32 utf8Length = rawString.length;
+
+    if (rawString.bEscaped)
+    {
+        unescapeScratch.Reset();
+        const uint8* p = rawString.start;
+        const uint8* rawEnd = rawString.start + rawString.length;
+        while (p < rawEnd)
+        {
+            if (*p != '\\')
+            {
+                unescapeScratch.Add(*p++);
+                continue;
+            }
+            if (++p >= rawEnd)
+                break;
+
+            const uint8 c = *p++;
+            switch (c)
+            {
+            case 'b': unescapeScratch.Add('\b'); break;
+            case 'f': unescapeScratch.Add('\f'); break;
+            case 'n': unescapeScratch.Add('\n'); break;
+            case 'r': unescapeScratch.Add('\r'); break;
+            case 't': unescapeScratch.Add('\t'); break;
+            case 'u':
+            {
+                uint32 codepoint;
+                if (!ReadHex4(p, rawEnd, codepoint))
+                    break;
+
+                // Characters outside the BMP come as a surrogate pair
+                if (codepoint >= 0xD800 && codepoint < 0xDC00 && rawEnd - p >= 6 && p[0] == '\\' && p[1] == 'u')
+                {
+                    const uint8* low = p + 2;
+                    uint32 lowSurrogate;
+                    if (ReadHex4(low, rawEnd, lowSurrogate) && lowSurrogate >= 0xDC00 && lowSurrogate < 0xE000)
+                    {
+                        codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                        p = low;
+                    }
+                }
+                AppendUtf8(unescapeScratch, codepoint);
+                break;
+            }
+            default:
+                unescapeScratch.Add(c);
+                break;
+            }
+        }
+        utf8 = unescapeScratch.GetData();
+        utf8Length = unescapeScratch.Num();
+    }
+
+    // Decoded into the string's own buffer, which keeps its allocation if it's big enough
+    TArray<TCHAR>& chars = outValue.GetCharArray();
+    if (utf8Length == 0)
+    {
+        chars.Reset();
+        return;
+    }
+
+    const int32 numChars = FPlatformString::ConvertedLength<TCHAR>((const UTF8CHAR*)utf8, utf8Length);
+    chars.SetNumUninitialized(numChars + 1, false);
+    FPlatformString::Convert(chars.GetData(), numChars, (const UTF8CHAR*)utf8, utf8Length);
+    chars[numChars] = TEXT('\0');
+}
+
+void FPlayFabJsonPullReader::DecodeInternedString(const FRawString& rawString, FString& outValue)
+{
+    if (rawString.length > maxInternedLength)
+    {
+        DecodeString(rawString, outValue);
+        return;
+    }
+
+    const uint32 hash = FCrc::MemCrc32(rawString.start, rawString.length);
+    if (const int32* index = internedIndices.Find(hash))
+    {
+        const FInternedString& interned = internedStrings[*index];
+        if (interned.length == rawString.length && FMemory::Memcmp(interned.start, rawString.start, rawString.length) == 0)
+        {
+            outValue = interned.value;
+            return;
+        }
+
+        // Hash collision, the first string keeps the slot
+        DecodeString(rawString, outValue);
+        return;
+    }
+
+    DecodeString(rawString, outValue);
+    if (internedStrings.Num() < maxInternedStrings)
+    {
+        internedIndices.Add(hash, internedStrings.Num());
+        internedStrings.Add({ rawString.start, rawString.length, outValue });
+    }
+}
+
+bool FPlayFabJsonPullReader::ParseNumber(double& outValue)
+{
+    const uint8* start = cursor;
+    const bool bNegative = cursor < end && *cursor == '-';
+    if (bNegative)
+        cursor++;
+
+    // Integers, by far the most common, are accumulated as they're scanned. 18 digits always fit in an int64, longer
+    // ones are only counted and go to Atod below.
+    int64 integer = 0;
+    int32 numDigits = 0;
+    while (cursor < end && *cursor >= '0' && *cursor <= '9')
+    {
+        if (numDigits < 18)
+            integer = integer * 10 + (*cursor - '0');
+        numDigits++;
+        cursor++;
+    }
+    if (numDigits == 0)
+        return SetError(TEXT("Expected a value"));
+
+    bool bInteger = numDigits <= 18;
+    while (cursor < end && (*cursor == '.' || *cursor == 'e' || *cursor == 'E' || *cursor == '+' || *cursor == '-' || (*cursor >= '0' && *cursor <= '9')))
+    {
+        bInteger = false;
+        cursor++;
+    }
+
+    if (bInteger)
+    {
+        outValue = (double)(bNegative ? -integer : integer);
+        return true;
+    }
+
+    ANSICHAR buffer[64];
+    const int32 length = (int32)(cursor - start);
+    if (length >= (int32)UE_ARRAY_COUNT(buffer))
+        return SetError(TEXT("Number too long"));
+
+    FMemory::Memcpy(buffer, start, length);
+    buffer[length] = '\0';
+    outValue = FCStringAnsi::Atod(buffer);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ParseLiteral(const ANSICHAR* literal)
+{
+    const int32 length = FCStringAnsi::Strlen(literal);
+    if (end - cursor < length || FMemory::Memcmp(cursor, literal, length) != 0)
+        return SetError(TEXT("Unexpected character"));
+
+    cursor += length;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::SetError(const TCHAR* message)
+{
+    if (errorMessage.IsEmpty())
+        errorMessage = FString::Printf(TEXT("%s at offset %d"), message, (int32)(FMath::Min(cursor, end) - begin));
+
+    cursor = end;
+    return false;
+}
@@ -40,7 +40,7 @@ bool UPlayFabLocalizationAPI::GetLanguageList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Locale/GetLanguageList"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabLocalizationAPI::OnGetLanguageListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabLocalizationAPI::OnGetLanguageListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLanguageListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -90,7 +90,7 @@ bool UPlayFabLocalizationInstanceAPI::GetLanguageList(
 
     auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Locale/GetLanguageList"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabLocalizationInstanceAPI::OnGetLanguageListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest);
 }
 
 void UPlayFabLocalizationInstanceAPI::OnGetLanguageListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLanguageListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
@@ -0,0 +1,353 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestScheduler.h"
+#include "PlayFab.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    // INDEX_NONE when no FScopedPriority is active on this thread
+    thread_local int32 scopedPriority = INDEX_NONE;
+
+    int64 ToMicros(double seconds)
+    {
+        return (int64)(seconds * 1000000.0);
+    }
+
+    double ToSeconds(int64 micros)
+    {
+        return micros / 1000000.0;
+    }
+}
+
+PlayFabRequestScheduler::FScopedPriority::FScopedPriority(EPlayFabRequestPriority priority)
+    : previousPriority(scopedPriority)
+{
+    scopedPriority = (int32)priority;
+}
+
+PlayFabRequestScheduler::FScopedPriority::~FScopedPriority()
+{
+    scopedPriority = previousPriority;
+}
+
+PlayFabRequestScheduler& PlayFabRequestScheduler::Get()
+{
+    static PlayFabRequestScheduler instance;
+    return instance;
+}
+
+PlayFabRequestScheduler::PlayFabRequestScheduler()
+    : nextId(1)
+{
+    const UPlayFabRuntimeSettings* settings = GetDefault<UPlayFabRuntimeSettings>();
+    maxInFlight[(int32)EPlayFabRequestFamily::Client] = settings->MaxInFlightClientCalls;
+    maxInFlight[(int32)EPlayFabRequestFamily::Server] = settings->MaxInFlightServerCalls;
+    maxInFlight[(int32)EPlayFabRequestFamily::Multiplayer] = settings->MaxInFlightMultiplayerCalls;
+    maxInFlight[(int32)EPlayFabRequestFamily::Events] = settings->MaxInFlightEventsCalls;
+    maxInFlight[(int32)EPlayFabRequestFamily::Other] = settings->MaxInFlightOtherCalls;
+
+    for (int32& count : numInFlight)
+        count = 0;
+}
+
+FString PlayFabRequestScheduler::GetUrlPath(const FString& fullUrl)
+{
+    int32 pathStart = fullUrl.Find(TEXT("://"));
+    pathStart = pathStart == INDEX_NONE ? 0 : fullUrl.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, pathStart + 3);
+    if (pathStart == INDEX_NONE)
+        return TEXT("/");
+
+    int32 pathEnd = fullUrl.Find(TEXT("?"), ESearchCase::CaseSensitive, ESearchDir::FromStart, pathStart);
+    if (pathEnd == INDEX_NONE)
+        pathEnd = fullUrl.Len();
+    return fullUrl.Mid(pathStart, pathEnd - pathStart);
+}
+
+EPlayFabRequestFamily PlayFabRequestScheduler::GetFamily(const FString& urlPath)
+{
+    if (urlPath.StartsWith(TEXT("/Client/")))
+        return EPlayFabRequestFamily::Client;
+    if (urlPath.StartsWith(TEXT("/Server/")))
+        return EPlayFabRequestFamily::Server;
+    if (urlPath.StartsWith(TEXT("/MultiplayerServer/")) || urlPath.StartsWith(TEXT("/Lobby/")) || urlPath.StartsWith(TEXT("/Match/")) || urlPath.StartsWith(TEXT("/Matchmaker/")))
+        return EPlayFabRequestFamily::Multiplayer;
+    if (urlPath.StartsWith(TEXT("/Event/")))
+        return EPlayFabRequestFamily::Events;
+    return EPlayFabRequestFamily::Other;
+}
+
+bool PlayFabRequestScheduler::IsReadOnly(const FString& urlPath)
+{
+    int32 nameStart;
+    if (!urlPath.FindLastChar(TEXT('/'), nameStart))
+        return false;
+
+    const TCHAR* name = *urlPath + nameStart + 1;
+    return FCString::Strncmp(name, TEXT("Get"), 3) == 0 || FCString::Strncmp(name, TEXT("List"), 4) == 0;
+}
+
+FString PlayFabRequestScheduler::MakeCoalesceKey(const IHttpRequest& HttpRequest)
+{
+    // Calls only share a response when they are the same call made with the same credentials
+    const TArray<uint8>& content = HttpRequest.GetContent();
+    const FUTF8ToTCHAR body((const ANSICHAR*)content.GetData(), content.Num());
+
+    FString key = HttpRequest.GetURL();
+    key += TEXT('\n');
+    key += HttpRequest.GetHeader(TEXT("X-Authorization"));
+    key += TEXT('\n');
+    key += HttpRequest.GetHeader(TEXT("X-SecretKey"));
+    key += TEXT('\n');
+    key += HttpRequest.GetHeader(TEXT("X-EntityToken"));
+    key += TEXT('\n');
+    key.AppendChars(body.Get(), body.Length());
+    return key;
+}
+
+bool PlayFabRequestScheduler::ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest)
+{
+    const double now = FPlatformTime::Seconds();
+    const FString urlPath = GetUrlPath(HttpRequest->GetURL());
+    const EPlayFabRequestFamily family = GetFamily(urlPath);
+    const EPlayFabRequestPriority priority = scopedPriority != INDEX_NONE ? (EPlayFabRequestPriority)scopedPriority
+        : family == EPlayFabRequestFamily::Events ? EPlayFabRequestPriority::Low : EPlayFabRequestPriority::Normal;
+    const FString coalesceKey = IsReadOnly(urlPath) ? MakeCoalesceKey(*HttpRequest) : FString();
+
+    TSharedPtr<FScheduledCall> call;
+    {
+        FScopeLock lock(&criticalSection);
+        TSharedPtr<FEndpointCounters> counters = FindOrAddCounters(urlPath);
+        counters->pending++;
+
+        // A write may change what any queued read returns, reads issued after it must not share their responses.
+        // Telemetry writes change nothing a read can see.
+        if (coalesceKey.IsEmpty() && family != EPlayFabRequestFamily::Events)
+            coalesceLeaders.Reset();
+
+        // Leaders are only ever queued calls. One already sent may have been answered before a write issued since, so a
+        // read joining it could see data older than the caller's own write.
+        if (const uint64* leaderId = coalesceKey.IsEmpty() ? nullptr : coalesceLeaders.Find(coalesceKey))
+        {
+            const TSharedPtr<FScheduledCall>& leader = scheduledCalls.FindChecked(*leaderId);
+            check(!leader->bDispatched);
+            leader->coalescedCalls.Add({ HttpRequest, HttpRequest->OnProcessRequestComplete(), now });
+            counters->coalesced++;
+
+            // A waiting call takes the most urgent priority of the calls it answers
+            if (priority > leader->priority)
+            {
+                leader->priority = priority;
+                queues[(int32)family].Heapify(CallPredicate);
+            }
+            return true;
+        }
+
+        call = MakeShared<FScheduledCall>();
+        call->id = nextId++;
+        call->request = HttpRequest;
+        call->onComplete = HttpRequest->OnProcessRequestComplete();
+        call->family = family;
+        call->priority = priority;
+        call->coalesceKey = coalesceKey;
+        call->counters = counters;
+        call->issueTime = now;
+        HttpRequest->OnProcessRequestComplete().BindRaw(this, &PlayFabRequestScheduler::OnRequestComplete, call->id);
+
+        scheduledCalls.Add(call->id, call);
+
+        if (!HasFreeSlot(family))
+        {
+            if (!coalesceKey.IsEmpty())
+                coalesceLeaders.Add(coalesceKey, call->id);
+            queues[(int32)family].HeapPush(call, CallPredicate);
+            return true;
+        }
+
+        numInFlight[(int32)family]++;
+        call->bDispatched = true;
+        call->dispatchTime = now;
+    }
+
+    return Dispatch(call);
+}
+
+bool PlayFabRequestScheduler::Dispatch(const TSharedPtr<FScheduledCall>& call)
+{
+    if (call->request->ProcessRequest())
+        return true;
+
+    UE_LOG(LogPlayFabCpp, Warning, TEXT("Failed to start PlayFab request %s"), *call->request->GetURL());
+    Complete(call->id, nullptr, false);
+    return false;
+}
+
+void PlayFabRequestScheduler::OnRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, uint64 id)
+{
+    Complete(id, HttpResponse, bSucceeded);
+}
+
+void PlayFabRequestScheduler::Complete(uint64 id, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    TSharedPtr<FScheduledCall> call;
+    TArray<TSharedPtr<FScheduledCall>> nextCalls;
+    {
+        FScopeLock lock(&criticalSection);
+        // A request that failed to start may still report completion, it was answered already
+        if (!scheduledCalls.RemoveAndCopyValue(id, call))
+            return;
+
+        numInFlight[(int32)call->family]--;
+        PopDispatchable(call->family, nextCalls);
+    }
+
+    const double now = FPlatformTime::Seconds();
+    RecordCompletion(*call->counters, call->issueTime, call->dispatchTime, now);
+    for (const FCoalescedCall& coalesced : call->coalescedCalls)
+        RecordCompletion(*call->counters, coalesced.issueTime, FMath::Max(coalesced.issueTime, call->dispatchTime), now);
+
+    // Handlers only read the response, so every coalesced call decodes the same one
+    call->onComplete.ExecuteIfBound(call->request, HttpResponse, bSucceeded);
+    for (const FCoalescedCall& coalesced : call->coalescedCalls)
+        coalesced.onComplete.ExecuteIfBound(coalesced.request, HttpResponse, bSucceeded);
+
+    for (const TSharedPtr<FScheduledCall>& nextCall : nextCalls)
+        Dispatch(nextCall);
+}
+
+void PlayFabRequestScheduler::PopDispatchable(EPlayFabRequestFamily family, TArray<TSharedPtr<FScheduledCall>>& outCalls)
+{
+    TArray<TSharedPtr<FScheduledCall>>& queue = queues[(int32)family];
+    const double now = FPlatformTime::Seconds();
+    while (queue.Num() > 0 && HasFreeSlot(family))
+    {
+        TSharedPtr<FScheduledCall> call;
+        queue.HeapPop(call, CallPredicate, false);
+        // Once sent it stops taking followers, identical reads issued from now on wait for a fresh response
+        // A write may already have replaced it as leader with a newer call
+        const uint64* leaderId = call->coalesceKey.IsEmpty() ? nullptr : coalesceLeaders.Find(call->coalesceKey);
+        if (leaderId && *leaderId == call->id)
+            coalesceLeaders.Remove(call->coalesceKey);
+        numInFlight[(int32)family]++;
+        call->bDispatched = true;
+        call->dispatchTime = now;
+        outCalls.Add(MoveTemp(call));
+    }
+}
+
+bool PlayFabRequestScheduler::CallPredicate(const TSharedPtr<FScheduledCall>& A, const TSharedPtr<FScheduledCall>& B)
+{
+    // Heap top is the most urgent call, in issue order within a priority
+    return A->priority != B->priority ? A->priority > B->priority : A->id < B->id;
+}
+
+bool PlayFabRequestScheduler::HasFreeSlot(EPlayFabRequestFamily family) const
+{
+    const int32 limit = maxInFlight[(int32)family];
+    return limit <= 0 || numInFlight[(int32)family] < limit;
+}
+
+void PlayFabRequestScheduler::RecordCompletion(FEndpointCounters& counters, double issueTime, double dispatchTime, double now)
+{
+    const int64 latencyMicros = ToMicros(now - issueTime);
+    counters.pending--;
+    counters.completed++;
+    counters.totalQueueMicros += ToMicros(dispatchTime - issueTime);
+    counters.totalLatencyMicros += latencyMicros;
+
+    int64 maxMicros = counters.maxLatencyMicros.load();
+    while (latencyMicros > maxMicros && !counters.maxLatencyMicros.compare_exchange_weak(maxMicros, latencyMicros))
+    {
+    }
+}
+
+TSharedPtr<PlayFabRequestScheduler::FEndpointCounters> PlayFabRequestScheduler::FindOrAddCounters(const FString& urlPath)
+{
+    if (const TSharedPtr<FEndpointCounters>* counters = endpointCounters.Find(urlPath))
+        return *counters;
+    return endpointCounters.Add(urlPath, MakeShared<FEndpointCounters>());
+}
+
+void PlayFabRequestScheduler::SetMaxInFlight(EPlayFabRequestFamily family, int32 inMaxInFlight)
+{
+    TArray<TSharedPtr<FScheduledCall>> nextCalls;
+    {
+        FScopeLock lock(&criticalSection);
+        maxInFlight[(int32)family] = FMath::Max(inMaxInFlight, 0);
+        PopDispatchable(family, nextCalls);
+    }
+
+    for (const TSharedPtr<FScheduledCall>& nextCall : nextCalls)
+        Dispatch(nextCall);
+}
+
+int32 PlayFabRequestScheduler::GetMaxInFlight(EPlayFabRequestFamily family) const
+{
+    FScopeLock lock(&criticalSection);
+    return maxInFlight[(int32)family];
+}
+
+int32 PlayFabRequestScheduler::GetNumInFlight(EPlayFabRequestFamily family) const
+{
+    FScopeLock lock(&criticalSection);
+    return numInFlight[(int32)family];
+}
+
+int32 PlayFabRequestScheduler::GetNumQueued(EPlayFabRequestFamily family) const
+{
+    FScopeLock lock(&criticalSection);
+    return queues[(int32)family].Num();
+}
+
+bool PlayFabRequestScheduler::GetEndpointStats(const FString& urlPath, FPlayFabEndpointStats& OutStats) const
+{
+    TSharedPtr<FEndpointCounters> counters;
+    {
+        FScopeLock lock(&criticalSection);
+        counters = endpointCounters.FindRef(urlPath);
+    }
+    if (!counters.IsValid())
+        return false;
+
+    OutStats.Pending = counters->pending.load();
+    OutStats.Completed = counters->completed.load();
+    OutStats.Coalesced = counters->coalesced.load();
+    OutStats.TotalQueueSeconds = ToSeconds(counters->totalQueueMicros.load());
+    OutStats.TotalLatencySeconds = ToSeconds(counters->totalLatencyMicros.load());
+    OutStats.MaxLatencySeconds = ToSeconds(counters->maxLatencyMicros.load());
+    return true;
+}
+
+TMap<FString, FPlayFabEndpointStats> PlayFabRequestScheduler::GetAllEndpointStats() const
+{
+    TArray<FString> urlPaths;
+    {
+        FScopeLock lock(&criticalSection);
+        endpointCounters.GetKeys(urlPaths);
+    }
+
+    TMap<FString, FPlayFabEndpointStats> stats;
+    for (const FString& urlPath : urlPaths)
+        GetEndpointStats(urlPath, stats.Add(urlPath));
+    return stats;
+}
+
+void PlayFabRequestScheduler::ResetEndpointStats()
+{
+    FScopeLock lock(&criticalSection);
+    // Pending counts belong to calls still running, only the totals start over
+    for (const TPair<FString, TSharedPtr<FEndpointCounters>>& counters : endpointCounters)
+    {
+        counters.Value->completed = 0;
+        counters.Value->coalesced = 0;
+        counters.Value->totalQueueMicros = 0;
+        counters.Value->totalLatencyMicros = 0;
+        counters.Value->maxLatencyMicros = 0;
+    }
+}
@@ -5,11 +5,13 @@
 
 #include "PlayFabResultHandler.h"
 #include "PlayFab.h"
+#include "PlayFabJsonPullReader.h"
+#include "PlayFabRequestScheduler.h"
 #include "Serialization/JsonSerializer.h"
 
 using namespace PlayFab;
 
-int PlayFabRequestHandler::pendingCalls = 0;
+std::atomic<int> PlayFabRequestHandler::pendingCalls(0);
 
 int PlayFabRequestHandler::GetPendingCalls()
 {
@@ -42,6 +44,11 @@ TSharedRef<IHttpRequest> PlayFabRequestHandler::SendFullUrlRequest(const FString
     return HttpRequest;
 }
 
+bool PlayFabRequestHandler::ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest)
+{
+    return PlayFabRequestScheduler::Get().ProcessRequest(HttpRequest);
+}
+
 bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError)
 {
     PlayFabRequestHandler::pendingCalls -= 1;
@@ -51,22 +58,25 @@ bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResp
     {
         if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
         {
-            // Create the Json parser
-            ResponseStr = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+            bool bIsError = false;
+            if (PlayFabRequestHandler::DecodeContent(HttpResponse->GetContent(), OutResult, bIsError))
+            {
+                return true;
+            }
 
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+            if (bIsError)
             {
-                if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
-                {
-                    return false;
-                }
+                // Create the Json parser
+                ResponseStr = HttpResponse->GetContentAsString();
+                TSharedPtr<FJsonObject> JsonObject;
+                TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
 
-                const TSharedPtr<FJsonObject>* DataJsonObject;
-                if (JsonObject->TryGetObjectField(TEXT("data"), DataJsonObject))
+                if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
                 {
-                    return OutResult.readFromValue(*DataJsonObject);
+                    if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
+                    {
+                        return false;
+                    }
                 }
             }
         }
@@ -96,6 +106,44 @@ bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResp
     return false;
 }
 
+bool PlayFabRequestHandler::DecodeContent(const TArray<uint8>& Content, PlayFab::FPlayFabCppBaseModel& OutResult, bool& bOutIsError)
+{
+    bOutIsError = false;
+    bool bHasData = false;
+
+    FPlayFabJsonPullReader Reader(Content);
+    if (!Reader.BeginObject())
+    {
+        return false;
+    }
+
+    while (Reader.NextField())
+    {
+        if (Reader.IsField("errorCode"))
+        {
+            // Error bodies are small, they go through the json tree and DecodeError
+            bOutIsError = true;
+            return false;
+        }
+
+        if (Reader.IsField("data"))
+        {
+            bHasData = !Reader.TryReadNull() && OutResult.readFromReader(Reader);
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Failed to parse PlayFab response: %s"), *Reader.GetErrorMessage());
+        return false;
+    }
+    return bHasData;
+}
+
 bool PlayFabRequestHandler::DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError)
 {
     // check if returned json indicates an error
@@ -0,0 +1,608 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "Core/PlayFabTelemetryPipeline.h"
+#include "Core/PlayFabResultHandler.h"
+#include "Core/PlayFabSettings.h"
+#include "PlayFab.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    // Per request limit of the Events API
+    const int32 maxServiceEventsPerBatch = 200;
+
+    const TCHAR* compressedExtension = TEXT(".json.gz");
+    const TCHAR* uncompressedExtension = TEXT(".json");
+
+    bool IsRetryable(const FPlayFabCppError& error)
+    {
+        // 408 is also what DecodeRequest reports when the endpoint couldn't be reached at all
+        return error.HttpCode == 408 || error.HttpCode == 429 || error.HttpCode >= 500;
+    }
+
+    void AppendChars(TArray<uint8>& buffer, const TCHAR* chars, int32 length)
+    {
+        buffer.Append((const uint8*)chars, length * sizeof(TCHAR));
+    }
+}
+
+TSharedRef<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> PlayFabTelemetryPipeline::Create(const FPlayFabTelemetrySettings& settings)
+{
+    TSharedRef<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> pipeline = MakeShareable(new PlayFabTelemetryPipeline(settings));
+    pipeline->tickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateThreadSafeSP(pipeline, &PlayFabTelemetryPipeline::Tick));
+    return pipeline;
+}
+
+PlayFabTelemetryPipeline::PlayFabTelemetryPipeline(const FPlayFabTelemetrySettings& settings) :
+    settings(settings),
+    bShutdown(false),
+    numQueued(0),
+    firstQueuedTime(0.0),
+    bFlushRequested(false),
+    batchesInFlight(0),
+    bResendInFlight(false),
+    failuresInARow(0),
+    nextSendTime(0.0),
+    spooledBytes(0),
+    spoolCounter(0),
+    maxQueued(0),
+    eventsEnqueued(0),
+    eventsDroppedQueueFull(0),
+    uncompressedBytes(0),
+    compressedBytes(0),
+    eventsSent(0),
+    eventsDropped(0),
+    batchesSent(0),
+    batchesFailed(0)
+{
+    this->settings.MaxEventsPerBatch = FMath::Clamp(settings.MaxEventsPerBatch, 1, maxServiceEventsPerBatch);
+    this->settings.MaxBatchesInFlight = FMath::Max(settings.MaxBatchesInFlight, 1);
+
+    // Every batch opens the same way, so the custom tags are only written once
+    batchPrefix = TEXT("{");
+    if (settings.CustomTags.Num() != 0)
+    {
+        FString customTags;
+        JsonWriter writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&customTags);
+        writer->WriteObjectStart();
+        for (TMap<FString, FString>::TConstIterator It(settings.CustomTags); It; ++It)
+        {
+            writer->WriteIdentifierPrefix((*It).Key);
+            writer->WriteValue((*It).Value);
+        }
+        writer->WriteObjectEnd();
+        writer->Close();
+        batchPrefix += TEXT("\"CustomTags\":") + customTags + TEXT(",");
+    }
+    batchPrefix += TEXT("\"Events\":[");
+
+    LoadSpool();
+}
+
+PlayFabTelemetryPipeline::~PlayFabTelemetryPipeline()
+{
+    Shutdown();
+}
+
+bool PlayFabTelemetryPipeline::Enqueue(EventsModels::FEventContents&& event)
+{
+    if (bShutdown)
+        return false;
+
+    // Reserve the space first so producers racing each other can't overshoot the limit
+    const int32 queued = ++numQueued;
+    if (queued > settings.MaxQueuedEvents)
+    {
+        --numQueued;
+        ++eventsDroppedQueueFull;
+        return false;
+    }
+
+    if (queued == 1)
+        firstQueuedTime = FPlatformTime::Seconds();
+
+    queue.Enqueue(MoveTemp(event));
+    ++eventsEnqueued;
+
+    int32 prevMax = maxQueued;
+    while (queued > prevMax && !maxQueued.compare_exchange_weak(prevMax, queued))
+    {
+    }
+    return true;
+}
+
+bool PlayFabTelemetryPipeline::Enqueue(const EventsModels::FEventContents& event)
+{
+    return Enqueue(EventsModels::FEventContents(event));
+}
+
+void PlayFabTelemetryPipeline::Flush()
+{
+    bFlushRequested = true;
+}
+
+void PlayFabTelemetryPipeline::Shutdown()
+{
+    if (bShutdown.exchange(true))
+        return;
+
+    FTSTicker::GetCoreTicker().RemoveTicker(tickHandle);
+
+    if (encodeTask.IsValid())
+    {
+        const TSharedPtr<FBatch> batch = encodeTask.Get();
+        encodeTask.Reset();
+        if (batch.IsValid())
+            Spool(batch);
+    }
+
+    // Batches still in flight are answered through a weak pointer, if the pipeline is gone by then they are lost
+    while (const TSharedPtr<FBatch> batch = EncodeBatch())
+        Spool(batch);
+
+    // A spooled batch being loaded for resend stays where it is
+    if (resendLoadTask.IsValid())
+    {
+        resendLoadTask.Get();
+        resendLoadTask.Reset();
+    }
+
+    // Everything spooled must be on disk before the pipeline goes, the spool task runs first to keep the order
+    if (spoolTask.IsValid())
+    {
+        spoolTask.Get();
+        spoolTask.Reset();
+    }
+    WriteSpool(spoolWrites, spoolDeletes);
+    spoolWrites.Reset();
+    spoolDeletes.Reset();
+}
+
+FPlayFabTelemetryStats PlayFabTelemetryPipeline::GetStats() const
+{
+    FPlayFabTelemetryStats stats;
+    stats.QueuedEvents = FMath::Max(numQueued.load(), 0);
+    stats.MaxQueuedEvents = maxQueued;
+    stats.BatchesInFlight = batchesInFlight;
+    stats.SpooledBatches = spooled.Num();
+    stats.SpooledBytes = spooledBytes;
+    stats.EventsEnqueued = eventsEnqueued;
+    stats.EventsSent = eventsSent;
+    stats.EventsDroppedQueueFull = eventsDroppedQueueFull;
+    stats.EventsDropped = eventsDropped;
+    stats.BatchesSent = batchesSent;
+    stats.BatchesFailed = batchesFailed;
+    stats.UncompressedBytes = uncompressedBytes;
+    stats.CompressedBytes = compressedBytes;
+    return stats;
+}
+
+FString PlayFabTelemetryPipeline::GetDefaultSpoolDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("PlayFab") / TEXT("Telemetry");
+}
+
+bool PlayFabTelemetryPipeline::Tick(float DeltaTime)
+{
+    const double now = FPlatformTime::Seconds();
+    const bool bBackingOff = now < nextSendTime;
+
+    if (encodeTask.IsValid() && encodeTask.IsReady())
+    {
+        const TSharedPtr<FBatch> batch = encodeTask.Get();
+        encodeTask.Reset();
+        if (batch.IsValid())
+        {
+            // The endpoint went away while the batch was encoding
+            if (bBackingOff && !settings.SpoolDirectory.IsEmpty())
+                Spool(batch);
+            else
+                Send(batch);
+        }
+    }
+
+    // While backing off, batches go straight to the spool. Without one, events wait in the queue
+    if (!encodeTask.IsValid() && ShouldCloseBatch(now))
+    {
+        if (bBackingOff ? !settings.SpoolDirectory.IsEmpty() : batchesInFlight < settings.MaxBatchesInFlight)
+            StartEncode();
+    }
+
+    if (!bBackingOff)
+        UpdateResend();
+
+    UpdateSpoolTask();
+    return true;
+}
+
+bool PlayFabTelemetryPipeline::ShouldCloseBatch(double now) const
+{
+    const int32 queued = numQueued;
+    if (queued <= 0)
+        return false;
+
+    return queued >= settings.MaxEventsPerBatch || bFlushRequested || now - firstQueuedTime >= settings.FlushIntervalSeconds;
+}
+
+void PlayFabTelemetryPipeline::StartEncode()
+{
+    bFlushRequested = false;
+
+    // Shutdown waits for the task before the pipeline can go away
+    encodeTask = Async(EAsyncExecution::ThreadPool, [this]()
+    {
+        return EncodeBatch();
+    });
+}
+
+TSharedPtr<PlayFabTelemetryPipeline::FBatch> PlayFabTelemetryPipeline::EncodeBatch()
+{
+    // Assembled as TCHARs in byte buffers that keep their allocations, sizes are in characters. Each event is written
+    // on its own first, so it only goes in if the batch still fits with it
+    const TCHAR* batchSuffix = TEXT("]}");
+    const int32 batchSuffixLength = 2;
+
+    jsonScratch.Reset();
+    AppendChars(jsonScratch, *batchPrefix, batchPrefix.Len());
+
+    int32 numEvents = 0;
+    while (numEvents < settings.MaxEventsPerBatch)
+    {
+        EventsModels::FEventContents* event = queue.Peek();
+        if (event == nullptr)
+            break;
+
+        eventScratch.Reset();
+        FMemoryWriter eventArchive(eventScratch);
+        JsonWriter writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&eventArchive);
+        event->writeJSON(writer);
+        writer->Close();
+
+        // An event bigger than the limit on its own still goes out, in a batch of one
+        const int32 separatorLength = numEvents > 0 ? 1 : 0;
+        const int32 batchLength = (jsonScratch.Num() + eventScratch.Num()) / (int32)sizeof(TCHAR) + separatorLength + batchSuffixLength;
+        if (numEvents > 0 && batchLength > settings.MaxBatchBytes)
+            break;
+
+        if (separatorLength > 0)
+            AppendChars(jsonScratch, TEXT(","), 1);
+        jsonScratch.Append(eventScratch);
+        queue.Pop();
+        --numQueued;
+        numEvents++;
+    }
+    AppendChars(jsonScratch, batchSuffix, batchSuffixLength);
+
+    // Restart the clock for what's left, a full batch's worth closes on count anyway
+    if (numQueued > 0)
+        firstQueuedTime = FPlatformTime::Seconds();
+
+    if (numEvents == 0)
+        return nullptr;
+
+    const TCHAR* json = (const TCHAR*)jsonScratch.GetData();
+    const int32 jsonLength = jsonScratch.Num() / sizeof(TCHAR);
+    const int32 utf8Length = FPlatformString::ConvertedLength<UTF8CHAR>(json, jsonLength);
+    utf8Scratch.SetNumUninitialized(utf8Length, false);
+    FPlatformString::Convert((UTF8CHAR*)utf8Scratch.GetData(), utf8Length, json, jsonLength);
+
+    TSharedPtr<FBatch> batch = MakeShared<FBatch>();
+    batch->numEvents = numEvents;
+    batch->uncompressedBytes = utf8Length;
+
+    if (settings.bCompress)
+    {
+        int32 compressedLength = FCompression::CompressMemoryBound(NAME_Gzip, utf8Length);
+        batch->body.SetNumUninitialized(compressedLength);
+        batch->bCompressed = FCompression::CompressMemory(NAME_Gzip, batch->body.GetData(), compressedLength, utf8Scratch.GetData(), utf8Length);
+        if (batch->bCompressed)
+            batch->body.SetNum(compressedLength, false);
+    }
+    if (!batch->bCompressed)
+        batch->body = utf8Scratch;
+
+    uncompressedBytes += utf8Length;
+    compressedBytes += batch->body.Num();
+    return batch;
+}
+
+void PlayFabTelemetryPipeline::Send(const TSharedPtr<FBatch>& batch)
+{
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, GetUrlPath(), FString(), TEXT("X-EntityToken"), GetEntityToken());
+    HttpRequest->SetContent(batch->body);
+    if (batch->bCompressed)
+        HttpRequest->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+
+    TWeakPtr<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> weakThis = AsShared();
+    HttpRequest->OnProcessRequestComplete().BindLambda([weakThis, batch](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+    {
+        if (const TSharedPtr<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> pipeline = weakThis.Pin())
+        {
+            pipeline->OnBatchComplete(HttpRequest, HttpResponse, bSucceeded, batch);
+            return;
+        }
+
+        // Still balances the pending call count
+        EventsModels::FWriteEventsResponse outResult;
+        FPlayFabCppError errorResult;
+        PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult);
+    });
+
+    batchesInFlight++;
+    // A request that fails to start still completes, through the delegate
+    PlayFabRequestHandler::ProcessRequest(HttpRequest);
+}
+
+void PlayFabTelemetryPipeline::OnBatchComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedPtr<FBatch> batch)
+{
+    batchesInFlight--;
+    const bool bResent = !batch->spoolFile.IsEmpty();
+    if (bResent)
+        bResendInFlight = false;
+
+    EventsModels::FWriteEventsResponse outResult;
+    FPlayFabCppError errorResult;
+    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    {
+        eventsSent += batch->numEvents;
+        batchesSent++;
+        failuresInARow = 0;
+        nextSendTime = 0.0;
+        if (bResent)
+            RemoveSpooled(batch->spoolFile);
+        return;
+    }
+
+    batchesFailed++;
+    if (IsRetryable(errorResult))
+    {
+        UE_LOG(LogPlayFabCpp, Verbose, TEXT("Telemetry batch of %d events failed with %d, will retry"), batch->numEvents, errorResult.HttpCode);
+        if (!bResent)
+            Spool(batch);
+        OnEndpointUnreachable();
+        return;
+    }
+
+    UE_LOG(LogPlayFabCpp, Warning, TEXT("Telemetry batch of %d events rejected: %s"), batch->numEvents, *errorResult.GenerateErrorReport());
+    eventsDropped += batch->numEvents;
+    if (bResent)
+        RemoveSpooled(batch->spoolFile);
+}
+
+void PlayFabTelemetryPipeline::OnEndpointUnreachable()
+{
+    failuresInARow++;
+    const float delay = FMath::Min(settings.MinRetrySeconds * FMath::Pow(2.0f, (float)FMath::Min(failuresInARow - 1, 16)), settings.MaxRetrySeconds);
+    nextSendTime = FPlatformTime::Seconds() + delay;
+
+    if (failuresInARow == 1)
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Telemetry endpoint unreachable, retrying in %.0f seconds"), delay);
+}
+
+void PlayFabTelemetryPipeline::LoadSpool()
+{
+    if (settings.SpoolDirectory.IsEmpty())
+        return;
+
+    TArray<FString> files;
+    IFileManager::Get().FindFiles(files, *(settings.SpoolDirectory / TEXT("*.json*")), true, false);
+    // Names start with the zero padded time they were written, so this is oldest first
+    files.Sort();
+
+    for (const FString& name : files)
+    {
+        // "<ticks>-<counter>-<numEvents>.json[.gz]"
+        TArray<FString> parts;
+        FPaths::GetBaseFilename(name).ParseIntoArray(parts, TEXT("-"));
+        const FString file = settings.SpoolDirectory / name;
+        if (parts.Num() != 3)
+        {
+            IFileManager::Get().Delete(*file, false, false, true);
+            continue;
+        }
+
+        FSpoolEntry entry;
+        entry.file = file;
+        entry.bytes = IFileManager::Get().FileSize(*file);
+        entry.numEvents = FCString::Atoi(*parts[2]);
+        spooled.Add(entry);
+        spooledBytes += entry.bytes;
+    }
+
+    if (spooled.Num() > 0)
+        UE_LOG(LogPlayFabCpp, Log, TEXT("Found %d spooled telemetry batches to resend"), spooled.Num());
+
+    TrimSpool();
+}
+
+void PlayFabTelemetryPipeline::Spool(const TSharedPtr<FBatch>& batch)
+{
+    if (settings.SpoolDirectory.IsEmpty())
+    {
+        eventsDropped += batch->numEvents;
+        return;
+    }
+
+    // Written by the next spool task, the batch stays in memory until then
+    batch->spoolFile = settings.SpoolDirectory / FString::Printf(TEXT("%020lld-%04d-%d%s"),
+        FDateTime::UtcNow().GetTicks(), spoolCounter++ % 10000, batch->numEvents, batch->bCompressed ? compressedExtension : uncompressedExtension);
+    spoolWrites.Add(batch);
+
+    FSpoolEntry entry;
+    entry.file = batch->spoolFile;
+    entry.bytes = batch->body.Num();
+    entry.numEvents = batch->numEvents;
+    entry.unwritten = batch;
+    spooled.Add(entry);
+    spooledBytes += entry.bytes;
+
+    TrimSpool();
+}
+
+TSharedPtr<PlayFabTelemetryPipeline::FBatch> PlayFabTelemetryPipeline::LoadSpooledBatch(const FSpoolEntry& entry)
+{
+    TSharedPtr<FBatch> batch = MakeShared<FBatch>();
+    if (!FFileHelper::LoadFileToArray(batch->body, *entry.file, FILEREAD_Silent))
+        return nullptr;
+
+    batch->numEvents = entry.numEvents;
+    batch->uncompressedBytes = batch->body.Num();
+    batch->bCompressed = entry.file.EndsWith(compressedExtension);
+    batch->spoolFile = entry.file;
+    return batch;
+}
+
+void PlayFabTelemetryPipeline::RemoveSpooled(const FString& file)
+{
+    const int32 index = spooled.IndexOfByPredicate([&file](const FSpoolEntry& entry) { return entry.file == file; });
+    if (index != INDEX_NONE)
+    {
+        spooledBytes -= spooled[index].bytes;
+        spooled.RemoveAt(index);
+    }
+
+    // Never written if the spool task hasn't picked it up yet
+    const int32 removedWrites = spoolWrites.RemoveAll([&file](const TSharedPtr<FBatch>& batch) { return batch->spoolFile == file; });
+    if (removedWrites == 0)
+        spoolDeletes.Add(file);
+}
+
+void PlayFabTelemetryPipeline::UpdateSpoolTask()
+{
+    if (spoolTask.IsValid())
+    {
+        if (!spoolTask.IsReady())
+            return;
+
+        const TArray<FString> failed = spoolTask.Get();
+        spoolTask.Reset();
+
+        for (const FString& file : spoolWritesInProgress)
+        {
+            FSpoolEntry* entry = spooled.FindByPredicate([&file](const FSpoolEntry& spooledEntry) { return spooledEntry.file == file; });
+            if (entry == nullptr)
+                continue;
+
+            if (!failed.Contains(file))
+            {
+                entry->unwritten.Reset();
+                continue;
+            }
+
+            // One being resent right now stays and is resent from memory until it goes through
+            if (!(bResendInFlight && entry == &spooled[0]))
+            {
+                UE_LOG(LogPlayFabCpp, Warning, TEXT("Failed to spool telemetry to %s, %d events dropped"), *file, entry->numEvents);
+                eventsDropped += entry->numEvents;
+                RemoveSpooled(file);
+            }
+        }
+        spoolWritesInProgress.Reset();
+    }
+
+    if (spoolWrites.Num() == 0 && spoolDeletes.Num() == 0)
+        return;
+
+    for (const TSharedPtr<FBatch>& batch : spoolWrites)
+        spoolWritesInProgress.Add(batch->spoolFile);
+
+    spoolTask = Async(EAsyncExecution::ThreadPool, [writes = MoveTemp(spoolWrites), deletes = MoveTemp(spoolDeletes)]()
+    {
+        return WriteSpool(writes, deletes);
+    });
+    spoolWrites.Reset();
+    spoolDeletes.Reset();
+}
+
+TArray<FString> PlayFabTelemetryPipeline::WriteSpool(const TArray<TSharedPtr<FBatch>>& writes, const TArray<FString>& deletes)
+{
+    TArray<FString> failed;
+    for (const TSharedPtr<FBatch>& batch : writes)
+    {
+        if (!FFileHelper::SaveArrayToFile(batch->body, *batch->spoolFile))
+            failed.Add(batch->spoolFile);
+    }
+
+    // Deletes go last, a file removed right after it was queued for writing is written first
+    for (const FString& file : deletes)
+        IFileManager::Get().Delete(*file, false, false, true);
+    return failed;
+}
+
+void PlayFabTelemetryPipeline::UpdateResend()
+{
+    if (resendLoadTask.IsValid())
+    {
+        if (!resendLoadTask.IsReady())
+            return;
+
+        const TSharedPtr<FBatch> batch = resendLoadTask.Get();
+        resendLoadTask.Reset();
+        if (batch.IsValid())
+        {
+            Send(batch);
+            return;
+        }
+
+        const FSpoolEntry entry = spooled[0];
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Failed to read spooled telemetry %s, deleting it"), *entry.file);
+        bResendInFlight = false;
+        eventsDropped += entry.numEvents;
+        RemoveSpooled(entry.file);
+        return;
+    }
+
+    // Spooled batches go out oldest first, one at a time so a dead endpoint isn't hit with all of them
+    if (bResendInFlight || spooled.Num() == 0 || batchesInFlight >= settings.MaxBatchesInFlight)
+        return;
+
+    // Reserved from here, so the spool isn't trimmed under the load
+    bResendInFlight = true;
+    if (spooled[0].unwritten.IsValid())
+    {
+        Send(spooled[0].unwritten);
+        return;
+    }
+
+    resendLoadTask = Async(EAsyncExecution::ThreadPool, [entry = spooled[0]]()
+    {
+        return LoadSpooledBatch(entry);
+    });
+}
+
+void PlayFabTelemetryPipeline::TrimSpool()
+{
+    // Keep the one being resent, it's deleted when it completes
+    const int32 firstTrimmable = bResendInFlight ? 1 : 0;
+    while (spooledBytes > settings.MaxSpoolBytes && spooled.Num() > firstTrimmable)
+    {
+        const FSpoolEntry entry = spooled[firstTrimmable];
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Telemetry spool is full, %d events dropped"), entry.numEvents);
+        eventsDropped += entry.numEvents;
+        RemoveSpooled(entry.file);
+    }
+}
+
+FString PlayFabTelemetryPipeline::GetEntityToken() const
+{
+    FString entityToken = settings.AuthenticationContext.IsValid() ? settings.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
+    if (entityToken.Len() == 0) {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("You must call GetEntityToken API Method before calling this function."));
+    }
+    return entityToken;
+}
+
+FString PlayFabTelemetryPipeline::GetUrlPath() const
+{
+    return settings.bTelemetryEndpoint ? TEXT("/Event/WriteTelemetryEvents") : TEXT("/Event/WriteEvents");
+}
@@ -0,0 +1,250 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "CoreTypes.h"
+#include "Core/PlayFabClientDataModels.h"
+#include "Core/PlayFabJsonPullReader.h"
+#include "Core/PlayFabResultHandler.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace PlayFab;
+
+namespace PlayFabJsonDecodeTests
+{
+    // Best of this many runs is reported
+    const int32 numRuns = 5;
+
+    const TCHAR* itemClasses[] = { TEXT("Weapon"), TEXT("Armor"), TEXT("Consumable"), TEXT("Cosmetic") };
+    const TCHAR* timestamp = TEXT("2021-06-01T12:00:00.000Z");
+
+    TArray<uint8> ToUtf8(const FString& json)
+    {
+        const FTCHARToUTF8 converted(*json);
+        return TArray<uint8>(reinterpret_cast<const uint8*>(converted.Get()), converted.Length());
+    }
+
+    TArray<uint8> ToResponse(const FString& data)
+    {
+        return ToUtf8(FString::Printf(TEXT("{\"code\":200,\"status\":\"OK\",\"data\":%s}"), *data));
+    }
+
+    FString MakeInventoryItem(int32 index)
+    {
+        FString item = FString::Printf(TEXT("{\"ItemId\":\"item_%d\",\"ItemInstanceId\":\"%016X\",\"ItemClass\":\"%s\",\"PurchaseDate\":\"%s\","),
+            index % 50, index * 7919, itemClasses[index % UE_ARRAY_COUNT(itemClasses)], timestamp);
+        if (index % 2 == 0)
+            item += FString::Printf(TEXT("\"RemainingUses\":%d,"), index % 5);
+        item += FString::Printf(TEXT("\"UnitCurrency\":\"GC\",\"UnitPrice\":%d,\"CatalogVersion\":\"Main\",\"DisplayName\":\"Item %d\",\"CustomData\":{\"level\":\"%d\"},\"BundleContents\":[]}"),
+            100 + index, index % 50, index % 10);
+        return item;
+    }
+
+    FString MakeUserDataRecord(int32 index)
+    {
+        return FString::Printf(TEXT("{\"Value\":\"{\\\"slot\\\":%d,\\\"name\\\":\\\"save \\\\\\\"%d\\\\\\\" caf\\u00e9\\\"}\",\"LastUpdated\":\"%s\",\"Permission\":\"%s\"}"),
+            index, index, timestamp, index % 3 == 0 ? TEXT("Public") : TEXT("Private"));
+    }
+
+    FString MakeGetUserData(int32 numRecords)
+    {
+        TArray<FString> records;
+        for (int32 i = 0; i < numRecords; i++)
+            records.Add(FString::Printf(TEXT("\"key_%d\":%s"), i, *MakeUserDataRecord(i)));
+        return FString::Printf(TEXT("{\"Data\":{%s},\"DataVersion\":42}"), *FString::Join(records, TEXT(",")));
+    }
+
+    FString MakeGetCatalogItems(int32 numItems)
+    {
+        TArray<FString> items;
+        for (int32 i = 0; i < numItems; i++)
+        {
+            FString item = FString::Printf(TEXT("{\"ItemId\":\"item_%d\",\"ItemClass\":\"%s\",\"CatalogVersion\":\"Main\",\"DisplayName\":\"Item %d\","),
+                i, itemClasses[i % UE_ARRAY_COUNT(itemClasses)], i);
+            item += FString::Printf(TEXT("\"Description\":\"A fairly long description of item %d, written by a designer who likes to explain things in detail.\","), i);
+            item += FString::Printf(TEXT("\"CustomData\":\"{\\\"damage\\\":%d,\\\"rarity\\\":\\\"rare\\\"}\",\"VirtualCurrencyPrices\":{\"GC\":%d,\"RM\":%d},\"RealCurrencyPrices\":{},"),
+                i % 100, 100 + i, 99);
+            item += FString::Printf(TEXT("\"Tags\":[\"tag%d\",\"common\"],\"IsStackable\":false,\"IsTradable\":true,\"IsLimitedEdition\":false,\"InitialLimitedEditionCount\":0,"), i % 8);
+            if (i % 3 == 0)
+                item += FString::Printf(TEXT("\"Consumable\":{\"UsageCount\":%d},"), i % 4 + 1);
+            // Fields newer than the SDK are skipped
+            item += TEXT("\"CanBecomeCharacter\":false,\"ItemImageUrl\":null,\"FutureField\":{\"a\":[1,2.5e3,true,null,\"x\"]}}");
+            items.Add(item);
+        }
+        return FString::Printf(TEXT("{\"Catalog\":[%s]}"), *FString::Join(items, TEXT(",")));
+    }
+
+    FString MakeGetLeaderboard(int32 numEntries)
+    {
+        TArray<FString> entries;
+        for (int32 i = 0; i < numEntries; i++)
+        {
+            entries.Add(FString::Printf(TEXT("{\"PlayFabId\":\"%016X\",\"DisplayName\":\"Player %d\",\"StatValue\":%d,\"Position\":%d,\"Profile\":{\"PublisherId\":\"A1B2\",\"TitleId\":\"1234\",\"PlayerId\":\"%016X\",\"DisplayName\":\"Player %d\"}}"),
+                i * 104729, i, 100000 - i * 13, i, i * 104729, i));
+        }
+        return FString::Printf(TEXT("{\"Leaderboard\":[%s],\"Version\":3,\"NextReset\":\"%s\"}"), *FString::Join(entries, TEXT(",")), timestamp);
+    }
+
+    FString MakeGetPlayerCombinedInfo(int32 numItems)
+    {
+        TArray<FString> inventory, userData, titleData, statistics;
+        for (int32 i = 0; i < numItems; i++)
+            inventory.Add(MakeInventoryItem(i));
+        for (int32 i = 0; i < 50; i++)
+            userData.Add(FString::Printf(TEXT("\"key_%d\":%s"), i, *MakeUserDataRecord(i)));
+        for (int32 i = 0; i < 20; i++)
+        {
+            titleData.Add(FString::Printf(TEXT("\"title_key_%d\":\"value %d\""), i, i));
+            statistics.Add(FString::Printf(TEXT("{\"StatisticName\":\"stat_%d\",\"Value\":%d,\"Version\":1}"), i, i * 10));
+        }
+
+        return FString::Printf(TEXT("{\"PlayFabId\":\"ABC123\",\"InfoResultPayload\":{\"UserInventory\":[%s],\"UserVirtualCurrency\":{\"GC\":1500,\"RM\":5},\"UserData\":{%s},\"UserDataVersion\":7,\"TitleData\":{%s},\"PlayerStatistics\":[%s],\"PlayerProfile\":{\"PlayerId\":\"ABC123\",\"DisplayName\":\"Me\"}}}"),
+            *FString::Join(inventory, TEXT(",")), *FString::Join(userData, TEXT(",")), *FString::Join(titleData, TEXT(",")), *FString::Join(statistics, TEXT(",")));
+    }
+
+    // The previous path, the whole response as a json tree that the model then reads
+    bool DecodeWithTree(const TArray<uint8>& content, FPlayFabCppBaseModel& outResult)
+    {
+        FString responseStr;
+        FFileHelper::BufferToString(responseStr, content.GetData(), content.Num());
+
+        TSharedPtr<FJsonObject> jsonObject;
+        TSharedRef<TJsonReader<> > jsonReader = TJsonReaderFactory<>::Create(responseStr);
+        if (!FJsonSerializer::Deserialize(jsonReader, jsonObject) || !jsonObject.IsValid())
+            return false;
+
+        FPlayFabCppError error;
+        if (PlayFabRequestHandler::DecodeError(jsonObject, error))
+            return false;
+
+        const TSharedPtr<FJsonObject>* dataJsonObject;
+        return jsonObject->TryGetObjectField(TEXT("data"), dataJsonObject) && outResult.readFromValue(*dataJsonObject);
+    }
+
+    template <typename ResultType>
+    void Compare(FAutomationTestBase& test, const TCHAR* name, const TArray<uint8>& content)
+    {
+        double treeSeconds = MAX_dbl;
+        double streamSeconds = MAX_dbl;
+        for (int32 run = 0; run < numRuns; run++)
+        {
+            ResultType treeResult;
+            double start = FPlatformTime::Seconds();
+            const bool bTreeDecoded = DecodeWithTree(content, treeResult);
+            treeSeconds = FMath::Min(treeSeconds, FPlatformTime::Seconds() - start);
+
+            ResultType streamResult;
+            bool bIsError = false;
+            start = FPlatformTime::Seconds();
+            const bool bStreamDecoded = PlayFabRequestHandler::DecodeContent(content, streamResult, bIsError);
+            streamSeconds = FMath::Min(streamSeconds, FPlatformTime::Seconds() - start);
+
+            if (run == 0)
+            {
+                test.TestTrue(FString::Printf(TEXT("%s must decode through the tree"), name), bTreeDecoded);
+                test.TestTrue(FString::Printf(TEXT("%s must decode streaming"), name), bStreamDecoded);
+                // Writing both back out compares every field
+                test.TestEqual(FString::Printf(TEXT("%s must decode the same both ways"), name), streamResult.toJSONString(), treeResult.toJSONString());
+            }
+        }
+
+        test.AddInfo(FString::Printf(TEXT("%s, %d KB: tree %.2f ms, streaming %.2f ms (%.1fx)"),
+            name, content.Num() / 1024, treeSeconds * 1000.0, streamSeconds * 1000.0, treeSeconds / FMath::Max(streamSeconds, 1e-9)));
+    }
+}
+
+/**
+ * Check the pull reader against escapes, numbers, nesting and malformed input
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabJsonPullReaderTest, "PlayFab.Json.PullReader", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FPlayFabJsonPullReaderTest::RunTest(const FString& Parameters)
+{
+    using namespace PlayFabJsonDecodeTests;
+
+    const TArray<uint8> content = ToResponse(TEXT("{\"Text\":\"a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00\",\"Skip\":{\"x\":[1,{\"y\":null}],\"z\":\"}\"},\"Int\":-42,\"Real\":1.5e2,\"Flag\":true,\"Items\":[\"GC\",\"GC\",\"RM\"]}"));
+    FPlayFabJsonPullReader reader(content);
+
+    FString text;
+    int32 intValue = 0;
+    double realValue = 0.0;
+    bool flag = false;
+    TArray<FString> items;
+    TestTrue(TEXT("Envelope must be an object"), reader.BeginObject());
+    while (reader.NextField())
+    {
+        if (!reader.IsField("data"))
+        {
+            reader.SkipValue();
+            continue;
+        }
+
+        TestTrue(TEXT("Data must be an object"), reader.BeginObject());
+        while (reader.NextField())
+        {
+            if (reader.IsField("Text"))
+                reader.ReadString(text);
+            else if (reader.IsField("Int"))
+                reader.ReadNumber(intValue);
+            else if (reader.IsField("Real"))
+                reader.ReadNumber(realValue);
+            else if (reader.IsField("Flag"))
+                reader.ReadBool(flag);
+            else if (reader.IsField("Items"))
+                reader.ReadStringArray(items);
+            else
+                reader.SkipValue();
+        }
+    }
+
+    TestFalse(TEXT("Reader must not fail"), reader.HasError());
+    FString expectedText = TEXT("a\"b\\c\n");
+    expectedText.AppendChar(TCHAR(0xE9));
+    expectedText += UTF8_TO_TCHAR("\xF0\x9F\x98\x80");
+    TestEqual(TEXT("Escapes must be decoded"), text, expectedText);
+    TestEqual(TEXT("Integer"), intValue, -42);
+    TestEqual(TEXT("Real"), realValue, 150.0);
+    TestTrue(TEXT("Bool"), flag);
+    TestEqual(TEXT("Interned strings must all be read"), items.Num(), 3);
+    TestTrue(TEXT("Interned strings must keep their values"), items.Num() == 3 && items[0] == TEXT("GC") && items[1] == TEXT("GC") && items[2] == TEXT("RM"));
+
+    // A type mismatch skips the value, the rest still reads
+    const TArray<uint8> mismatch = ToResponse(TEXT("{\"Leaderboard\":\"oops\",\"Version\":3}"));
+    ClientModels::FGetLeaderboardResult leaderboard;
+    bool bIsError = false;
+    TestTrue(TEXT("Mismatched field must be skipped"), PlayFabRequestHandler::DecodeContent(mismatch, leaderboard, bIsError));
+    TestEqual(TEXT("Field after the mismatch"), leaderboard.Version, 3);
+
+    const TArray<uint8> error = ToUtf8(TEXT("{\"code\":400,\"status\":\"BadRequest\",\"error\":\"InvalidParams\",\"errorCode\":1000}"));
+    ClientModels::FGetUserDataResult errorResult;
+    TestFalse(TEXT("Error response must not decode"), PlayFabRequestHandler::DecodeContent(error, errorResult, bIsError));
+    TestTrue(TEXT("Error response must be reported as one"), bIsError);
+
+    const TArray<uint8> truncated = ToResponse(TEXT("{\"Data\":{\"key\":{\"Value\":\"abc"));
+    ClientModels::FGetUserDataResult truncatedResult;
+    AddExpectedError(TEXT("Failed to parse PlayFab response"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestFalse(TEXT("Truncated response must not decode"), PlayFabRequestHandler::DecodeContent(truncated, truncatedResult, bIsError));
+    TestFalse(TEXT("Truncated response is not an error response"), bIsError);
+    return true;
+}
+
+/**
+ * Compare decoding large recorded-shape responses through the json tree against streaming them into the models
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabJsonDecodeBenchmark, "PlayFab.Json.Benchmark.DecodeResponses", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FPlayFabJsonDecodeBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace PlayFabJsonDecodeTests;
+
+    Compare<ClientModels::FGetUserDataResult>(*this, TEXT("GetUserData 500 records"), ToResponse(MakeGetUserData(500)));
+    Compare<ClientModels::FGetPlayerCombinedInfoResult>(*this, TEXT("GetPlayerCombinedInfo 1000 items"), ToResponse(MakeGetPlayerCombinedInfo(1000)));
+    Compare<ClientModels::FGetCatalogItemsResult>(*this, TEXT("GetCatalogItems 5000 items"), ToResponse(MakeGetCatalogItems(5000)));
+    Compare<ClientModels::FGetLeaderboardResult>(*this, TEXT("GetLeaderboard 100 entries"), ToResponse(MakeGetLeaderboard(100)));
+    return true;
+}
+
+#endif
@@ -0,0 +1,289 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "CoreTypes.h"
+#include "Core/PlayFabSettings.h"
+#include "Core/PlayFabTelemetryPipeline.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+
+using namespace PlayFab;
+
+namespace PlayFabTelemetryTests
+{
+    // Away from the Blueprint benchmark's stand-in and anything else a developer may be running locally
+    const uint32 standInPort = 19481;
+    const double timeoutSeconds = 30.0;
+    const int32 maxEventsPerBatch = 50;
+    // Fits a few dozen of the events below, so batches close on size before they close on count
+    const int32 maxBatchBytes = 8 * 1024;
+    const int32 payloadChars = 160;
+    const int32 batchedEvents = 120;
+    const int32 failedEvents = 30;
+    const int32 backoffEvents = 10;
+    const float retrySeconds = 1.0f;
+
+    EventsModels::FEventContents MakeEvent(int32 index)
+    {
+        EventsModels::FEventContents event;
+        event.EventNamespace = TEXT("custom.finalcypher");
+        event.Name = TEXT("round_end");
+        event.PayloadJSON = FString::Printf(TEXT("{\"index\":%d,\"notes\":\"%s\"}"), index, *FString::ChrN(payloadChars, (TCHAR)(TEXT('a') + index % 26)));
+        return event;
+    }
+
+    int32 CountSpoolFiles(const FString& directory)
+    {
+        TArray<FString> files;
+        IFileManager::Get().FindFiles(files, *(directory / TEXT("*.json*")), true, false);
+        return files.Num();
+    }
+
+    /**
+     * A stand-in WriteTelemetryEvents endpoint on this machine that counts the events in each batch it receives and
+     * answers with success or a 503, and the pipeline under test, shared by the latent command of one test.
+     */
+    struct FSession
+    {
+        explicit FSession(FAutomationTestBase* inTest)
+            : test(inTest)
+        {
+            UPlayFabRuntimeSettings* runtimeSettings = GetMutableDefault<UPlayFabRuntimeSettings>();
+            savedUrl = runtimeSettings->ProductionEnvironmentURL;
+            savedTitleId = runtimeSettings->TitleId;
+            savedEntityToken = PlayFabSettings::GetEntityToken();
+            runtimeSettings->ProductionEnvironmentURL = FString::Printf(TEXT("http://127.0.0.1:%u"), standInPort);
+            if (runtimeSettings->TitleId.IsEmpty())
+                runtimeSettings->TitleId = TEXT("TEST");
+            PlayFabSettings::SetEntityToken(TEXT("telemetry-test-token"));
+
+            settings.SpoolDirectory = FPaths::AutomationTransientDir() / TEXT("PlayFabTelemetry");
+            settings.bCompress = false;
+            settings.MaxEventsPerBatch = maxEventsPerBatch;
+            settings.MaxBatchBytes = maxBatchBytes;
+            settings.FlushIntervalSeconds = 0.1f;
+            settings.MinRetrySeconds = retrySeconds;
+            settings.MaxRetrySeconds = retrySeconds;
+            IFileManager::Get().DeleteDirectory(*settings.SpoolDirectory, false, true);
+        }
+
+        ~FSession()
+        {
+            pipeline.Reset();
+            if (router.IsValid())
+                router->UnbindRoute(route);
+
+            UPlayFabRuntimeSettings* runtimeSettings = GetMutableDefault<UPlayFabRuntimeSettings>();
+            runtimeSettings->ProductionEnvironmentURL = savedUrl;
+            runtimeSettings->TitleId = savedTitleId;
+            PlayFabSettings::SetEntityToken(savedEntityToken);
+            IFileManager::Get().DeleteDirectory(*settings.SpoolDirectory, false, true);
+        }
+
+        bool Start()
+        {
+            router = FHttpServerModule::Get().GetHttpRouter(standInPort);
+            if (!router.IsValid())
+                return false;
+
+            route = router->BindRoute(FHttpPath(TEXT("/Event/WriteTelemetryEvents")), EHttpServerRequestVerbs::VERB_POST,
+                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+                {
+                    ++hits;
+                    if (bFailing)
+                    {
+                        TUniquePtr<FHttpServerResponse> response = FHttpServerResponse::Create(
+                            TEXT("{\"code\":503,\"status\":\"ServiceUnavailable\",\"error\":\"ServiceUnavailable\",\"errorCode\":1123,\"errorMessage\":\"Stand-in is down\"}"),
+                            TEXT("application/json"));
+                        response->Code = EHttpServerResponseCodes::ServiceUnavail;
+                        OnComplete(MoveTemp(response));
+                        return true;
+                    }
+
+                    const FUTF8ToTCHAR body((const ANSICHAR*)Request.Body.GetData(), Request.Body.Num());
+                    TSharedPtr<FJsonObject> batch;
+                    const TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(FString(body.Length(), body.Get()));
+                    const int32 numEvents = FJsonSerializer::Deserialize(reader, batch) && batch.IsValid() ? batch->GetArrayField(TEXT("Events")).Num() : 0;
+                    batchSizes.Add(numEvents);
+                    maxBodyBytes = FMath::Max(maxBodyBytes, Request.Body.Num());
+                    eventsReceived += numEvents;
+
+                    OnComplete(FHttpServerResponse::Create(TEXT("{\"code\":200,\"status\":\"OK\",\"data\":{\"AssignedEventIds\":[]}}"), TEXT("application/json")));
+                    return true;
+                });
+            FHttpServerModule::Get().StartAllListeners();
+            if (!route.IsValid())
+                return false;
+
+            pipeline = PlayFabTelemetryPipeline::Create(settings);
+            return true;
+        }
+
+        void Enqueue(int32 count)
+        {
+            for (int32 i = 0; i < count; ++i)
+                pipeline->Enqueue(MakeEvent(nextEvent++));
+            pipeline->Flush();
+        }
+
+        FAutomationTestBase* test;
+        FPlayFabTelemetrySettings settings;
+        TSharedPtr<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> pipeline;
+        FString savedUrl;
+        FString savedTitleId;
+        FString savedEntityToken;
+        TSharedPtr<IHttpRouter> router;
+        FHttpRouteHandle route;
+        bool bFailing = false;
+        int32 hits = 0;
+        int32 eventsReceived = 0;
+        int32 maxBodyBytes = 0;
+        TArray<int32> batchSizes;
+        int32 nextEvent = 0;
+    };
+
+    /**
+     * Sends a burst through a healthy endpoint, then fails the endpoint and checks the batch is spooled and nothing is
+     * sent while backing off, then restarts the pipeline on a healthy endpoint and checks the spool is replayed.
+     */
+    class FTelemetryPipelineCommand : public IAutomationLatentCommand
+    {
+    public:
+        explicit FTelemetryPipelineCommand(const TSharedRef<FSession>& inSession)
+            : session(inSession)
+        {
+        }
+
+        virtual bool Update() override
+        {
+            FAutomationTestBase& test = *session->test;
+            const double now = FPlatformTime::Seconds();
+            if (start == 0.0)
+            {
+                start = now;
+                session->Enqueue(batchedEvents);
+            }
+            else if (now - start > timeoutSeconds)
+            {
+                test.AddError(FString::Printf(TEXT("Telemetry pipeline: timed out in phase %d"), (int32)phase));
+                return true;
+            }
+
+            const FPlayFabTelemetryStats stats = session->pipeline->GetStats();
+            switch (phase)
+            {
+            case EPhase::Batching:
+            {
+                if (stats.EventsSent < batchedEvents)
+                    return false;
+
+                test.TestEqual(TEXT("Batching: events received"), session->eventsReceived, batchedEvents);
+                test.TestTrue(TEXT("Batching: split into several batches"), session->batchSizes.Num() > 1);
+                test.TestTrue(TEXT("Batching: no batch over the event limit"), FMath::Max(session->batchSizes) <= maxEventsPerBatch);
+                test.TestTrue(TEXT("Batching: no batch over the byte limit"), session->maxBodyBytes <= maxBatchBytes);
+
+                session->bFailing = true;
+                session->Enqueue(failedEvents);
+                phase = EPhase::Spooling;
+                return false;
+            }
+            case EPhase::Spooling:
+            {
+                if (stats.BatchesFailed == 0 || stats.SpooledBatches == 0 || CountSpoolFiles(session->settings.SpoolDirectory) == 0)
+                    return false;
+
+                test.TestEqual(TEXT("Spooling: failed batch spooled"), stats.SpooledBatches, 1);
+                failTime = now;
+                hitsAtFailure = session->hits;
+                session->Enqueue(backoffEvents);
+                phase = EPhase::BackingOff;
+                return false;
+            }
+            case EPhase::BackingOff:
+            {
+                if (now - failTime < retrySeconds * 0.5f)
+                    return false;
+
+                test.TestEqual(TEXT("Backing off: nothing sent"), session->hits, hitsAtFailure);
+                test.TestEqual(TEXT("Backing off: new events spooled"), stats.SpooledBatches, 2);
+
+                // The next session finds the spool on a healthy endpoint
+                session->pipeline.Reset();
+                test.TestEqual(TEXT("Shutdown: spool on disk"), CountSpoolFiles(session->settings.SpoolDirectory), 2);
+                session->bFailing = false;
+                session->pipeline = PlayFabTelemetryPipeline::Create(session->settings);
+                test.TestEqual(TEXT("Restart: spool found"), session->pipeline->GetStats().SpooledBatches, 2);
+                phase = EPhase::Replaying;
+                return false;
+            }
+            case EPhase::Replaying:
+            {
+                if (stats.SpooledBatches > 0 || stats.EventsSent < failedEvents + backoffEvents)
+                    return false;
+
+                test.TestEqual(TEXT("Replaying: events received in total"), session->eventsReceived, batchedEvents + failedEvents + backoffEvents);
+                test.TestEqual(TEXT("Replaying: nothing dropped"), stats.EventsDropped, (int64)0);
+
+                // Deleting a resent file runs on the next spool task
+                if (CountSpoolFiles(session->settings.SpoolDirectory) > 0)
+                    return false;
+
+                test.AddInfo(FString::Printf(TEXT("%d batches received, largest %d bytes"), session->batchSizes.Num(), session->maxBodyBytes));
+                return true;
+            }
+            }
+            return true;
+        }
+
+    private:
+        enum class EPhase : uint8
+        {
+            Batching,
+            Spooling,
+            BackingOff,
+            Replaying
+        };
+
+        TSharedRef<FSession> session;
+        EPhase phase = EPhase::Batching;
+        double start = 0.0;
+        double failTime = 0.0;
+        int32 hitsAtFailure = 0;
+    };
+}
+
+/**
+ * Run PlayFabTelemetryPipeline against a local stand-in endpoint: batch limits, spooling a failed batch to disk, backing
+ * off after the failure and replaying the spool in the next session
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabTelemetryPipelineTest, "PlayFab.Cpp.TelemetryPipeline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FPlayFabTelemetryPipelineTest::RunTest(const FString& Parameters)
+{
+    using namespace PlayFabTelemetryTests;
+
+    AddExpectedError(TEXT("Telemetry endpoint unreachable"), EAutomationExpectedErrorFlags::Contains, 1);
+
+    const TSharedRef<FSession> session = MakeShared<FSession>(this);
+    if (!TestTrue(TEXT("Stand-in server must start"), session->Start()))
+    {
+        return false;
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FTelemetryPipelineCommand(session));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
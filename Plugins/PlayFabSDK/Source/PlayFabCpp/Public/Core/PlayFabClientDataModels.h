@@ -1016,6 +1016,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -1099,6 +1100,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
@@ -4189,6 +4191,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4270,6 +4273,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -4747,6 +4751,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardAroundPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -5165,6 +5170,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetPaymentTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5465,6 +5471,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -5492,6 +5499,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7348,6 +7356,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7398,6 +7407,7 @@ namespace ClientModels
 
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserRequest : public PlayFab::FPlayFabCppRequestCommon
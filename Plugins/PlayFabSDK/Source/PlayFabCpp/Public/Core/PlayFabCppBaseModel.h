@@ -18,6 +18,8 @@ namespace PlayFab
     typedef TSharedRef< TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR> > > JsonWriter;
     typedef TSharedRef< TJsonReader<TCHAR> > JsonReader;
 
+    class FPlayFabJsonPullReader;
+
     template <typename BoxedType>
     class PLAYFABCPP_API Boxed
     {
@@ -46,6 +48,8 @@ namespace PlayFab
         virtual void writeJSON(JsonWriter& Json) const = 0;
         virtual bool readFromValue(const TSharedPtr<FJsonObject>& obj) = 0;
         virtual bool readFromValue(const TSharedPtr<FJsonValue>& value) { return false; };
+        // Reads straight from a response. Models without their own implementation build a json tree of just their part and read that
+        virtual bool readFromReader(FPlayFabJsonPullReader& reader);
 
         FString toJSONString() const;
     };
@@ -108,6 +112,7 @@ namespace PlayFab
         void writeJSON(JsonWriter& writer) const override;
         bool readFromValue(const TSharedPtr<class FJsonObject>& obj) override;
         bool readFromValue(const TSharedPtr<class FJsonValue>& value) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
 
         TSharedPtr<class FJsonValue> GetJsonValue() const { return JsonValue; };
     };
@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+namespace PlayFab
+{
+    /**
+     * Forward only reader over a UTF-8 JSON response, for decoding straight into the models without a FJsonObject tree.
+     * Field names are compared in place and skipped values aren't decoded, so fields a model doesn't know cost no
+     * allocations. Short strings that repeat within a response, like catalog versions, item classes and currency codes,
+     * are decoded once and copied after that.
+     * A value of the wrong type is skipped and the read returns false, like the tree path ignores it. Malformed input
+     * puts the reader in an error state where every read fails.
+     *
+     *     if (reader.BeginObject())
+     *         while (reader.NextField())
+     *             if (reader.IsField("Name")) reader.ReadString(Name); else reader.SkipValue();
+     */
+    class PLAYFABCPP_API FPlayFabJsonPullReader
+    {
+    public:
+        FPlayFabJsonPullReader(const uint8* data, int32 length);
+        explicit FPlayFabJsonPullReader(const TArray<uint8>& data) : FPlayFabJsonPullReader(data.GetData(), data.Num()) {}
+
+        bool BeginObject();
+        // Moves to the next field of the object, false at its end
+        bool NextField();
+        bool IsField(const ANSICHAR* name) const;
+        void ReadFieldName(FString& outName);
+
+        bool BeginArray();
+        // Moves to the next element of the array, false at its end
+        bool NextElement();
+
+        // Consumes the value and returns true if it's null
+        bool TryReadNull();
+        bool ReadString(FString& outValue);
+        // For values likely to repeat in the response
+        bool ReadInternedString(FString& outValue);
+        bool ReadBool(bool& outValue);
+        bool ReadNumber(double& outValue);
+        bool ReadDatetime(FDateTime& outValue);
+        bool ReadStringArray(TArray<FString>& outValue);
+        bool SkipValue();
+
+        // Integers are rounded and range checked like FJsonValue::TryGetNumber
+        template <typename NumberType>
+        bool ReadNumber(NumberType& outValue)
+        {
+            double value;
+            if (!ReadNumber(value))
+                return false;
+
+            if (TIsFloatingPoint<NumberType>::Value)
+            {
+                outValue = (NumberType)value;
+                return true;
+            }
+            if (value < (double)TNumericLimits<NumberType>::Min() || value > (double)TNumericLimits<NumberType>::Max())
+                return false;
+            outValue = (NumberType)FMath::RoundHalfFromZero(value);
+            return true;
+        }
+
+        template <typename ModelType>
+        bool ReadModel(TSharedPtr<ModelType>& outValue)
+        {
+            outValue = MakeShareable(new ModelType());
+            return outValue->readFromReader(*this);
+        }
+
+        template <typename ModelType>
+        bool ReadModelArray(TArray<ModelType>& outValue)
+        {
+            if (!BeginArray())
+                return false;
+
+            while (NextElement())
+                outValue.AddDefaulted_GetRef().readFromReader(*this);
+            return !HasError();
+        }
+
+        template <typename ModelType>
+        bool ReadModelMap(TMap<FString, ModelType>& outValue)
+        {
+            if (!BeginObject())
+                return false;
+
+            FString key;
+            while (NextField())
+            {
+                ReadFieldName(key);
+                outValue.Add(key).readFromReader(*this);
+            }
+            return !HasError();
+        }
+
+        template <typename NumberType>
+        bool ReadNumberMap(TMap<FString, NumberType>& outValue)
+        {
+            if (!BeginObject())
+                return false;
+
+            FString key;
+            while (NextField())
+            {
+                ReadFieldName(key);
+                NumberType value = NumberType();
+                ReadNumber(value);
+                outValue.Add(key, value);
+            }
+            return !HasError();
+        }
+
+        bool ReadStringMap(TMap<FString, FString>& outValue);
+
+        // Builds the value as a FJsonValue, for models without a streaming reader
+        TSharedPtr<FJsonValue> ReadJsonValue();
+
+        bool HasError() const { return !errorMessage.IsEmpty(); }
+        const FString& GetErrorMessage() const { return errorMessage; }
+
+    private:
+        // A string token as it is in the buffer, between the quotes
+        struct FRawString
+        {
+            const uint8* start = nullptr;
+            int32 length = 0;
+            bool bEscaped = false;
+        };
+
+        struct FInternedString
+        {
+            const uint8* start;
+            int32 length;
+            FString value;
+        };
+
+        // Skips whitespace and returns the next character without consuming it, 0 at the end
+        uint8 Peek();
+        bool Consume(uint8 expected);
+        bool ParseRawString(FRawString& outString);
+        void DecodeString(const FRawString& rawString, FString& outValue) const;
+        void DecodeInternedString(const FRawString& rawString, FString& outValue);
+        bool ParseNumber(double& outValue);
+        bool ParseLiteral(const ANSICHAR* literal);
+        bool SetError(const TCHAR* message);
+
+        const uint8* begin;
+        const uint8* cursor;
+        const uint8* end;
+        FRawString fieldName;
+        // Set by the start of an object or array, so the first field or element doesn't need a comma
+        bool bAtContainerStart;
+        int32 depth;
+        FString errorMessage;
+
+        // Unescaped UTF-8, reused between strings
+        mutable TArray<uint8> unescapeScratch;
+        TArray<FInternedString> internedStrings;
+        TMap<uint32, int32> internedIndices;
+    };
+}
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+namespace PlayFab
+{
+    // Endpoint families that share a concurrency limit, picked from the first segment of the url path
+    enum class EPlayFabRequestFamily : uint8
+    {
+        Client,
+        Server,
+        Multiplayer,
+        Events,
+        Other,
+        Count
+    };
+
+    enum class EPlayFabRequestPriority : uint8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    // Snapshot of the counters kept for one endpoint, such as "/Server/UpdatePlayerStatistics"
+    struct PLAYFABCPP_API FPlayFabEndpointStats
+    {
+        // Calls queued or in flight
+        int32 Pending = 0;
+        int64 Completed = 0;
+        // Calls answered by an identical call that was still queued
+        int64 Coalesced = 0;
+        double TotalQueueSeconds = 0.0;
+        // From the call being issued to its response
+        double TotalLatencySeconds = 0.0;
+        double MaxLatencySeconds = 0.0;
+
+        double GetAverageLatencySeconds() const { return Completed > 0 ? TotalLatencySeconds / Completed : 0.0; }
+    };
+
+    /**
+     * Issues the requests built by PlayFabRequestHandler.
+     * Each endpoint family has a max number of calls in flight, calls past it wait in a per family priority queue and are
+     * issued as earlier calls complete. Read only calls (Get*, List*) identical to one still waiting in a queue are not
+     * sent, they get the response of the queued call. Calls are never joined onto one already sent, or onto one queued
+     * before a write, since its response may predate that write. Thread safe, completion delegates run wherever the HTTP module runs them.
+     */
+    class PLAYFABCPP_API PlayFabRequestScheduler
+    {
+    public:
+        static PlayFabRequestScheduler& Get();
+
+        // Issues HttpRequest, or queues it when its family is at its limit. Its completion delegate must be bound already
+        bool ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest);
+
+        // Overrides the limit read from UPlayFabRuntimeSettings, 0 is unlimited
+        void SetMaxInFlight(EPlayFabRequestFamily family, int32 maxInFlight);
+        int32 GetMaxInFlight(EPlayFabRequestFamily family) const;
+        int32 GetNumInFlight(EPlayFabRequestFamily family) const;
+        int32 GetNumQueued(EPlayFabRequestFamily family) const;
+
+        bool GetEndpointStats(const FString& urlPath, FPlayFabEndpointStats& OutStats) const;
+        TMap<FString, FPlayFabEndpointStats> GetAllEndpointStats() const;
+        void ResetEndpointStats();
+
+        // "/Server/GetPlayerStatistics" from "https://title.playfabapi.com/Server/GetPlayerStatistics?sdk=..."
+        static FString GetUrlPath(const FString& fullUrl);
+        static EPlayFabRequestFamily GetFamily(const FString& urlPath);
+        static bool IsReadOnly(const FString& urlPath);
+
+        // Calls issued on this thread while in scope use this priority, by default Events calls are Low and others Normal
+        class PLAYFABCPP_API FScopedPriority
+        {
+        public:
+            explicit FScopedPriority(EPlayFabRequestPriority priority);
+            ~FScopedPriority();
+        private:
+            int32 previousPriority;
+        };
+
+    private:
+        struct FEndpointCounters
+        {
+            std::atomic<int32> pending{ 0 };
+            std::atomic<int64> completed{ 0 };
+            std::atomic<int64> coalesced{ 0 };
+            std::atomic<int64> totalQueueMicros{ 0 };
+            std::atomic<int64> totalLatencyMicros{ 0 };
+            std::atomic<int64> maxLatencyMicros{ 0 };
+        };
+
+        struct FCoalescedCall
+        {
+            TSharedRef<IHttpRequest> request;
+            FHttpRequestCompleteDelegate onComplete;
+            double issueTime;
+        };
+
+        struct FScheduledCall
+        {
+            uint64 id = 0;
+            TSharedPtr<IHttpRequest> request;
+            FHttpRequestCompleteDelegate onComplete;
+            EPlayFabRequestFamily family = EPlayFabRequestFamily::Other;
+            EPlayFabRequestPriority priority = EPlayFabRequestPriority::Normal;
+            FString coalesceKey;
+            TSharedPtr<FEndpointCounters> counters;
+            double issueTime = 0.0;
+            double dispatchTime = 0.0;
+            bool bDispatched = false;
+            TArray<FCoalescedCall> coalescedCalls;
+        };
+
+        PlayFabRequestScheduler();
+
+        void OnRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, uint64 id);
+        void Complete(uint64 id, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        bool Dispatch(const TSharedPtr<FScheduledCall>& call);
+        // Moves queued calls of family that fit under its limit to outCalls, caller holds the lock
+        void PopDispatchable(EPlayFabRequestFamily family, TArray<TSharedPtr<FScheduledCall>>& outCalls);
+        bool HasFreeSlot(EPlayFabRequestFamily family) const;
+        TSharedPtr<FEndpointCounters> FindOrAddCounters(const FString& urlPath);
+
+        static bool CallPredicate(const TSharedPtr<FScheduledCall>& A, const TSharedPtr<FScheduledCall>& B);
+        static FString MakeCoalesceKey(const IHttpRequest& HttpRequest);
+        static void RecordCompletion(FEndpointCounters& counters, double issueTime, double dispatchTime, double now);
+
+        mutable FCriticalSection criticalSection;
+        uint64 nextId;
+        int32 maxInFlight[(int32)EPlayFabRequestFamily::Count];
+        int32 numInFlight[(int32)EPlayFabRequestFamily::Count];
+        // Heaps ordered by priority then issue order
+        TArray<TSharedPtr<FScheduledCall>> queues[(int32)EPlayFabRequestFamily::Count];
+        TMap<uint64, TSharedPtr<FScheduledCall>> scheduledCalls;
+        // Coalesce key of each queued read only call to its id
+        TMap<FString, uint64> coalesceLeaders;
+        TMap<FString, TSharedPtr<FEndpointCounters>> endpointCounters;
+    };
+};
@@ -12,17 +12,24 @@
 #include "PlayFabSettings.h"
 #include "Http.h"
 
+#include <atomic>
+
 namespace PlayFab
 {
     class PlayFabRequestHandler
     {
     private:
-        static int pendingCalls;
+        static std::atomic<int> pendingCalls;
     public:
         static int GetPendingCalls();
         static TSharedRef<IHttpRequest> SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const FString& callBody, const FString& authKey, const FString& authValue);
         static TSharedRef<IHttpRequest> SendFullUrlRequest(const FString& fullUrl, const FString& callBody, const FString& authKey, const FString& authValue);
+        // Issues a request built by SendRequest through PlayFabRequestScheduler, bind its completion delegate first
+        static bool ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest);
         static bool DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError);
+        // Reads the data of a successful response straight from its bytes into the result, without a json tree. When it
+        // returns false bOutIsError says whether the response carries an error for DecodeError instead
+        static bool DecodeContent(const TArray<uint8>& Content, PlayFab::FPlayFabCppBaseModel& OutResult, bool& bOutIsError);
         static bool DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError);
     };
 };
@@ -0,0 +1,196 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Core/PlayFabEventsDataModels.h"
+#include "Http.h"
+
+#include <atomic>
+
+namespace PlayFab
+{
+    struct PLAYFABCPP_API FPlayFabTelemetrySettings
+    {
+        // [optional] Context whose entity token authenticates the batches, the global entity token if null
+        TSharedPtr<UPlayFabAuthenticationContext> AuthenticationContext;
+        // [optional] Tags added to every batch, merged with each event's own tags by the service
+        TMap<FString, FString> CustomTags;
+        // Send to WriteTelemetryEvents, which skips PlayStream, rather than WriteEvents
+        bool bTelemetryEndpoint = true;
+        // Gzip the request bodies
+        bool bCompress = true;
+        // The service accepts at most 200 events per request
+        int32 MaxEventsPerBatch = 200;
+        // Uncompressed JSON size a batch stays under, an event bigger than this on its own is sent alone
+        int32 MaxBatchBytes = 256 * 1024;
+        // Longest an event waits in the queue before a partial batch is sent
+        float FlushIntervalSeconds = 5.0f;
+        // Events queued past this are dropped, bounding memory while the service can't keep up
+        int32 MaxQueuedEvents = 20000;
+        // Batches sent at once
+        int32 MaxBatchesInFlight = 2;
+        // Where batches that couldn't be delivered wait for the endpoint to come back, empty to drop them instead
+        FString SpoolDirectory;
+        // Oldest spooled batches are deleted past this
+        int64 MaxSpoolBytes = 32 * 1024 * 1024;
+        // Delay before retrying after a failure, doubling with each failure in a row up to the max
+        float MinRetrySeconds = 5.0f;
+        float MaxRetrySeconds = 300.0f;
+    };
+
+    // Counters for monitoring backpressure, totals are since the pipeline was created
+    struct PLAYFABCPP_API FPlayFabTelemetryStats
+    {
+        int32 QueuedEvents = 0;
+        int32 MaxQueuedEvents = 0;
+        int32 BatchesInFlight = 0;
+        int32 SpooledBatches = 0;
+        int64 SpooledBytes = 0;
+        int64 EventsEnqueued = 0;
+        int64 EventsSent = 0;
+        // Events dropped because the queue was full
+        int64 EventsDroppedQueueFull = 0;
+        // Events the service rejected, or that were spooled and then deleted to make room
+        int64 EventsDropped = 0;
+        int64 BatchesSent = 0;
+        int64 BatchesFailed = 0;
+        int64 UncompressedBytes = 0;
+        int64 CompressedBytes = 0;
+
+        double GetCompressionRatio() const { return CompressedBytes > 0 ? (double)UncompressedBytes / CompressedBytes : 1.0; }
+    };
+
+    /**
+     * Buffers gameplay events and writes them to the Events API in batches.
+     * Any thread can enqueue, events go into a lock free queue. A thread pool task encodes them into batches of up to
+     * MaxEventsPerBatch events or MaxBatchBytes of JSON, reusing the same buffers for every batch, and gzips the body. A
+     * batch is closed when full or when its oldest event has waited FlushIntervalSeconds.
+     * Batches that fail because the endpoint is unreachable, throttling or erroring are spooled to disk, including across
+     * sessions, and resent with exponential backoff. Ticked and sent from the game thread, spool files are written, read
+     * and deleted on the thread pool.
+     */
+    class PLAYFABCPP_API PlayFabTelemetryPipeline : public TSharedFromThis<PlayFabTelemetryPipeline, ESPMode::ThreadSafe>
+    {
+    public:
+        static TSharedRef<PlayFabTelemetryPipeline, ESPMode::ThreadSafe> Create(const FPlayFabTelemetrySettings& settings);
+
+        // Spools anything not sent yet
+        ~PlayFabTelemetryPipeline();
+
+        // Thread safe. Returns false and drops the event if the queue is full
+        bool Enqueue(EventsModels::FEventContents&& event);
+        bool Enqueue(const EventsModels::FEventContents& event);
+
+        // Closes a batch with whatever is queued on the next tick, without waiting for the flush interval
+        void Flush();
+
+        // Stops sending and spools everything still queued so it goes out next session. Called by the destructor
+        void Shutdown();
+
+        // Game thread
+        FPlayFabTelemetryStats GetStats() const;
+
+        // "<path>/PlayFab/Telemetry" in the project's saved directory
+        static FString GetDefaultSpoolDirectory();
+
+    private:
+        struct FBatch
+        {
+            TArray<uint8> body;
+            int32 numEvents = 0;
+            int32 uncompressedBytes = 0;
+            bool bCompressed = false;
+            // File the batch was loaded from, if it was spooled
+            FString spoolFile;
+        };
+
+        struct FSpoolEntry
+        {
+            FString file;
+            int64 bytes = 0;
+            int32 numEvents = 0;
+            // Kept in memory until its file is written, and resent from here meanwhile
+            TSharedPtr<FBatch> unwritten;
+        };
+
+        explicit PlayFabTelemetryPipeline(const FPlayFabTelemetrySettings& settings);
+
+        bool Tick(float DeltaTime);
+        bool ShouldCloseBatch(double now) const;
+        void StartEncode();
+        // Runs on the thread pool, or the game thread during shutdown
+        TSharedPtr<FBatch> EncodeBatch();
+        void Send(const TSharedPtr<FBatch>& batch);
+        void OnBatchComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedPtr<FBatch> batch);
+        void OnEndpointUnreachable();
+
+        void LoadSpool();
+        void Spool(const TSharedPtr<FBatch>& batch);
+        void RemoveSpooled(const FString& file);
+        void TrimSpool();
+        // Collects the last spool task's results and hands queued writes and deletes to a new one
+        void UpdateSpoolTask();
+        // Resends the oldest spooled batch, from memory or through a load on the thread pool
+        void UpdateResend();
+
+        // Run on the thread pool, or the game thread during shutdown. Returns the files that couldn't be written
+        static TArray<FString> WriteSpool(const TArray<TSharedPtr<FBatch>>& writes, const TArray<FString>& deletes);
+        static TSharedPtr<FBatch> LoadSpooledBatch(const FSpoolEntry& entry);
+
+        FString GetEntityToken() const;
+        FString GetUrlPath() const;
+
+        FPlayFabTelemetrySettings settings;
+        FTSTicker::FDelegateHandle tickHandle;
+        std::atomic<bool> bShutdown;
+
+        // Producers
+        TQueue<EventsModels::FEventContents, EQueueMode::Mpsc> queue;
+        std::atomic<int32> numQueued;
+        std::atomic<double> firstQueuedTime;
+        std::atomic<bool> bFlushRequested;
+
+        // Opens every batch's JSON, up to and including the Events array, with the custom tags already written
+        FString batchPrefix;
+
+        // Only touched by whoever holds the encode task, the buffers keep their allocations between batches
+        TArray<uint8> jsonScratch;
+        TArray<uint8> eventScratch;
+        TArray<uint8> utf8Scratch;
+        TFuture<TSharedPtr<FBatch>> encodeTask;
+
+        // Game thread
+        int32 batchesInFlight;
+        bool bResendInFlight;
+        int32 failuresInARow;
+        double nextSendTime;
+        TArray<FSpoolEntry> spooled;
+        int64 spooledBytes;
+        int32 spoolCounter;
+        // Waiting for the next spool task, which runs them in order after the one in progress
+        TArray<TSharedPtr<FBatch>> spoolWrites;
+        TArray<FString> spoolDeletes;
+        // Files the spool task in progress is writing
+        TArray<FString> spoolWritesInProgress;
+        TFuture<TArray<FString>> spoolTask;
+        TFuture<TSharedPtr<FBatch>> resendLoadTask;
+
+        // Stats written from several threads
+        std::atomic<int32> maxQueued;
+        std::atomic<int64> eventsEnqueued;
+        std::atomic<int64> eventsDroppedQueueFull;
+        std::atomic<int64> uncompressedBytes;
+        std::atomic<int64> compressedBytes;
+        int64 eventsSent;
+        int64 eventsDropped;
+        int64 batchesSent;
+        int64 batchesFailed;
+    };
+};
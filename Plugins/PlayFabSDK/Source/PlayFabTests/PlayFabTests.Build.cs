@@ -0,0 +1,29 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+using UnrealBuildTool;
+using System.IO; 
+
+// Automation tests that need their own UObjects, a DeveloperTool module so none of it reaches a shipping build
+public class PlayFabTests : ModuleRules
+{
+    public PlayFabTests(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private"));
+
+        PrivateDependencyModuleNames.AddRange(new string[]{
+            "Core",
+            "CoreUObject",
+            "Engine",
+            "HTTP",
+            "HTTPServer",
+            "Json",
+            "PlayFab",
+            "PlayFabCommon",
+            "PlayFabCpp"
+        });
+    }
+}
@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabTestListener.h"
+
+#include "HAL/PlatformTime.h"
+
+void UPlayFabTestListener::OnGetUserData(FClientGetUserDataResult result, UObject* customData)
+{
+    lastDataVersion = result.DataVersion;
+    Record(true);
+}
+
+void UPlayFabTestListener::OnError(FPlayFabError error, UObject* customData)
+{
+    lastError = error.ErrorMessage;
+    Record(false);
+}
+
+void UPlayFabTestListener::Record(bool succeeded)
+{
+    ++(succeeded ? numSucceeded : numFailed);
+    lastResponseTime = FPlatformTime::Seconds();
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Misc/AutomationTest.h"
+#include "PlayFabClientAPI.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+
+namespace PlayFabBlueprintTests
+{
+    // Away from anything else a developer may be running locally
+    const uint32 standInPort = 19480;
+    const double timeoutSeconds = 30.0;
+    const int32 sequentialCalls = 200;
+    const int32 burstCalls = 200;
+    // Sized like a title's save data, so the response log and decode aren't trivially small
+    const int32 userDataKeys = 40;
+    const int32 dataVersion = 17;
+
+    FString MakeGetUserDataResponse()
+    {
+        FString data;
+        for (int32 i = 0; i < userDataKeys; ++i)
+        {
+            if (i > 0)
+                data.AppendChar(TEXT(','));
+            data += FString::Printf(TEXT("\"key_%d\":{\"Value\":\"%s\",\"LastUpdated\":\"2021-06-01T12:00:00.000Z\",\"Permission\":\"Private\"}"),
+                i, *FString::ChrN(64 + (i % 4) * 32, (TCHAR)(TEXT('a') + i % 26)));
+        }
+        return FString::Printf(TEXT("{\"code\":200,\"status\":\"OK\",\"data\":{\"Data\":{%s},\"DataVersion\":%d}}"), *data, dataVersion);
+    }
+
+    int32 CountProxies()
+    {
+        int32 count = 0;
+        for (TObjectIterator<UPlayFabClientAPI> it; it; ++it)
+            ++count;
+        return count;
+    }
+
+    /**
+     * Points the Blueprint API at a stand-in server on this machine that answers GetUserData with a canned response,
+     * shared by the latent commands of one test.
+     */
+    struct FSession
+    {
+        explicit FSession(FAutomationTestBase* inTest)
+            : test(inTest)
+            , listener(NewObject<UPlayFabTestListener>(GetTransientPackage()))
+            , responseBody(MakeGetUserDataResponse())
+        {
+            UPlayFabRuntimeSettings* settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+            savedUrl = settings->ProductionEnvironmentURL;
+            settings->ProductionEnvironmentURL = FString::Printf(TEXT("http://127.0.0.1:%u"), standInPort);
+
+            onSuccess.BindUFunction(listener.Get(), GET_FUNCTION_NAME_CHECKED(UPlayFabTestListener, OnGetUserData));
+            onError.BindUFunction(listener.Get(), GET_FUNCTION_NAME_CHECKED(UPlayFabTestListener, OnError));
+        }
+
+        ~FSession()
+        {
+            if (router.IsValid())
+                router->UnbindRoute(route);
+            GetMutableDefault<UPlayFabRuntimeSettings>()->ProductionEnvironmentURL = savedUrl;
+        }
+
+        bool Start()
+        {
+            router = FHttpServerModule::Get().GetHttpRouter(standInPort);
+            if (!router.IsValid())
+                return false;
+
+            route = router->BindRoute(FHttpPath(TEXT("/Client/GetUserData")), EHttpServerRequestVerbs::VERB_POST,
+                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+                {
+                    ++hits;
+                    OnComplete(FHttpServerResponse::Create(responseBody, TEXT("application/json")));
+                    return true;
+                });
+            FHttpServerModule::Get().StartAllListeners();
+            return route.IsValid();
+        }
+
+        void IssueGetUserData()
+        {
+            FClientGetUserDataRequest request;
+            request.Keys = TEXT("key_0,key_1,key_2,key_3");
+            UPlayFabClientAPI::GetUserData(request, onSuccess, onError, nullptr)->Activate();
+        }
+
+        FAutomationTestBase* test;
+        TStrongObjectPtr<UPlayFabTestListener> listener;
+        UPlayFabClientAPI::FDelegateOnSuccessGetUserData onSuccess;
+        UPlayFabClientAPI::FDelegateOnFailurePlayFabError onError;
+        FString responseBody;
+        FString savedUrl;
+        TSharedPtr<IHttpRouter> router;
+        FHttpRouteHandle route;
+        int32 hits = 0;
+    };
+
+    /**
+     * Round-trip latency over sequential GetUserData calls, then calls per second over a burst. Game thread time is what
+     * the node spends creating its proxy, building the request and sending it, the response side shows in the calls per
+     * second.
+     */
+    class FGetUserDataBenchmarkCommand : public IAutomationLatentCommand
+    {
+    public:
+        explicit FGetUserDataBenchmarkCommand(const TSharedRef<FSession>& inSession)
+            : session(inSession)
+        {
+        }
+
+        virtual bool Update() override
+        {
+            UPlayFabTestListener& listener = *session->listener;
+            const double now = FPlatformTime::Seconds();
+
+            if (phaseStart == 0.0)
+            {
+                phaseStart = now;
+                proxiesBefore = CountProxies();
+            }
+            else if (now - phaseStart > timeoutSeconds)
+            {
+                session->test->AddError(TEXT("GetUserData: timed out"));
+                return true;
+            }
+
+            if (!bBurst)
+            {
+                if (bWaiting)
+                {
+                    if (listener.NumResponses() <= responsesBefore)
+                        return false;
+                    latencies.Add(listener.lastResponseTime - sendTime);
+                    bWaiting = false;
+                }
+
+                if (latencies.Num() < sequentialCalls)
+                {
+                    responsesBefore = listener.NumResponses();
+                    sendTime = FPlatformTime::Seconds();
+                    bWaiting = true;
+                    Issue();
+                    return false;
+                }
+
+                bBurst = true;
+                phaseStart = FPlatformTime::Seconds();
+                responsesBefore = listener.NumResponses();
+                for (int32 i = 0; i < burstCalls; ++i)
+                    Issue();
+                return false;
+            }
+
+            if (listener.NumResponses() - responsesBefore < burstCalls)
+                return false;
+
+            Report(listener.lastResponseTime - phaseStart);
+            return true;
+        }
+
+    private:
+        void Issue()
+        {
+            const double start = FPlatformTime::Seconds();
+            session->IssueGetUserData();
+            gameThreadSeconds += FPlatformTime::Seconds() - start;
+            ++issued;
+        }
+
+        void Report(double burstSeconds)
+        {
+            UPlayFabTestListener& listener = *session->listener;
+            if (listener.numFailed > 0)
+            {
+                session->test->AddError(FString::Printf(TEXT("GetUserData: %d calls failed, last error: %s"), listener.numFailed, *listener.lastError));
+            }
+            session->test->TestEqual(TEXT("Decoded data version"), listener.lastDataVersion, dataVersion);
+            session->test->TestEqual(TEXT("Requests the stand-in received"), session->hits, issued);
+
+            latencies.Sort();
+            const double p50 = latencies[latencies.Num() / 2];
+            const double p95 = latencies[FMath::Min(latencies.Num() - 1, latencies.Num() * 95 / 100)];
+
+            session->test->AddInfo(FString::Printf(
+                TEXT("GetUserData  p50 %7.2f ms  p95 %7.2f ms  %8.0f calls/s  %6.2f us game thread per call  %d new proxies for %d calls  %d byte responses"),
+                p50 * 1000.0, p95 * 1000.0, burstCalls / FMath::Max(burstSeconds, SMALL_NUMBER),
+                gameThreadSeconds * 1000000.0 / issued, CountProxies() - proxiesBefore, issued, session->responseBody.Len()));
+        }
+
+        TSharedRef<FSession> session;
+        TArray<double> latencies;
+        double phaseStart = 0.0;
+        double sendTime = 0.0;
+        double gameThreadSeconds = 0.0;
+        int32 issued = 0;
+        int32 responsesBefore = 0;
+        int32 proxiesBefore = 0;
+        bool bWaiting = false;
+        bool bBurst = false;
+    };
+}
+
+/**
+ * Measure a tight loop of Blueprint GetUserData calls against a local stand-in server, latency, throughput and the
+ * game thread and proxy cost per call
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayFabGetUserDataBenchmark, "PlayFab.Blueprint.Benchmark.GetUserData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FPlayFabGetUserDataBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace PlayFabBlueprintTests;
+
+    const TSharedRef<FSession> session = MakeShared<FSession>(this);
+    if (!TestTrue(TEXT("Stand-in server must start"), session->Start()))
+    {
+        return false;
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FGetUserDataBenchmarkCommand(session));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "PlayFabBaseModel.h"
+#include "PlayFabClientModels.h"
+
+#include "PlayFabTestListener.generated.h"
+
+/**
+ * Receives the Blueprint API responses in the automation tests, the APIs' delegates are dynamic and can only be bound
+ * to UFunctions. Lives in the PlayFabTests module, which isn't built for shipping.
+ */
+UCLASS(Transient)
+class UPlayFabTestListener : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION()
+        void OnGetUserData(FClientGetUserDataResult result, UObject* customData);
+
+    UFUNCTION()
+        void OnError(FPlayFabError error, UObject* customData);
+
+    /** Number of responses, successful or not */
+    int32 NumResponses() const { return numSucceeded + numFailed; }
+
+    int32 numSucceeded = 0;
+    int32 numFailed = 0;
+
+    /** FPlatformTime::Seconds() of the last response */
+    double lastResponseTime = 0.0;
+
+    int32 lastDataVersion = 0;
+    FString lastError;
+
+private:
+    void Record(bool succeeded);
+};
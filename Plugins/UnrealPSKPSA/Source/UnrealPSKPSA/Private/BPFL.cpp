@@ -17,11 +17,24 @@
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Misc/FileHelper.h"
 #include "Factories/TextureFactory.h"
+#include "EditorFramework/AssetImportData.h"
+#include "EditorLoadingAndSavingUtils.h"
+#include "Misc/SecureHash.h"
 #include "StaticMeshDescription.h"
 #include "Misc/ScopedSlowTask.h"
+#include "PSKImportManifest.h"
 #include "PSKReader.h"
 #include "Engine/RendererSettings.h"
 #include "PSKXFactory.h"
+#include "PSKXMaterialCache.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "VertexColorTransfer.h"
+#include <atomic>
 
 
 
@@ -68,70 +81,154 @@ UActorComponent* UBPFL::CreateBPComp(UObject* Object, UClass* ClassToUse, FName
 	FKismetEditorUtilities::CompileBlueprint(Blueprint);
 	return Component.Get();
 }
-void UBPFL::PaintSMVertices(UStaticMeshComponent* SMComp, TArray<FColor> VtxColorsArray, FString FileName)
+namespace BPFLVertexPaint
 {
-	TArray<FColor> FinalColors;
-	UStaticMesh* SM = SMComp->GetStaticMesh();
-	/// here is old script everythign works down here so dont bother
-	//Get the static mesh that we're going to paint
-	if (SM)
+	static TAutoConsoleVariable<float> CVarTolerance(
+		TEXT("psk.PaintVertices.Tolerance"),
+		0.01f,
+		TEXT("How far, in world units, a built mesh vertex may be from its .pskx point and still take its color."));
+
+	// Lives as long as the editor session so painting every instance of a mesh parses its .pskx once
+	FVertexColorTransfer& GetTransfer()
 	{
-		//Get the vertex buffer from the 1st lod
-		//FPositionVertexBuffer* PositionVertexBuffer = &SM->RenderData->LODResources[0].VertexBuffers.PositionVertexBuffer;
+		static FVertexColorTransfer Transfer(CVarTolerance.GetValueOnGameThread());
+		// Only rebuilds the spatial hash when psk.PaintVertices.Tolerance was changed since the last paint
+		Transfer.SetTolerance(CVarTolerance.GetValueOnGameThread());
+		return Transfer;
+	}
 
-		//Make sure that we have at least 1 LOD
-		SMComp->SetLODDataCount(1, SMComp->LODData.Num());
-		FStaticMeshComponentLODInfo* LODInfo = &SMComp->LODData[0]; //We're going to modify the 1st LOD only
-		FStaticMeshLODResources& LodResources = SM->GetRenderData()->LODResources[0];
-		auto numverts = LodResources.GetNumVertices();
-		//Empty the painted vertices and assign a new color vertex buffer which will contain the new colors for each vertex
-		LODInfo->PaintedVertices.Empty();
-		LODInfo->OverrideVertexColors = new FColorVertexBuffer();
+	// What painting a component depends on: its .pskx, the colors passed in, the tolerance and the mesh it was
+	// imported as, so re-importing the mesh repaints every component using it
+	FPSKImportRecord DescribePaint(const FVertexPaintRequest& Request, const UStaticMesh* SM, const FPSKImportManifest& Manifest)
+	{
+		const auto MeshPath = SM->GetPathName();
+		auto Record = FPSKImportRecord::Describe(MeshPath, Request.FileName, FString(),
+			FString::Printf(TEXT("Paint 1 %g"), CVarTolerance.GetValueOnGameThread()));
+
+		FMD5 MD5;
+		MD5.Update(reinterpret_cast<const uint8*>(Request.VtxColorsArray.GetData()), Request.VtxColorsArray.Num() * sizeof(FColor));
+		if (const auto MeshRecord = Manifest.Find(MeshPath))
+		{
+			const auto MeshHash = MeshRecord->GetInputHash();
+			MD5.Update(MeshHash.GetBytes(), MeshHash.GetSize());
+		}
+		Record.Dependency.Set(MD5);
+		return Record;
+	}
+
+	// The manifest only says the inputs match, the colors must also still be on the component. A level that was
+	// reloaded without saving lost them.
+	bool HasPaint(const UStaticMeshComponent* SMComp, const UStaticMesh* SM)
+	{
+		return SMComp->LODData.Num() > 0 && SMComp->LODData[0].OverrideVertexColors
+			&& SMComp->LODData[0].OverrideVertexColors->GetNumVertices() == SM->GetRenderData()->LODResources[0].GetNumVertices();
+	}
 
-		// get reader positions /////
-		const auto Reader = new PSKReader(FileName);
-		Reader->Read();
-		TArray<FVector3f> CurrentVerts = ReturnCurrentVerts(SM);
-		if (VtxColorsArray.Num() != CurrentVerts.Num())
+	// Every instance of a mesh paints from the same .pskx, so each file is hashed once per session until it changes
+	void HashPaintSource(const FString& FileName, FPSKImportRecord& Record)
+	{
+		static TMap<FString, FPSKImportFileStamp> Hashes;
+		auto& Cached = Hashes.FindOrAdd(FileName);
+		if (!Cached.Hash.IsValid() || !Cached.SameStat(Record.Source))
 		{
-			FinalColors = FixBrokenMesh(SM,FileName,VtxColorsArray, Reader->Vertices);
+			Cached = Record.Source;
+			Cached.ComputeHash(FileName);
+		}
+		Record.Source.Hash = Cached.Hash;
+		Record.bHashed = true;
+	}
 
+	void Paint(FVertexColorTransfer& Transfer, const FVertexPaintRequest& Request, TArray<FColor>& FinalColors)
+	{
+		UStaticMeshComponent* SMComp = Request.SMComp;
+		UStaticMesh* SM = SMComp ? SMComp->GetStaticMesh() : nullptr;
+		if (!SM || !SM->GetRenderData() || SM->GetRenderData()->LODResources.Num() == 0)
+		{
+			return;
 		}
-		else
+
+		auto& Manifest = FPSKImportManifest::Get();
+		const auto Key = SMComp->GetPathName();
+		auto Record = DescribePaint(Request, SM, Manifest);
+		const auto bHasPaint = HasPaint(SMComp, SM);
+		auto Decision = Manifest.Check(Key, Record, bHasPaint);
+		if (Decision == EPSKImportDecision::Hash)
 		{
-			auto Hashmap = MakeHashmap(Reader->Vertices, VtxColorsArray);
-			// Shell_3_AtkCourtyardGroundA
-			// Shell_3_AtkPathB
-			for (auto vt : CurrentVerts)
-			{
-				vt.Y = -vt.Y;
-				auto idaa = FVector3f(vt);
-				auto finder = Hashmap.Find(idaa);
-				if (finder)
-				{
-					FinalColors.Add(*finder);
-				}
-			}
+			HashPaintSource(Request.FileName, Record);
+			Decision = Manifest.Check(Key, Record, bHasPaint);
+		}
+		if (Decision == EPSKImportDecision::Skip)
+		{
+			return;
 		}
-		//Since we know beforehand the number of elements we might as well reserve the memory now
-		//Initialize the new vertex colros with the array we created above
-		if (FinalColors.Num() != CurrentVerts.Num())
+
+		const auto SourcePoints = Transfer.GetSourcePoints(Request.FileName);
+		if (!SourcePoints)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("This one has wrong FinalColors %s"), *SM->GetName());
+			UE_LOG(LogTemp, Warning, TEXT("Could not read %s to paint %s"), *Request.FileName, *SM->GetName());
+			return;
 		}
+
+		const FPositionVertexBuffer& PositionVertexBuffer = SM->GetRenderData()->LODResources[0].VertexBuffers.PositionVertexBuffer;
+		const auto NumMissing = Transfer.Transfer(*SourcePoints, Request.VtxColorsArray, PositionVertexBuffer, FinalColors);
 		if (FinalColors.IsEmpty())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("This one has no  FinalColors %s"), *SM->GetName());
 			return;
 		}
-		LODInfo->OverrideVertexColors->InitFromColorArray(FinalColors);
+		if (NumMissing > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%d of %d vertices of %s have no color within tolerance"), NumMissing, FinalColors.Num(), *SM->GetName());
+		}
 
-		//Initialize resource and mark render state of object as dirty in order for the engine to re-render it
+		//Make sure that we have at least 1 LOD
+		SMComp->SetLODDataCount(1, SMComp->LODData.Num());
+		FStaticMeshComponentLODInfo* LODInfo = &SMComp->LODData[0]; //We're going to modify the 1st LOD only
+		LODInfo->PaintedVertices.Empty();
+		if (LODInfo->OverrideVertexColors)
+		{
+			LODInfo->ReleaseOverrideVertexColorsAndBlock();
+		}
+
+		//Initialize the new vertex colors and mark render state of object as dirty in order for the engine to re-render it
+		LODInfo->OverrideVertexColors = new FColorVertexBuffer();
+		LODInfo->OverrideVertexColors->InitFromColorArray(FinalColors);
 		BeginInitResource(LODInfo->OverrideVertexColors);
 		SMComp->MarkRenderStateDirty();
+
+		if (!Record.bHashed)
+		{
+			HashPaintSource(Request.FileName, Record);
+		}
+		Manifest.Record(Key, Record);
 	}
 }
 
+void UBPFL::PaintSMVertices(UStaticMeshComponent* SMComp, TArray<FColor> VtxColorsArray, FString FileName)
+{
+	FVertexPaintRequest Request;
+	Request.SMComp = SMComp;
+	Request.VtxColorsArray = MoveTemp(VtxColorsArray);
+	Request.FileName = MoveTemp(FileName);
+
+	TArray<FColor> FinalColors;
+	BPFLVertexPaint::Paint(BPFLVertexPaint::GetTransfer(), Request, FinalColors);
+	// Not saved per component, the next import, batch or editor shutdown writes the manifest
+}
+
+void UBPFL::PaintSMVerticesBatch(const TArray<FVertexPaintRequest>& Requests)
+{
+	auto& Transfer = BPFLVertexPaint::GetTransfer();
+
+	// One buffer for the whole batch, sized for the largest mesh
+	TArray<FColor> FinalColors;
+	for (const auto& Request : Requests)
+	{
+		BPFLVertexPaint::Paint(Transfer, Request, FinalColors);
+	}
+	FPSKImportManifest::Get().Save();
+}
+
 FColor UBPFL::ReturnFromHex(FString Beka)
 {
 	return FColor::FromHex(Beka);
@@ -141,12 +238,11 @@ TMap<FVector3f, FColor> UBPFL::MakeHashmap(TArray<FVector3f> arr1, TArray<FColor
 {
 	//arr1 should be correct reader
 	TMap<FVector3f, FColor> FruitMap;
-	FruitMap.Empty();
-	int idx = 0;
-	for (auto j : arr1)
+	const int32 Count = FMath::Min(arr1.Num(), TestVtx.Num());
+	FruitMap.Reserve(Count);
+	for (int32 idx = 0; idx < Count; idx++)
 	{
-		FruitMap.Add(j, TestVtx[idx]);
-		idx++;
+		FruitMap.Add(arr1[idx], TestVtx[idx]);
 	}
 	return FruitMap;
 }
@@ -167,11 +263,12 @@ TArray<FColor> UBPFL::FixBrokenMesh(UStaticMesh* SMesh, FString ReaderFile, TArr
 	int index = -1;
 	// from the new array without the missing ones if  equals the vtxpos and hasnt been changed yet add to the vtx colors at the index "correct
 	auto Hasher = MakeHashmap(ReaderVerts, BrokenVtxColorArray);
+	LocalVtxColors.Reserve(CurrentVerticesPosition.Num());
 	for (auto vt : CurrentVerticesPosition)
 	{
+		// Welded or moved vertices have no exact match, keep the array aligned with the mesh vertices
 		auto finder = Hasher.Find(FVector3f(vt));
-		LocalVtxColors.Add(*finder);
-
+		LocalVtxColors.Add(finder ? *finder : FColor::White);
 	}
 	return LocalVtxColors;
 }
@@ -185,12 +282,11 @@ TArray<FVector3f> UBPFL::ReturnCurrentVerts(UStaticMesh* Mesh)
 		if (VertexBuffer)
 		{
 			const int32 VertexCount = VertexBuffer->GetNumVertices();
+			ReturnArray.SetNumUninitialized(VertexCount);
 			for (int32 Index = 0; Index < VertexCount; Index++)
 			{
 				//This is in the Static Mesh Actor Class, so it is location and tranform of the SMActor
-				const FVector3f Vertex = VertexBuffer->VertexPosition(Index);
-				//add to output FVector array
-				ReturnArray.Add(Vertex);
+				ReturnArray[Index] = VertexBuffer->VertexPosition(Index);
 			}
 		}
 	}
@@ -218,8 +314,132 @@ void UBPFL::ExecuteConsoleCommand(FString ConsoleCommand) {
 		}
 	}
 }
+namespace BPFLTextureImport
+{
+	static TAutoConsoleVariable<int32> CVarSaveBatchSize(
+		TEXT("psk.ImportTextures.SaveBatchSize"),
+		64,
+		TEXT("How many imported textures ImportTextures saves at a time, 0 leaves them dirty and unsaved."));
+
+	struct FTextureSettings
+	{
+		TextureCompressionSettings CompressionSettings = TC_Default;
+		bool bSRGB = true;
+		bool bFromSuffix = false;
+	};
+
+	// The MRA/NM/DF naming rules, worked out before the texture exists so workers and the game thread agree on them
+	FTextureSettings ClassifyTexture(const FString& TextureName)
+	{
+		FTextureSettings Settings;
+		if (TextureName.EndsWith(TEXT("MRA")))
+		{
+			Settings.CompressionSettings = TC_Masks;
+			Settings.bSRGB = false;
+			Settings.bFromSuffix = true;
+		}
+		else if (TextureName.EndsWith(TEXT("NM")))
+		{
+			Settings.CompressionSettings = TC_Normalmap;
+			Settings.bSRGB = false;
+			Settings.bFromSuffix = true;
+		}
+		else if (TextureName.EndsWith(TEXT("DF")))
+		{
+			Settings.CompressionSettings = TC_Default;
+			Settings.bSRGB = true;
+			Settings.bFromSuffix = true;
+		}
+		return Settings;
+	}
+
+	// Part of every manifest record, bump it when the way textures are created changes
+	const TCHAR* ManifestVersion = TEXT("Texture 3");
+
+	struct FTextureImportJob
+	{
+		FString SourcePath;
+		FString TextureName;
+		FString PackagePath;
+		FString ObjectPath;
+		FTextureSettings Settings;
+		// Hash of the file the existing asset was imported from, invalid if there is no asset yet
+		FMD5Hash ImportedHash;
+		FPSKImportRecord Record;
+		// What the manifest recorded, when only the content can tell whether the file changed
+		TOptional<FPSKImportRecord> Recorded;
+
+		// Filled in on a worker
+		FMD5Hash Hash;
+		bool bUnchanged = false;
+	};
+
+	// Reads the hash from the asset registry tags, so checking a texture is unchanged doesn't load its package
+	FMD5Hash GetImportedHash(IAssetRegistry& AssetRegistry, const FString& ObjectPath)
+	{
+		const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FName(*ObjectPath));
+		FString ImportJson;
+		if (!Asset.IsValid() || !Asset.GetTagValue(UObject::SourceFileTagName(), ImportJson))
+		{
+			return FMD5Hash();
+		}
+		const auto ImportInfo = FAssetImportInfo::FromJson(ImportJson);
+		if (!ImportInfo.IsSet() || ImportInfo->SourceFiles.Num() == 0)
+		{
+			return FMD5Hash();
+		}
+		return ImportInfo->SourceFiles[0].FileHash;
+	}
+
+	// Hashes the file and decides whether it changed since it was imported. Touches no UObjects, safe to call from
+	// worker threads. The file is streamed through a small buffer, decoding is left to the texture factory.
+	void HashTexture(FTextureImportJob& Job)
+	{
+		Job.Hash = FMD5Hash::HashFile(*Job.SourcePath);
+		if (!Job.Hash.IsValid())
+		{
+			return;
+		}
+		Job.Record.Source.Hash = Job.Hash;
+		Job.Record.bHashed = true;
+
+		// Without a manifest record the asset's own import data is all there is to go on
+		Job.bUnchanged = Job.Recorded.IsSet()
+			? FPSKImportManifest::CheckContent(Job.Record, Job.Recorded.GetValue()) == EPSKImportDecision::Skip
+			: Job.ImportedHash.IsValid() && Job.ImportedHash == Job.Hash;
+	}
+
+	void ApplySettings(UTexture2D* Texture, const FTextureImportJob& Job)
+	{
+		if (Job.Settings.bFromSuffix)
+		{
+			Texture->SRGB = Job.Settings.bSRGB;
+			Texture->CompressionSettings = Job.Settings.CompressionSettings;
+		}
+	}
+
+	// Game thread only. New and changed textures alike go through the factory, which decodes the file and updates an
+	// existing asset in place.
+	UTexture2D* CreateTexture(UTextureFactory* TextureFactory, const FTextureImportJob& Job)
+	{
+		UPackage* TexPackage = CreatePackage(*Job.PackagePath);
+		auto bCancelled = false;
+		auto CreatedTexture = TextureFactory->FactoryCreateFile(UTexture2D::StaticClass(), TexPackage, FName(*Job.TextureName), RF_Public | RF_Standalone, Job.SourcePath, NULL, GWarn, bCancelled);
+		if (CreatedTexture == nullptr)
+		{
+			return nullptr;
+		}
+		auto Texture = CastChecked<UTexture2D>(CreatedTexture);
+		Texture->PreEditChange(nullptr);
+		ApplySettings(Texture, Job);
+		return Texture;
+	}
+}
+
 void UBPFL::ImportTextures(TArray<FString> AllTexturesPath)
 {
+	using namespace BPFLTextureImport;
+
 	auto AutomatedData = NewObject<UAutomatedAssetImportData>();
 	AutomatedData->bReplaceExisting = false;
 	auto TextureFactory = NewObject<UTextureFactory>();
@@ -227,113 +447,423 @@ void UBPFL::ImportTextures(TArray<FString> AllTexturesPath)
 	TextureFactory->AutomatedImportData = AutomatedData;
 	FScopedSlowTask ImportTask(AllTexturesPath.Num(), FText::FromString("Importing Textures"));
 	ImportTask.MakeDialog(true);
-	auto ActorIdx = -1;
-	for (auto tx : AllTexturesPath)
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	auto& Manifest = FPSKImportManifest::Get();
+
+	// Sized once up front, workers hold references into it. Textures whose file hasn't been touched since the
+	// manifest recorded it never get a job.
+	TArray<FTextureImportJob> Jobs;
+	Jobs.Reserve(AllTexturesPath.Num());
+	auto NumSkipped = 0;
+	for (auto i = 0; i < AllTexturesPath.Num(); i++)
 	{
-		ActorIdx++;
+		FTextureImportJob Job;
 		FString TexGamePath, TexName;
-		tx.Split(TEXT("\\"), &TexGamePath, &TexName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
-		FString PathForTextures = FString::Printf(TEXT("/Game/ValorantContent/Textures/%s"), *TexName.Replace(TEXT(".png"),TEXT("")));
-		auto TexPackage = CreatePackage(nullptr ,*PathForTextures);
-		auto bCancelled = false;
-		auto NewTxName = TexName.Replace(TEXT(".png"),TEXT(""));
-		auto CreatedTexture = TextureFactory->FactoryCreateFile(UTexture2D::StaticClass(), TexPackage, FName(*NewTxName), RF_Public | RF_Standalone, tx, NULL, GWarn, bCancelled); 
-		if (CreatedTexture == nullptr)
+		AllTexturesPath[i].Split(TEXT("\\"), &TexGamePath, &TexName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+		Job.SourcePath = AllTexturesPath[i];
+		Job.TextureName = TexName.Replace(TEXT(".png"), TEXT(""));
+		Job.PackagePath = FString::Printf(TEXT("/Game/ValorantContent/Textures/%s"), *Job.TextureName);
+		Job.ObjectPath = Job.PackagePath + TEXT(".") + Job.TextureName;
+		Job.Settings = ClassifyTexture(Job.TextureName);
+		Job.ImportedHash = GetImportedHash(AssetRegistry, Job.ObjectPath);
+
+		const auto Settings = FString::Printf(TEXT("%s %d %d"), ManifestVersion, static_cast<int32>(Job.Settings.CompressionSettings), Job.Settings.bSRGB);
+		Job.Record = FPSKImportRecord::Describe(Job.ObjectPath, Job.SourcePath, FString(), Settings);
+		const auto Decision = Manifest.Check(Job.ObjectPath, Job.Record, Job.ImportedHash.IsValid());
+		if (Decision == EPSKImportDecision::Skip)
 		{
+			NumSkipped++;
 			continue;
 		}
-		auto Tex = CastChecked<UTexture2D>(CreatedTexture);
-		/// tx 
-		auto CompressionSetting = Tex->CompressionSettings;
-		if (NewTxName.EndsWith("MRA") && CompressionSetting != TC_Masks)
+		if (Decision == EPSKImportDecision::Hash)
 		{
-			Tex->SRGB = false;
-			Tex->CompressionSettings = TC_Masks;
+			Job.Recorded = *Manifest.Find(Job.ObjectPath);
 		}
-		if (NewTxName.EndsWith("NM") && CompressionSetting != TC_Normalmap)
+
+		Jobs.Add(MoveTemp(Job));
+	}
+	ImportTask.EnterProgressFrame(NumSkipped);
+
+	// Workers read and hash the files to find the unchanged ones. The game thread takes finished jobs in whatever order
+	// they complete, imports the rest through the texture factory and saves the packages in batches.
+	const auto MaxInFlight = FMath::Max(GThreadPool->GetNumThreads(), 1) * 2;
+	const auto SaveBatchSize = CVarSaveBatchSize.GetValueOnGameThread();
+	TQueue<int32, EQueueMode::Mpsc> Finished;
+	FEvent* FinishedEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	std::atomic<bool> bCancelled(false);
+	TArray<TFuture<void>> Workers;
+	Workers.Reserve(Jobs.Num());
+	TArray<UPackage*> PackagesToSave;
+
+	auto NumInFlight = 0;
+	auto NextJob = 0;
+	auto NumDone = 0;
+	auto NumUnchanged = 0;
+	while (NumDone < Jobs.Num())
+	{
+		if (!bCancelled && ImportTask.ShouldCancel())
 		{
-			Tex->SRGB = false;
-			Tex->CompressionSettings = TC_Normalmap;
+			bCancelled = true;
 		}
-		if (NewTxName.EndsWith("DF") && CompressionSetting != TC_Normalmap)
+
+		// Enough hashes queued to keep the pool busy without crowding out the work the imports themselves start on it
+		while (!bCancelled && NextJob < Jobs.Num() && NumInFlight < MaxInFlight)
 		{
-			Tex->SRGB = true;
-			Tex->CompressionSettings = TC_Default;
+			const auto JobIndex = NextJob++;
+			FTextureImportJob& Job = Jobs[JobIndex];
+			NumInFlight++;
+
+			Workers.Add(Async(EAsyncExecution::ThreadPool, [&Job, JobIndex, &Finished, FinishedEvent, &bCancelled]()
+			{
+				if (!bCancelled)
+				{
+					HashTexture(Job);
+				}
+				Finished.Enqueue(JobIndex);
+				FinishedEvent->Trigger();
+			}));
+		}
+
+		if (bCancelled && NumInFlight == 0)
+		{
+			break;
+		}
+
+		int32 JobIndex;
+		if (!Finished.Dequeue(JobIndex))
+		{
+			// Keep the dialog responsive while the workers run
+			FinishedEvent->Wait(50);
+			ImportTask.EnterProgressFrame(0);
+			continue;
+		}
+
+		FTextureImportJob& Job = Jobs[JobIndex];
+		NumInFlight--;
+		NumDone++;
+
+		if (Job.bUnchanged)
+		{
+			NumUnchanged++;
+			Manifest.Record(Job.ObjectPath, Job.Record);
 		}
-		ImportTask.DefaultMessage = FText::FromString(FString::Printf(TEXT("Importing Texture : %d of %d: %s"), ActorIdx + 1, AllTexturesPath.Num() + 1, *NewTxName));
+		else if (!bCancelled)
+		{
+			auto Tex = CreateTexture(TextureFactory, Job);
+			if (Tex != nullptr)
+			{
+				Tex->MarkPackageDirty();
+				FAssetRegistryModule::AssetCreated(Tex);
+				Tex->PostEditChange();
+				PackagesToSave.Add(Tex->GetOutermost());
+
+				Job.Record.Source.Hash = Job.Hash.IsValid() ? Job.Hash : FMD5Hash::HashFile(*Job.SourcePath);
+				Manifest.Record(Job.ObjectPath, Job.Record);
+			}
+			else
+			{
+				Manifest.Forget(Job.ObjectPath);
+			}
+		}
+
+		if (SaveBatchSize > 0 && PackagesToSave.Num() >= SaveBatchSize)
+		{
+			UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+			PackagesToSave.Reset();
+		}
+
+		ImportTask.DefaultMessage = FText::FromString(FString::Printf(TEXT("Importing Texture : %d of %d: %s"), NumDone, Jobs.Num(), *Job.TextureName));
 		ImportTask.EnterProgressFrame();
-		Tex->MarkPackageDirty();
-		FAssetRegistryModule::AssetCreated(Tex);
-		Tex->PreEditChange(nullptr);
-		Tex->PostEditChange();
+	}
+
+	if (SaveBatchSize > 0 && PackagesToSave.Num() > 0)
+	{
+		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+	}
+
+	// The last worker may still be inside Trigger
+	for (auto& Worker : Workers)
+	{
+		Worker.Wait();
+	}
+	FPlatformProcess::ReturnSynchEventToPool(FinishedEvent);
+	Manifest.Save();
+
+	UE_LOG(LogTemp, Log, TEXT("ImportTextures: %d of %d textures unchanged since their last import, %d of them skipped without reading the file"),
+		NumSkipped + NumUnchanged, AllTexturesPath.Num(), NumSkipped);
+}
+
+namespace BPFLMeshImport
+{
+	static TAutoConsoleVariable<int32> CVarMemoryBudgetMB(
+		TEXT("psk.ImportMeshes.MemoryBudgetMB"),
+		1024,
+		TEXT("Upper bound on parsed mesh data ImportMeshes holds ahead of the game thread, in MB."));
+
+	// Parsed meshes are roughly this many times their file size once expanded into wedges
+	constexpr int64 ExpansionFactor = 4;
+
+	// Part of every manifest record, bump it when the way meshes are built changes
+	const TCHAR* ManifestVersion = TEXT("Mesh 1");
+
+	struct FMeshImportJob
+	{
+		FString SourcePath;
+		FString JsonPath;
+		FString MeshName;
+		FString ObjectPath;
+		int64 BudgetBytes = 0;
+		FPSKImportRecord Record;
+		// What the manifest had for the existing asset, only set if there is one
+		TOptional<FPSKImportRecord> Recorded;
+
+		// Filled in on a worker
+		FString CollisionTraceFlag = TEXT("CTF_UseDefault");
+		int LightMapResolution = 256;
+		int LightMapCoordinateIndex = 0;
+		float LightMapDensity = 0.0;
+		FPSKXMeshData MeshData;
+		bool bLoaded = false;
+		bool bUnchanged = false;
+	};
+
+	/** Member Key of Properties, or null if either is missing */
+	const nlohmann::json* FindProperty(const nlohmann::json& Export, const char* Key)
+	{
+		if (!Export.is_object())
+		{
+			return nullptr;
+		}
+		const auto Properties = Export.find("Properties");
+		if (Properties == Export.end() || !Properties->is_object())
+		{
+			return nullptr;
+		}
+		const auto Property = Properties->find(Key);
+		return Property != Properties->end() ? &*Property : nullptr;
+	}
+
+	/** Runs on a worker. A missing or malformed sidecar leaves the job's defaults in place, it never throws. */
+	void ReadMeshSettings(FMeshImportJob& Job)
+	{
+		FString UmapJson;
+		if (!FFileHelper::LoadFileToString(UmapJson, *Job.JsonPath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Could not read %s, importing with default settings"), *Job.JsonPath);
+			return;
+		}
+		const auto Umap = nlohmann::json::parse(TCHAR_TO_UTF8(*UmapJson), nullptr, false);
+		if (Umap.is_discarded() || !Umap.is_array() || Umap.size() < 3)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s is not a mesh export, importing with default settings"), *Job.JsonPath);
+			return;
+		}
+
+		const auto& BodySetup = Umap[0];
+		const auto& StaticMeshPP = Umap[2];
+		const auto CollisionTraceFlag = FindProperty(BodySetup, "CollisionTraceFlag");
+		if (CollisionTraceFlag && CollisionTraceFlag->is_string())
+		{
+			Job.CollisionTraceFlag = UTF8_TO_TCHAR(CollisionTraceFlag->get<std::string>().c_str());
+		}
+		const auto LightMapResolution = FindProperty(StaticMeshPP, "LightMapResolution");
+		if (LightMapResolution && LightMapResolution->is_number_integer())
+		{
+			Job.LightMapResolution = LightMapResolution->get<int>();
+		}
+		const auto LightMapCoordinateIndex = FindProperty(StaticMeshPP, "LightMapCoordinateIndex");
+		if (LightMapCoordinateIndex && LightMapCoordinateIndex->is_number_integer())
+		{
+			Job.LightMapCoordinateIndex = LightMapCoordinateIndex->get<int>();
+		}
+		const auto LightMapDensity = FindProperty(StaticMeshPP, "LightMapDensity");
+		if (LightMapDensity && LightMapDensity->is_number())
+		{
+			Job.LightMapDensity = LightMapDensity->get<float>();
+		}
 	}
 }
 
 void UBPFL::ImportMeshes(TArray<FString> AllMeshesPath, FString ObjectsPath)
 {
+	using namespace BPFLMeshImport;
+
 	auto AutomatedData = NewObject<UAutomatedAssetImportData>();
 	AutomatedData->bReplaceExisting = false;
 	auto PSKFactory = NewObject<UPSKXFactory>();
 	PSKFactory->AutomatedImportData = AutomatedData;
 	FScopedSlowTask ImportTask(AllMeshesPath.Num(), FText::FromString("Importing Meshes"));
-	ImportTask.MakeDialog(true); 
-	int ActorIdx = -1;
-	for (FString MPath : AllMeshesPath)
+	ImportTask.MakeDialog(true);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	auto& Manifest = FPSKImportManifest::Get();
+
+	// Sized once up front, workers hold references into it. Meshes whose pskx and json haven't been touched since the
+	// manifest recorded them never get a job.
+	TArray<FMeshImportJob> Jobs;
+	Jobs.Reserve(AllMeshesPath.Num());
+	auto NumSkipped = 0;
+	for (auto i = 0; i < AllMeshesPath.Num(); i++)
 	{
+		FMeshImportJob Job;
 		FString MeshGamePath, MeshName;
-		MPath.Split(TEXT("\\"), &MeshGamePath, &MeshName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
-		MeshName = MeshName.Replace(TEXT(".pskx"), TEXT(".json"));
-		FPaths Path;
-		ActorIdx++;
-		// JSON Stuff
-		FString UmapJson;
-		int LMRES = 256;
-		std::string BodySetupProps = "CTF_UseDefault";
-		int LMCoord = 0; 
-		float LMDens = 0.0;
-		FString Filename = Path.Combine(ObjectsPath, MeshName);
-		FFileHelper::LoadFileToString(UmapJson, *Filename);
-		auto Umap = nlohmann::json::parse(TCHAR_TO_UTF8(*UmapJson));
-		auto BodySetup = Umap[0];
-		auto StaticMeshPP = Umap[2];
-		if (!BodySetup["Properties"]["CollisionTraceFlag"].is_null())
+		AllMeshesPath[i].Split(TEXT("\\"), &MeshGamePath, &MeshName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+		Job.SourcePath = AllMeshesPath[i];
+		Job.JsonPath = FPaths::Combine(ObjectsPath, MeshName.Replace(TEXT(".pskx"), TEXT(".json")));
+		Job.MeshName = MeshName.Replace(TEXT(".pskx"), TEXT(""));
+		Job.ObjectPath = FString::Printf(TEXT("/Game/ValorantContent/Meshes/%s.%s"), *Job.MeshName, *Job.MeshName.Replace(TEXT("_LOD0"), TEXT("")));
+		Job.Record = FPSKImportRecord::Describe(Job.ObjectPath, Job.SourcePath, Job.JsonPath, ManifestVersion);
+
+		const auto Decision = Manifest.Check(Job.ObjectPath, Job.Record, AssetRegistry.GetAssetByObjectPath(FName(*Job.ObjectPath)).IsValid());
+		if (Decision == EPSKImportDecision::Skip)
 		{
-			BodySetupProps = BodySetup["Properties"]["CollisionTraceFlag"].get<std::string>();
+			NumSkipped++;
+			continue;
 		}
-		auto StaticProps = StaticMeshPP["Properties"];
-		if (!StaticProps["LightMapResolution"].is_null())
+		if (Decision == EPSKImportDecision::Hash)
 		{
-			LMRES = StaticProps["LightMapResolution"].get<int>();
+			Job.Recorded = *Manifest.Find(Job.ObjectPath);
 		}
-		if (!StaticProps["LightMapCoordinateIndex"].is_null())
+
+		Job.BudgetBytes = FMath::Max<int64>(Job.Record.Source.Size, 1) * ExpansionFactor;
+		Jobs.Add(MoveTemp(Job));
+	}
+	ImportTask.EnterProgressFrame(NumSkipped);
+
+	// Workers read the json sidecar, parse the pskx and assemble the raw mesh. The game thread only creates and
+	// builds the assets, taking finished jobs from the queue in whatever order they complete.
+	const int64 MemoryBudget = static_cast<int64>(FMath::Max(CVarMemoryBudgetMB.GetValueOnGameThread(), 1)) * 1024 * 1024;
+	TQueue<int32, EQueueMode::Mpsc> Finished;
+	FEvent* FinishedEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	std::atomic<bool> bCancelled(false);
+	TArray<TFuture<void>> Workers;
+	Workers.Reserve(Jobs.Num());
+
+	// One cache for the whole import, thousands of meshes share a few hundred materials
+	FPSKXMaterialCache Materials;
+	TArray<int32> Ready;
+	TArray<FString> MaterialNames;
+
+	int64 BytesInFlight = 0;
+	auto NumInFlight = 0;
+	auto NextJob = 0;
+	auto NumDone = 0;
+	auto NumUnchanged = 0;
+	while (NumDone < Jobs.Num())
+	{
+		if (!bCancelled && ImportTask.ShouldCancel())
 		{
-			LMCoord = StaticProps["LightMapCoordinateIndex"].get<int>();
+			bCancelled = true;
 		}
-		if (!StaticProps["LightMapDensity"].is_null())
+
+		// Stay under the budget, but always keep one job going so a single huge mesh cannot stall the import
+		while (!bCancelled && NextJob < Jobs.Num() && (NumInFlight == 0 || BytesInFlight + Jobs[NextJob].BudgetBytes <= MemoryBudget))
 		{
-			LMDens = StaticProps["LightMapDensity"].get<float>();
+			const auto JobIndex = NextJob++;
+			FMeshImportJob& Job = Jobs[JobIndex];
+			BytesInFlight += Job.BudgetBytes;
+			NumInFlight++;
+
+			Workers.Add(Async(EAsyncExecution::ThreadPool, [&Job, JobIndex, &Finished, FinishedEvent, &bCancelled]()
+			{
+				if (!bCancelled)
+				{
+					// Touched but maybe not changed, a re-export writes the same bytes with a new time
+					Job.Record.ComputeHashes(Job.SourcePath, Job.JsonPath);
+					Job.bUnchanged = Job.Recorded.IsSet() && FPSKImportManifest::CheckContent(Job.Record, Job.Recorded.GetValue()) == EPSKImportDecision::Skip;
+				}
+				if (!bCancelled && !Job.bUnchanged)
+				{
+					ReadMeshSettings(Job);
+					Job.bLoaded = UPSKXFactory::LoadMeshData(Job.SourcePath, Job.MeshData);
+				}
+				Finished.Enqueue(JobIndex);
+				FinishedEvent->Trigger();
+			}));
 		}
-		///// end json stuff
-		MeshName = MeshName.Replace(TEXT(".json"), TEXT(""));
-		FString PathForMeshes = FString::Printf(TEXT("/Game/ValorantContent/Meshes/%s"), *MeshName);
-		auto MeshPackage = CreatePackage(*PathForMeshes);
-		auto bCancelled = false;
-		auto CreatedMesh = PSKFactory->FactoryCreateFile(UStaticMesh::StaticClass(), MeshPackage, FName(*MeshName), RF_Public | RF_Standalone, MPath, NULL, GWarn, bCancelled);
-		if (CreatedMesh == nullptr)
+
+		if (bCancelled && NumInFlight == 0)
 		{
+			break;
+		}
+
+		Ready.Reset();
+		int32 JobIndex;
+		while (Finished.Dequeue(JobIndex))
+		{
+			Ready.Add(JobIndex);
+		}
+		if (Ready.Num() == 0)
+		{
+			// Keep the dialog responsive while the workers run
+			FinishedEvent->Wait(50);
+			ImportTask.EnterProgressFrame(0);
 			continue;
 		}
-		auto Msh = CastChecked<UStaticMesh>(CreatedMesh);
-		////////////
-		//Msh->Modify();
-		//Msh->SetLightMapResolution(LMRES);
-		//Msh->SetLightMapCoordinateIndex(LMCoord);
-		//Msh->SetLightmapUVDensity(LMDens);
-		Msh->GetBodySetup()->CollisionTraceFlag = GetTraceFlag(BodySetupProps.c_str());
-		ImportTask.DefaultMessage = FText::FromString(FString::Printf(TEXT("Importing Mesh : %d of %d: %s"), ActorIdx + 1, AllMeshesPath.Num() + 1, *MeshName));
-		ImportTask.EnterProgressFrame();
-		//Msh->Property
+
+		// Materials missing for any of the finished meshes are created together, once however many of them use one
+		if (!bCancelled)
+		{
+			MaterialNames.Reset();
+			for (const auto ReadyIndex : Ready)
+			{
+				MaterialNames.Append(Jobs[ReadyIndex].MeshData.MaterialNames);
+			}
+			Materials.Prepare(MaterialNames);
+		}
+
+		for (const auto ReadyIndex : Ready)
+		{
+			FMeshImportJob& Job = Jobs[ReadyIndex];
+			BytesInFlight -= Job.BudgetBytes;
+			NumInFlight--;
+			NumDone++;
+
+			if (Job.bUnchanged)
+			{
+				// Remember the new times so the next run skips it without hashing
+				NumUnchanged++;
+				Manifest.Record(Job.ObjectPath, Job.Record);
+			}
+			else if (!bCancelled && Job.bLoaded)
+			{
+				auto MeshPackage = CreatePackage(*FString::Printf(TEXT("/Game/ValorantContent/Meshes/%s"), *Job.MeshName));
+				const auto AssetName = FName(*Job.MeshName.Replace(TEXT("_LOD0"), TEXT("")));
+				auto Msh = PSKFactory->CreateMesh(Job.MeshData, MeshPackage, AssetName, RF_Public | RF_Standalone, Materials);
+				if (Msh != nullptr)
+				{
+					if (UBodySetup* BodySetup = Msh->GetBodySetup())
+					{
+						BodySetup->CollisionTraceFlag = GetTraceFlag(Job.CollisionTraceFlag);
+					}
+					Manifest.Record(Job.ObjectPath, Job.Record);
+				}
+				else
+				{
+					Manifest.Forget(Job.ObjectPath);
+				}
+			}
+
+			// Give the memory back as soon as the asset has its own copy
+			Job.MeshData = FPSKXMeshData();
+
+			ImportTask.DefaultMessage = FText::FromString(FString::Printf(TEXT("Importing Mesh : %d of %d: %s"), NumDone, Jobs.Num(), *Job.MeshName));
+			ImportTask.EnterProgressFrame();
+		}
 	}
+
+	// The last worker may still be inside Trigger
+	for (auto& Worker : Workers)
+	{
+		Worker.Wait();
+	}
+	FPlatformProcess::ReturnSynchEventToPool(FinishedEvent);
+	Manifest.Save();
+
+	UE_LOG(LogTemp, Log, TEXT("ImportMeshes: %d of %d meshes unchanged since their last import, %d of them skipped without reading the files"),
+		NumSkipped + NumUnchanged, AllMeshesPath.Num(), NumSkipped);
+	UE_LOG(LogTemp, Log, TEXT("ImportMeshes: created %d missing material instances"), Materials.GetNumCreated());
 }
 
 ECollisionTraceFlag UBPFL::GetTraceFlag(FString tflag)
@@ -9,63 +9,213 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Rendering/SkeletalMeshLODImporterData.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "ObjectTools.h"
 
-UObject* UPSAFactory::Import(const FString Filename, UObject* Parent, const FName Name, const EObjectFlags Flags) const
+namespace PSAImport
 {
-	auto Psa = PSAReader(Filename);
-	if (!Psa.Read()) return nullptr;
-	
-	auto AnimSequence = NewObject<UAnimSequence>(Parent, UAnimSequence::StaticClass(), Name, Flags);
-	
-	auto Skeleton = CastChecked<USkeleton>(UEditorAssetLibrary::LoadAsset("/Game/M_MED_Heartache_Skeleton.M_MED_Heartache_Skeleton"));
-	AnimSequence->SetSkeleton(Skeleton);
-	auto SkeletalMesh = CastChecked<USkeletalMesh>(UEditorAssetLibrary::LoadAsset("/Game/M_MED_Heartache_LOD0.M_MED_Heartache"));
-	AnimSequence->CreateAnimation(SkeletalMesh);
+	static TAutoConsoleVariable<bool> CVarReduceKeys(
+		TEXT("psk.ImportAnim.ReduceKeys"),
+		true,
+		TEXT("Collapse bone tracks that do not move within tolerance to a single key."));
 
-	auto MeshBones = Skeleton->GetReferenceSkeleton().GetRawRefBoneInfo();
+	static TAutoConsoleVariable<float> CVarPositionTolerance(
+		TEXT("psk.ImportAnim.PositionTolerance"),
+		0.001f,
+		TEXT("Largest translation, in world units, a bone may drift and still count as constant."));
 
-	auto& AnimController = AnimSequence->GetController();
+	static TAutoConsoleVariable<float> CVarRotationTolerance(
+		TEXT("psk.ImportAnim.RotationTolerance"),
+		0.0001f,
+		TEXT("Largest rotation, in radians, a bone may drift and still count as constant."));
 
-	auto Info = Psa.AnimInfo;
-	AnimController.SetFrameRate(FFrameRate(Info.AnimRate, 1));
-	AnimController.SetPlayLength(Info.NumRawFrames/Info.AnimRate);
-	
-	FScopedSlowTask ImportTask(Psa.Bones.Num(), FText::FromString("Importing Anim"));
-	ImportTask.MakeDialog(false);
-	for (auto BoneIndex = 0; BoneIndex < Psa.Bones.Num(); BoneIndex++)
+	static TAutoConsoleVariable<float> CVarScaleTolerance(
+		TEXT("psk.ImportAnim.ScaleTolerance"),
+		0.0001f,
+		TEXT("Largest scale change a bone may have and still count as constant."));
+
+	struct FBoneTrack
 	{
-		auto Bone = Psa.Bones[BoneIndex];
-		auto BoneName = FName(Bone.Name);
-		ImportTask.DefaultMessage = FText::FromString(FString::Printf(TEXT("Bone %s: %d/%d"), *BoneName.ToString(), BoneIndex+1, Psa.Bones.Num()));
-		ImportTask.EnterProgressFrame();
-		
 		TArray<FVector3f> PositionalKeys;
 		TArray<FQuat4f> RotationalKeys;
 		TArray<FVector3f> ScaleKeys;
-		for (auto Frame = 0; Frame < Info.NumRawFrames; Frame++)
+	};
+
+	struct FReduceSettings
+	{
+		bool bEnabled;
+		float PositionTolerance;
+		float RotationTolerance;
+		float ScaleTolerance;
+	};
+
+	// Raw tracks are sampled once per frame and SetBoneTrackKeys takes all three channels with the same key count,
+	// so interior keys can't be dropped. A track that never leaves its first key is stored as that one key instead.
+	void ReduceTrack(FBoneTrack& Track, const FReduceSettings& Settings)
+	{
+		if (!Settings.bEnabled || Track.PositionalKeys.Num() <= 1)
+			return;
+
+		const auto FirstPosition = Track.PositionalKeys[0];
+		const auto FirstRotation = Track.RotationalKeys[0];
+		const auto FirstScale = Track.ScaleKeys[0];
+		for (auto Key = 1; Key < Track.PositionalKeys.Num(); Key++)
 		{
-			auto KeyIndex = BoneIndex + Frame * Psa.Bones.Num();
-			auto AnimKey = Psa.AnimKeys[KeyIndex];
+			if (!Track.PositionalKeys[Key].Equals(FirstPosition, Settings.PositionTolerance)
+				|| Track.RotationalKeys[Key].AngularDistance(FirstRotation) > Settings.RotationTolerance
+				|| !Track.ScaleKeys[Key].Equals(FirstScale, Settings.ScaleTolerance))
+			{
+				return;
+			}
+		}
+
+		Track.PositionalKeys.SetNum(1);
+		Track.RotationalKeys.SetNum(1);
+		Track.ScaleKeys.SetNum(1);
+	}
 
-			PositionalKeys.Add(FVector3f(AnimKey.Position.X, -AnimKey.Position.Y, AnimKey.Position.Z));
-			RotationalKeys.Add(FQuat4f(AnimKey.Orientation.X, -AnimKey.Orientation.Y, AnimKey.Orientation.Z, AnimKey.Orientation.W).GetNormalized());
-			ScaleKeys.Add(Psa.bHasScaleKeys ? Psa.ScaleKeys[KeyIndex].ScaleVector : FVector3f::OneVector);
+	FString GetSequenceName(const VAnimInfoBinary& Sequence)
+	{
+		ANSICHAR Name[sizeof(Sequence.Name) + 1];
+		FMemory::Memcpy(Name, Sequence.Name, sizeof(Sequence.Name));
+		Name[sizeof(Sequence.Name)] = 0;
+		return ObjectTools::SanitizeObjectName(ANSI_TO_TCHAR(Name));
+	}
+
+	UAnimSequence* ImportSequence(const PSAReader& Psa, const int32 SequenceIndex, UObject* Parent, const FName Name, const EObjectFlags Flags, USkeleton* Skeleton, USkeletalMesh* SkeletalMesh)
+	{
+		const auto& Info = Psa.Sequences[SequenceIndex];
+		const auto Keys = Psa.GetSequenceKeys(SequenceIndex);
+		const auto NumBones = Psa.Bones.Num();
+		if (NumBones == 0 || Keys.Num() == 0 || Info.AnimRate <= 0.0f)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Skipping sequence %s, the file doesn't hold its keys"), *GetSequenceName(Info));
+			return nullptr;
 		}
 
-		AnimController.AddBoneTrack(BoneName);
-		AnimController.SetBoneTrackKeys(BoneName, PositionalKeys, RotationalKeys, ScaleKeys);
+		auto AnimSequence = NewObject<UAnimSequence>(Parent, UAnimSequence::StaticClass(), Name, Flags);
+		AnimSequence->SetSkeleton(Skeleton);
+		AnimSequence->CreateAnimation(SkeletalMesh);
+
+		auto& AnimController = AnimSequence->GetController();
+		AnimController.SetFrameRate(FFrameRate(Info.AnimRate, 1));
+		AnimController.SetPlayLength(Info.NumRawFrames/Info.AnimRate);
+
+		// Scale keys are laid out like the keys, a sequence without a full set keeps unit scale
+		const auto NumFrames = Info.NumRawFrames;
+		const auto ScaleKeys = Psa.GetSequenceScaleKeys(SequenceIndex);
+		const auto bHasScaleKeys = ScaleKeys.Num() == Keys.Num();
+
+		FScopedSlowTask ImportTask(3, FText::FromString(FString::Printf(TEXT("Importing Anim %s"), *Name.ToString())));
+		ImportTask.MakeDialog(false);
+
+		// Keys are stored frame by frame. Walk them once in file order into per bone buffers, flipping Y on the way,
+		// instead of striding through the whole key array once per bone.
+		ImportTask.EnterProgressFrame(1, FText::FromString(FString::Printf(TEXT("Transposing %d frames of %d bones"), NumFrames, NumBones)));
+		TArray<FBoneTrack> Tracks;
+		Tracks.SetNum(NumBones);
+		for (auto& Track : Tracks)
+		{
+			Track.PositionalKeys.SetNumUninitialized(NumFrames);
+			Track.RotationalKeys.SetNumUninitialized(NumFrames);
+			Track.ScaleKeys.SetNumUninitialized(NumFrames);
+		}
+
+		const auto* AnimKey = Keys.GetData();
+		const auto* ScaleKey = ScaleKeys.GetData();
+		for (auto Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (auto BoneIndex = 0; BoneIndex < NumBones; BoneIndex++, AnimKey++)
+			{
+				auto& Track = Tracks[BoneIndex];
+				Track.PositionalKeys[Frame] = FVector3f(AnimKey->Position.X, -AnimKey->Position.Y, AnimKey->Position.Z);
+				Track.RotationalKeys[Frame] = FQuat4f(AnimKey->Orientation.X, -AnimKey->Orientation.Y, AnimKey->Orientation.Z, AnimKey->Orientation.W);
+				Track.ScaleKeys[Frame] = bHasScaleKeys ? (ScaleKey++)->ScaleVector : FVector3f::OneVector;
+			}
+		}
+
+		ImportTask.EnterProgressFrame(1, FText::FromString(TEXT("Converting bone tracks")));
+		const FReduceSettings ReduceSettings = {
+			CVarReduceKeys.GetValueOnGameThread(),
+			CVarPositionTolerance.GetValueOnGameThread(),
+			CVarRotationTolerance.GetValueOnGameThread(),
+			CVarScaleTolerance.GetValueOnGameThread()
+		};
+		ParallelFor(NumBones, [&Tracks, &ReduceSettings](const int32 BoneIndex)
+		{
+			auto& Track = Tracks[BoneIndex];
+			for (auto& Rotation : Track.RotationalKeys)
+			{
+				Rotation.Normalize();
+			}
+			ReduceTrack(Track, ReduceSettings);
+		});
+
+		// The controller is not thread safe, tracks are handed over here in one bracket so the model notifies once
+		ImportTask.EnterProgressFrame(1, FText::FromString(TEXT("Adding bone tracks")));
+		{
+			IAnimationDataController::FScopedBracket Bracket(AnimController, FText::FromString("Importing Anim"));
+			for (auto BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+			{
+				const auto BoneName = FName(Psa.Bones[BoneIndex].Name);
+				auto& Track = Tracks[BoneIndex];
+				AnimController.AddBoneTrack(BoneName, false);
+				AnimController.SetBoneTrackKeys(BoneName, Track.PositionalKeys, Track.RotationalKeys, Track.ScaleKeys, false);
+			}
+		}
+		AnimController.RemoveBoneTracksMissingFromSkeleton(Skeleton);
+
+		AnimSequence->Modify(true);
+		AnimSequence->PostEditChange();
+		FAssetRegistryModule::AssetCreated(AnimSequence);
+		AnimSequence->MarkPackageDirty();
+		return AnimSequence;
 	}
-	AnimController.RemoveBoneTracksMissingFromSkeleton(Skeleton);
+}
+
+UObject* UPSAFactory::Import(const FString Filename, UObject* Parent, const FName Name, const EObjectFlags Flags) const
+{
+	auto Psa = PSAReader(Filename);
+	if (!Psa.Read()) return nullptr;
+	
+	auto Skeleton = CastChecked<USkeleton>(UEditorAssetLibrary::LoadAsset("/Game/M_MED_Heartache_Skeleton.M_MED_Heartache_Skeleton"));
+	auto SkeletalMesh = CastChecked<USkeletalMesh>(UEditorAssetLibrary::LoadAsset("/Game/M_MED_Heartache_LOD0.M_MED_Heartache"));
 
-	AnimSequence->Modify(true);
-	AnimSequence->PostEditChange();
-	FAssetRegistryModule::AssetCreated(AnimSequence);
-	AnimSequence->MarkPackageDirty();
+	// The first sequence that imports becomes the asset the factory was asked for, any others go next to it as
+	// <Name>_<Sequence>, all decoded from the one read of the file. Sequences whose names sanitize to one already used
+	// get an index, so none of them overwrites another.
+	UAnimSequence* FirstSequence = nullptr;
+	TSet<FString> UsedNames;
+	UsedNames.Add(Name.ToString());
+	for (auto SequenceIndex = 0; SequenceIndex < Psa.Sequences.Num(); SequenceIndex++)
+	{
+		auto SequenceParent = Parent;
+		auto SequenceName = Name;
+		if (FirstSequence != nullptr)
+		{
+			const auto BaseName = FString::Printf(TEXT("%s_%s"), *Name.ToString(), *PSAImport::GetSequenceName(Psa.Sequences[SequenceIndex]));
+			auto AssetName = BaseName;
+			for (auto Suffix = 2; UsedNames.Contains(AssetName); Suffix++)
+			{
+				AssetName = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+			}
+			UsedNames.Add(AssetName);
+			SequenceParent = CreatePackage(*FPaths::Combine(FPaths::GetPath(Parent->GetPathName()), AssetName));
+			SequenceName = FName(AssetName);
+		}
+
+		const auto AnimSequence = PSAImport::ImportSequence(Psa, SequenceIndex, SequenceParent, SequenceName, Flags, Skeleton, SkeletalMesh);
+		if (FirstSequence == nullptr)
+		{
+			FirstSequence = AnimSequence;
+		}
+	}
 
 	for (TObjectIterator<USkeletalMeshComponent> Iter; Iter; ++Iter)
 	{
 		FComponentReregisterContext ReregisterContext(*Iter);
 	}
 
-	return AnimSequence;
+	return FirstSequence;
 }
@@ -1,79 +1,166 @@
 ﻿#include "PSAReader.h"
 
-PSAReader::PSAReader(const FString Filename)
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+// On-disk record sizes. Anim keys are padded in memory (FQuat4f is 16 byte aligned) and unpacked field by field,
+// the rest are copied in one go.
+static_assert(sizeof(VAnimInfoBinary) == 168, "VAnimInfoBinary must match the on-disk layout");
+static_assert(sizeof(VAnimScaleKey) == 16, "VAnimScaleKey must match the on-disk layout");
+
+namespace PSAReaderUtils
+{
+	constexpr int32 AnimKeySize = 32;	// position, quat, time
+
+	template <typename T>
+	bool CopyChunk(const VChunkHeader& Chunk, const uint8* ChunkData, TArray<T>& Out)
+	{
+		if (Chunk.DataSize != sizeof(T))
+			return false;
+
+		Out.SetNumUninitialized(Chunk.DataCount);
+		FMemory::Memcpy(Out.GetData(), ChunkData, static_cast<SIZE_T>(Chunk.DataCount) * sizeof(T));
+		return true;
+	}
+
+	void ReadAnimKeys(const uint8* ChunkData, const int32 DataCount, TArray<VQuatAnimKey>& AnimKeys)
+	{
+		AnimKeys.SetNumUninitialized(DataCount);
+		VQuatAnimKey* Key = AnimKeys.GetData();
+		for (auto i = 0; i < DataCount; i++, Key++, ChunkData += AnimKeySize)
+		{
+			FMemory::Memcpy(&Key->Position, ChunkData, 3 * sizeof(float));
+			FMemory::Memcpy(&Key->Orientation, ChunkData + 12, 4 * sizeof(float));
+			FMemory::Memcpy(&Key->Time, ChunkData + 28, sizeof(float));
+		}
+	}
+}
+
+PSAReader::PSAReader(const FString InFilename)
+	: bHasScaleKeys(false)
+	, Filename(InFilename)
 {
-	Ar.open(ToCStr(Filename), std::ios::binary);
+	FMemory::Memzero(AnimInfo);
 }
 
 bool PSAReader::Read()
 {
+	// Map the file and parse straight out of the mapping, falling back to one bulk read where mapping is unsupported
+	const TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	const TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion(0, MappedFile->GetFileSize()) : nullptr);
+	if (MappedRegion)
+	{
+		return ReadChunks(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+	}
+
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+		return false;
+
+	return ReadChunks(Bytes.GetData(), Bytes.Num());
+}
+
+bool PSAReader::ReadChunks(const uint8* Data, const int64 Size)
+{
+	using namespace PSAReaderUtils;
+
+	if (Size < static_cast<int64>(sizeof(VChunkHeader)))
+		return false;
+
 	VChunkHeader Header;
-	Ar.read(reinterpret_cast<char*>(&Header), sizeof(VChunkHeader));
+	FMemory::Memcpy(&Header, Data, sizeof(VChunkHeader));
+	Header.ChunkID[19] = 0;
 
 	if (!CheckHeader(Header))
 		return false;
 
 	VChunkHeader Chunk;
-	while (!Ar.eof())
+	int64 Offset = sizeof(VChunkHeader);
+	while (Offset + static_cast<int64>(sizeof(VChunkHeader)) <= Size)
 	{
-		Ar.read(reinterpret_cast<char*>(&Chunk), sizeof(VChunkHeader));
+		FMemory::Memcpy(&Chunk, Data + Offset, sizeof(VChunkHeader));
+		Offset += sizeof(VChunkHeader);
+
+		// Validate once per chunk, everything below reads inside [ChunkData, ChunkData + ChunkBytes)
 		const auto DataCount = Chunk.DataCount;
+		if (Chunk.DataSize < 0 || DataCount < 0)
+			return false;
+
+		const int64 ChunkBytes = static_cast<int64>(Chunk.DataSize) * DataCount;
+		if (ChunkBytes > Size - Offset)
+			return false;
 
+		const uint8* ChunkData = Data + Offset;
+		Offset += ChunkBytes;
+
+		bool bValid = true;
 		if (CHUNK("ANIMINFO"))
 		{
-			Ar.read(reinterpret_cast<char*>(&AnimInfo), sizeof(VAnimInfoBinary));
+			bValid = CopyChunk(Chunk, ChunkData, Sequences);
 		}
 		else if (CHUNK("BONENAMES"))
 		{
-			Bones.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
+			bValid = Chunk.DataSize == PSKReaderUtils::BoneSize;
+			if (bValid)
 			{
-				Ar.read(reinterpret_cast<char*>(&Bones[i].Name), sizeof(Bones[i].Name));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].Flags), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].NumChildren), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].ParentIndex), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Orientation), sizeof(FQuat4f));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Position), sizeof(FVector3f));
-	            	
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Length), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.XSize), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.YSize), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.ZSize), sizeof(float));
+				PSKReaderUtils::ReadBones(ChunkData, DataCount, Bones);
 			}
 		}
 		else if (CHUNK("ANIMKEYS"))
 		{
-			AnimKeys.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
+			bValid = Chunk.DataSize == AnimKeySize;
+			if (bValid)
 			{
-				Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Position), sizeof(FVector3f));
-				Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Orientation), sizeof(FQuat4f));
-				Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Time), sizeof(float));
+				ReadAnimKeys(ChunkData, DataCount, AnimKeys);
 			}
 		}
 		else if (CHUNK("SCALEKEYS"))
 		{
-			ScaleKeys.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&ScaleKeys[i].ScaleVector), sizeof(FVector3f));
-				Ar.read(reinterpret_cast<char*>(&ScaleKeys[i].Time), sizeof(float));
-			}
-		}
-		else
-		{
-			Ar.ignore(Chunk.DataSize*DataCount); 
+			bValid = CopyChunk(Chunk, ChunkData, ScaleKeys);
 		}
-		
+
+		if (!bValid)
+			return false;
 	}
 
-	bHasScaleKeys = ScaleKeys.Num() > 0;
+	if (Sequences.Num() == 0)
+		return false;
 
+	AnimInfo = Sequences[0];
+	bHasScaleKeys = ScaleKeys.Num() > 0;
 	return true;
 }
 
+TArrayView<const VQuatAnimKey> PSAReader::GetSequenceKeys(const int32 SequenceIndex) const
+{
+	if (!Sequences.IsValidIndex(SequenceIndex))
+		return {};
+
+	const auto& Sequence = Sequences[SequenceIndex];
+	const int64 First = static_cast<int64>(Sequence.FirstRawFrame) * Bones.Num();
+	const int64 Num = static_cast<int64>(Sequence.NumRawFrames) * Bones.Num();
+	if (First < 0 || Num < 0 || First + Num > AnimKeys.Num())
+		return {};
+
+	return TArrayView<const VQuatAnimKey>(AnimKeys.GetData() + First, static_cast<int32>(Num));
+}
+
+TArrayView<const VAnimScaleKey> PSAReader::GetSequenceScaleKeys(const int32 SequenceIndex) const
+{
+	if (!Sequences.IsValidIndex(SequenceIndex))
+		return {};
+
+	const auto& Sequence = Sequences[SequenceIndex];
+	const int64 First = static_cast<int64>(Sequence.FirstRawFrame) * Bones.Num();
+	const int64 Num = static_cast<int64>(Sequence.NumRawFrames) * Bones.Num();
+	if (First < 0 || Num < 0 || First + Num > ScaleKeys.Num())
+		return {};
+
+	return TArrayView<const VAnimScaleKey>(ScaleKeys.GetData() + First, static_cast<int32>(Num));
+}
+
 bool PSAReader::CheckHeader(const VChunkHeader Header) const
 {
 	return std::strcmp(Header.ChunkID, HeaderBytes) == 0;
 }
-
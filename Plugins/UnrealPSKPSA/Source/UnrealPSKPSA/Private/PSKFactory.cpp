@@ -7,6 +7,7 @@
 #include "IMeshBuilderModule.h"
 #include "MeshDescription.h"
 #include "PSKReader.h"
+#include "PSKSkeletalImportBuilder.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "ImportUtils/SkeletalMeshImportUtils.h"
 #include "Materials/MaterialInstanceConstant.h"
@@ -19,100 +20,10 @@ UObject* UPSKFactory::Import(const FString Filename, UObject* Parent, const FNam
 	auto Psk = PSKReader(Filename);
 	if (!Psk.Read()) return nullptr;
 
-	TArray<FColor> PointVertexColors;
-	PointVertexColors.Init(FColor::White, Psk.VertexColors.Num());
-	if (Psk.bHasVertexColors)
-	{
-		for (auto i = 0; i < Psk.Wedges.Num(); i++)
-		{
-			auto FixedColor = Psk.VertexColors[i];
-			Swap(FixedColor.R, FixedColor.B);
-			PointVertexColors[Psk.Wedges[i].PointIndex] = FixedColor;
-		}
-	}
-	
 	FSkeletalMeshImportData SkeletalMeshImportData;
+	FPSKSkeletalImportBuilder::Build(Psk, SkeletalMeshImportData);
 
-	for (auto i = 0; i < Psk.Normals.Num(); i++)
-		Psk.Normals[i].Y = -Psk.Normals[i].Y;
-
-	for (auto Vertex : Psk.Vertices)
-	{
-		auto FixedVertex = Vertex;
-		FixedVertex.Y = -FixedVertex.Y;
-		SkeletalMeshImportData.Points.Add(FixedVertex);
-		SkeletalMeshImportData.PointToRawMap.Add(SkeletalMeshImportData.Points.Num()-1);
-	}
-	
-	auto WindingOrder = {2, 1, 0};
-	for (const auto PskFace : Psk.Faces)
-	{
-		SkeletalMeshImportData::FTriangle Face;
-		Face.MatIndex = PskFace.MatIndex;
-		Face.SmoothingGroups = 1;
-		Face.AuxMatIndex = 0;
-
-		for (auto VertexIndex : WindingOrder)
-		{
-			const auto WedgeIndex = PskFace.WedgeIndex[VertexIndex];
-			const auto PskWedge = Psk.Wedges[WedgeIndex];
-			
-			SkeletalMeshImportData::FVertex Wedge;
-			Wedge.MatIndex = PskWedge.MatIndex;
-			Wedge.VertexIndex = PskWedge.PointIndex;
-			Wedge.Color = Psk.bHasVertexColors ? PointVertexColors[PskWedge.PointIndex] : FColor::White;
-			Wedge.UVs[0] = FVector2f(PskWedge.U, PskWedge.V);
-			for (auto UVIdx = 0; UVIdx < Psk.ExtraUVs.Num(); UVIdx++)
-			{
-				auto UV =  Psk.ExtraUVs[UVIdx][Face.WedgeIndex[VertexIndex]];
-				Wedge.UVs[UVIdx+1] = UV;
-			}
-			
-			Face.WedgeIndex[VertexIndex] = SkeletalMeshImportData.Wedges.Add(Wedge);
-			Face.TangentZ[VertexIndex] = Psk.bHasVertexNormals ? Psk.Normals[PskWedge.PointIndex] : FVector3f::ZeroVector;
-			Face.TangentY[VertexIndex] = FVector3f::ZeroVector;
-			Face.TangentX[VertexIndex] = FVector3f::ZeroVector;
-
-			
-		}
-		Swap(Face.WedgeIndex[0], Face.WedgeIndex[2]);
-		Swap(Face.TangentZ[0], Face.TangentZ[2]);
-
-		SkeletalMeshImportData.Faces.Add(Face);
-	}
-
-	for (auto PskBone : Psk.Bones)
-	{
-		SkeletalMeshImportData::FBone Bone;
-		Bone.Name = PskBone.Name;
-		Bone.NumChildren = PskBone.NumChildren;
-		Bone.ParentIndex = PskBone.ParentIndex == -1 ? INDEX_NONE : PskBone.ParentIndex;
-		
-		auto PskBonePos = PskBone.BonePos;
-		FTransform3f PskTransform;
-		PskTransform.SetLocation(FVector3f(PskBonePos.Position.X, -PskBonePos.Position.Y, PskBonePos.Position.Z));
-		PskTransform.SetRotation(FQuat4f(PskBonePos.Orientation.X, -PskBonePos.Orientation.Y, PskBonePos.Orientation.Z, PskBonePos.Orientation.W).GetNormalized());
-
-		SkeletalMeshImportData::FJointPos BonePos;
-		BonePos.Transform = PskTransform;
-		BonePos.Length = PskBonePos.Length;
-		BonePos.XSize = PskBonePos.XSize;
-		BonePos.YSize = PskBonePos.YSize;
-		BonePos.ZSize = PskBonePos.ZSize;
-
-		Bone.BonePos = BonePos;
-		SkeletalMeshImportData.RefBonesBinary.Add(Bone);
-	}
-
-	for (auto PskInfluence : Psk.Influences)
-	{
-		SkeletalMeshImportData::FRawBoneInfluence Influence;
-		Influence.BoneIndex = PskInfluence.BoneIdx;
-		Influence.VertexIndex = PskInfluence.PointIdx;
-		Influence.Weight = PskInfluence.Weight;
-		SkeletalMeshImportData.Influences.Add(Influence);
-	}
-
+	SkeletalMeshImportData.Materials.Reserve(Psk.Materials.Num());
 	for (auto PskMaterial : Psk.Materials)
 	{
 		SkeletalMeshImportData::FMaterial Material;
@@ -124,13 +35,6 @@ UObject* UPSKFactory::Import(const FString Filename, UObject* Parent, const FNam
 	}
 	SkeletalMeshImportData.MaxMaterialIndex = SkeletalMeshImportData.Materials.Num()-1;
 
-	SkeletalMeshImportData.bDiffPose = false;
-	SkeletalMeshImportData.bHasNormals = Psk.bHasVertexNormals;
-	SkeletalMeshImportData.bHasTangents = false;
-	SkeletalMeshImportData.bHasVertexColors = true;
-	SkeletalMeshImportData.NumTexCoords = 1 + Psk.ExtraUVs.Num(); 
-	SkeletalMeshImportData.bUseT0AsRefPose = false;
-	
 	const auto Skeleton = FActorXUtils::LocalCreate<USkeleton>(USkeleton::StaticClass(), Parent,  Name.ToString().Append("_Skeleton"), Flags);
 
 	FReferenceSkeleton RefSkeleton;
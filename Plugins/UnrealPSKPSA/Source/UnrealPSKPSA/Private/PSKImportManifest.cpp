@@ -0,0 +1,245 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PSKImportManifest.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PSKImportManifest
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("psk.ImportManifest.Enable"),
+		true,
+		TEXT("Skip import steps whose source files, sidecars and settings are unchanged since they last ran."));
+
+	constexpr uint32 Magic = 0x504D4958;	// 'PMIX'
+	// Bump when a record's layout changes, older manifests are then dropped and everything re-imports once
+	constexpr int32 Version = 1;
+
+	TUniquePtr<FPSKImportManifest>& GetSessionManifest()
+	{
+		static TUniquePtr<FPSKImportManifest> Manifest;
+		return Manifest;
+	}
+
+	static FAutoConsoleCommand ClearCommand(
+		TEXT("psk.ImportManifest.Clear"),
+		TEXT("Forget every recorded import so the next ImportMeshes, ImportTextures and PaintSMVertices redo everything."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			auto& Manifest = FPSKImportManifest::Get();
+			Manifest.Empty();
+			Manifest.Save();
+		}));
+}
+
+FPSKImportFileStamp FPSKImportFileStamp::Stat(const FString& Path)
+{
+	FPSKImportFileStamp Stamp;
+	if (Path.IsEmpty())
+	{
+		return Stamp;
+	}
+	const auto StatData = IFileManager::Get().GetStatData(*Path);
+	if (StatData.bIsValid && !StatData.bIsDirectory)
+	{
+		Stamp.Size = StatData.FileSize;
+		Stamp.Timestamp = StatData.ModificationTime;
+	}
+	return Stamp;
+}
+
+void FPSKImportFileStamp::ComputeHash(const FString& Path)
+{
+	Hash = Size >= 0 ? FMD5Hash::HashFile(*Path) : FMD5Hash();
+}
+
+FArchive& operator<<(FArchive& Ar, FPSKImportFileStamp& Stamp)
+{
+	return Ar << Stamp.Size << Stamp.Timestamp << Stamp.Hash;
+}
+
+FPSKImportRecord FPSKImportRecord::Describe(const FString& InAssetPath, const FString& SourcePath, const FString& SidecarPath, const FString& InSettings)
+{
+	FPSKImportRecord Record;
+	Record.AssetPath = InAssetPath;
+	Record.Source = FPSKImportFileStamp::Stat(SourcePath);
+	Record.Sidecar = FPSKImportFileStamp::Stat(SidecarPath);
+	Record.Settings = InSettings;
+	return Record;
+}
+
+void FPSKImportRecord::ComputeHashes(const FString& SourcePath, const FString& SidecarPath)
+{
+	Source.ComputeHash(SourcePath);
+	Sidecar.ComputeHash(SidecarPath);
+	bHashed = true;
+}
+
+bool FPSKImportRecord::SameSettings(const FPSKImportRecord& Recorded) const
+{
+	return AssetPath == Recorded.AssetPath && Settings == Recorded.Settings && Dependency == Recorded.Dependency;
+}
+
+bool FPSKImportRecord::MatchesStats(const FPSKImportRecord& Recorded) const
+{
+	return Source.Size >= 0 && Recorded.Source.Hash.IsValid()
+		&& Source.SameStat(Recorded.Source) && Sidecar.SameStat(Recorded.Sidecar)
+		&& SameSettings(Recorded);
+}
+
+bool FPSKImportRecord::MatchesContent(const FPSKImportRecord& Recorded) const
+{
+	return Source.Size >= 0 && Source.Hash.IsValid()
+		&& Source.Hash == Recorded.Source.Hash && Sidecar.Hash == Recorded.Sidecar.Hash
+		&& SameSettings(Recorded);
+}
+
+FMD5Hash FPSKImportRecord::GetInputHash() const
+{
+	FMD5 MD5;
+	for (const auto& Hash : { Source.Hash, Sidecar.Hash, Dependency })
+	{
+		if (Hash.IsValid())
+		{
+			MD5.Update(Hash.GetBytes(), Hash.GetSize());
+		}
+	}
+	MD5.Update(reinterpret_cast<const uint8*>(*Settings), Settings.Len() * sizeof(TCHAR));
+
+	FMD5Hash InputHash;
+	InputHash.Set(MD5);
+	return InputHash;
+}
+
+FArchive& operator<<(FArchive& Ar, FPSKImportRecord& Record)
+{
+	return Ar << Record.AssetPath << Record.Source << Record.Sidecar << Record.Settings << Record.Dependency;
+}
+
+FPSKImportManifest::FPSKImportManifest(const FString& InFilename) : Filename(InFilename)
+{
+	Load();
+}
+
+FPSKImportManifest& FPSKImportManifest::Get()
+{
+	check(IsInGameThread());
+
+	auto& Manifest = PSKImportManifest::GetSessionManifest();
+	if (!Manifest.IsValid())
+	{
+		Manifest = MakeUnique<FPSKImportManifest>(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealPSKPSA"), TEXT("ImportManifest.bin")));
+	}
+	return *Manifest;
+}
+
+void FPSKImportManifest::SaveSession()
+{
+	if (const auto& Manifest = PSKImportManifest::GetSessionManifest())
+	{
+		Manifest->Save();
+	}
+}
+
+bool FPSKImportManifest::IsEnabled()
+{
+	return PSKImportManifest::CVarEnable.GetValueOnGameThread();
+}
+
+const FPSKImportRecord* FPSKImportManifest::Find(const FString& Key) const
+{
+	return Records.Find(Key);
+}
+
+EPSKImportDecision FPSKImportManifest::Check(const FString& Key, const FPSKImportRecord& Record, const bool bAssetExists) const
+{
+	const auto Recorded = IsEnabled() && bAssetExists ? Records.Find(Key) : nullptr;
+	if (!Recorded)
+	{
+		return EPSKImportDecision::Import;
+	}
+	if (Record.MatchesStats(*Recorded))
+	{
+		return EPSKImportDecision::Skip;
+	}
+	return Record.bHashed ? CheckContent(Record, *Recorded) : EPSKImportDecision::Hash;
+}
+
+EPSKImportDecision FPSKImportManifest::CheckContent(const FPSKImportRecord& Record, const FPSKImportRecord& Recorded)
+{
+	return Record.MatchesContent(Recorded) ? EPSKImportDecision::Skip : EPSKImportDecision::Import;
+}
+
+void FPSKImportManifest::Record(const FString& Key, const FPSKImportRecord& InRecord)
+{
+	Records.Add(Key, InRecord);
+	bDirty = true;
+}
+
+void FPSKImportManifest::Forget(const FString& Key)
+{
+	if (Records.Remove(Key) > 0)
+	{
+		bDirty = true;
+	}
+}
+
+void FPSKImportManifest::Empty()
+{
+	bDirty |= Records.Num() > 0;
+	Records.Empty();
+}
+
+bool FPSKImportManifest::Save()
+{
+	if (!bDirty)
+	{
+		return true;
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	auto Magic = PSKImportManifest::Magic;
+	auto Version = PSKImportManifest::Version;
+	Writer << Magic << Version << Records;
+
+	if (!FFileHelper::SaveArrayToFile(Data, *Filename))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write the import manifest %s"), *Filename);
+		return false;
+	}
+	bDirty = false;
+	return true;
+}
+
+void FPSKImportManifest::Load()
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != PSKImportManifest::Magic || Version != PSKImportManifest::Version)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Ignoring import manifest %s from another version, everything will be imported again"), *Filename);
+		return;
+	}
+
+	Reader << Records;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Import manifest %s is damaged, everything will be imported again"), *Filename);
+		Records.Empty();
+	}
+}
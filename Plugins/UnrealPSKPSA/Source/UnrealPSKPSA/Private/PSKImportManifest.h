@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+/** Size, modification time and content hash of one input file, Size is -1 if it doesn't exist */
+struct FPSKImportFileStamp
+{
+	int64 Size = -1;
+	FDateTime Timestamp;
+	FMD5Hash Hash;
+
+	/** Size and time only, cheap enough to do for every file of a map */
+	static FPSKImportFileStamp Stat(const FString& Path);
+
+	/** Reads the whole file, call from a worker when the stats don't match */
+	void ComputeHash(const FString& Path);
+
+	bool SameStat(const FPSKImportFileStamp& Other) const
+	{
+		return Size == Other.Size && Timestamp == Other.Timestamp;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FPSKImportFileStamp& Stamp);
+};
+
+/** What one import step read and what it produced */
+struct FPSKImportRecord
+{
+	FString AssetPath;
+	FPSKImportFileStamp Source;
+	/** The json sidecar next to the source, if the step reads one */
+	FPSKImportFileStamp Sidecar;
+	/** Anything besides the files that changes the result, cvars, naming rules, a format version */
+	FString Settings;
+	/** Input hash of the record this step's result depends on, or of data passed in by the caller */
+	FMD5Hash Dependency;
+	/** Set by ComputeHashes, or by a caller that filled the hashes in itself. Not saved, recorded records are hashed. */
+	bool bHashed = false;
+
+	/** Stats of Source and Sidecar, no hashing yet */
+	static FPSKImportRecord Describe(const FString& InAssetPath, const FString& SourcePath, const FString& SidecarPath, const FString& InSettings);
+
+	/** Hashes Source and Sidecar. Touches no UObjects, safe on worker threads. */
+	void ComputeHashes(const FString& SourcePath, const FString& SidecarPath);
+
+	/** Everything matches and neither file's size or time changed since Recorded was hashed */
+	bool MatchesStats(const FPSKImportRecord& Recorded) const;
+
+	/** Everything matches, comparing the files by content. Both sides must be hashed. */
+	bool MatchesContent(const FPSKImportRecord& Recorded) const;
+
+	/** One hash over every input, for steps that depend on this one */
+	FMD5Hash GetInputHash() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FPSKImportRecord& Record);
+
+private:
+	bool SameSettings(const FPSKImportRecord& Recorded) const;
+};
+
+/** What an import step does with one item, from FPSKImportManifest::Check */
+enum class EPSKImportDecision : uint8
+{
+	/** Nothing usable is recorded or the inputs changed */
+	Import,
+	/** The inputs are the ones the recorded run saw */
+	Skip,
+	/** The files were touched since the recorded run and only their content can tell. Hash the record and check again. */
+	Hash,
+};
+
+/**
+ * Remembers what every ImportMeshes, ImportTextures and PaintSMVertices step was last run on, keyed by the object it
+ * wrote, and persists it under Saved so re-importing a map only redoes the steps whose inputs changed.
+ *
+ * Inputs are compared by file size and time first and by content hash when those differ, so an untouched map is
+ * checked without reading a file and a re-export that writes identical bytes still counts as unchanged. Callers tell
+ * Check whether the asset exists, the manifest can't see assets deleted behind its back. Game thread only, jobs take
+ * a copy of their record to workers.
+ */
+class FPSKImportManifest
+{
+public:
+	explicit FPSKImportManifest(const FString& InFilename);
+
+	/** The editor session's manifest, loaded on first use and saved by the imports and on shutdown */
+	static FPSKImportManifest& Get();
+
+	/** Saves the session's manifest if it was ever loaded, for module shutdown */
+	static void SaveSession();
+
+	/** Whether the imports consult the manifest, psk.ImportManifest.Enable */
+	static bool IsEnabled();
+
+	const FPSKImportRecord* Find(const FString& Key) const;
+
+	/**
+	 * The decision every import step makes per item, for the inputs Record describes. Compares stats first and asks
+	 * for a Hash when only content can tell, a hashed Record always gets Skip or Import. bAssetExists is the caller's
+	 * to check. Always Import while psk.ImportManifest.Enable is off.
+	 */
+	EPSKImportDecision Check(const FString& Key, const FPSKImportRecord& Record, bool bAssetExists) const;
+
+	/** Check's content stage against a copy of the recorded record, for workers. Record must be hashed. */
+	static EPSKImportDecision CheckContent(const FPSKImportRecord& Record, const FPSKImportRecord& Recorded);
+
+	void Record(const FString& Key, const FPSKImportRecord& InRecord);
+
+	void Forget(const FString& Key);
+
+	void Empty();
+
+	int32 Num() const { return Records.Num(); }
+
+	/** Writes the manifest if anything changed since it was loaded or last saved */
+	bool Save();
+
+	const FString& GetFilename() const { return Filename; }
+
+private:
+	void Load();
+
+	FString Filename;
+
+	TMap<FString, FPSKImportRecord> Records;
+
+	bool bDirty = false;
+};
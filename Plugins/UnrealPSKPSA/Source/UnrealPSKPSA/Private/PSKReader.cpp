@@ -1,152 +1,310 @@
 #include "PSKReader.h"
 
 #include "ActorXUtils.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
 
+// On-disk record sizes. Chunks whose record size matches the in-memory struct are copied in one go.
+static_assert(sizeof(VChunkHeader) == 32, "VChunkHeader must match the on-disk layout");
+static_assert(sizeof(VVertex) == 16, "VVertex must match the on-disk layout");
+static_assert(sizeof(VMaterial) == 88, "VMaterial must match the on-disk layout");
+static_assert(sizeof(VRawBoneInfluence) == 12, "VRawBoneInfluence must match the on-disk layout");
+static_assert(sizeof(FVector3f) == 12 && sizeof(FVector2f) == 8 && sizeof(FColor) == 4, "Vector types must be tightly packed");
 
-PSKReader::PSKReader(const FString Filename)
+namespace PSKReaderUtils
 {
-	Ar.open(ToCStr(Filename), std::ios::binary);
+	constexpr int32 Face16Size = 12;	// 3 x uint16 wedge, mat, aux mat, uint32 smoothing
+	constexpr int32 Face32Size = 18;	// 3 x int32 wedge, mat, aux mat, uint32 smoothing
+
+	template <typename T>
+	bool CopyChunk(const VChunkHeader& Chunk, const uint8* ChunkData, TArray<T>& Out)
+	{
+		if (Chunk.DataSize != sizeof(T))
+			return false;
+
+		Out.SetNumUninitialized(Chunk.DataCount);
+		FMemory::Memcpy(Out.GetData(), ChunkData, static_cast<SIZE_T>(Chunk.DataCount) * sizeof(T));
+		return true;
+	}
+
+	// The first 8 bytes of a 16 bit face are three uint16 indices followed by the two material bytes. Widened to four
+	// uint32 lanes they land exactly on WedgeIndex[0..2] and on MatIndex, AuxMatIndex and the padding after them.
+	static_assert(offsetof(VTriangle, MatIndex) == 12 && offsetof(VTriangle, AuxMatIndex) == 13 && offsetof(VTriangle, SmoothingGroups) == 16,
+		"ReadFaces16 widens into the VTriangle layout");
+
+	void ReadFaces16(const uint8* ChunkData, const int32 DataCount, TArray<VTriangle>& Faces)
+	{
+		Faces.SetNumUninitialized(DataCount);
+		VTriangle* Face = Faces.GetData();
+		for (auto i = 0; i < DataCount; i++, Face++, ChunkData += Face16Size)
+		{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+			vst1q_u32(reinterpret_cast<uint32*>(Face), vmovl_u16(vld1_u16(reinterpret_cast<const uint16*>(ChunkData))));
+			FMemory::Memcpy(&Face->SmoothingGroups, ChunkData + 8, sizeof(unsigned));
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+			const __m128i Packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ChunkData));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Face), _mm_unpacklo_epi16(Packed, _mm_setzero_si128()));
+			FMemory::Memcpy(&Face->SmoothingGroups, ChunkData + 8, sizeof(unsigned));
+#else
+			uint16 Indices[3];
+			FMemory::Memcpy(Indices, ChunkData, sizeof(Indices));
+			Face->WedgeIndex[0] = Indices[0];
+			Face->WedgeIndex[1] = Indices[1];
+			Face->WedgeIndex[2] = Indices[2];
+			Face->MatIndex = static_cast<char>(ChunkData[6]);
+			Face->AuxMatIndex = static_cast<char>(ChunkData[7]);
+			FMemory::Memcpy(&Face->SmoothingGroups, ChunkData + 8, sizeof(unsigned));
+#endif
+		}
+	}
+
+	void ReadFaces32(const uint8* ChunkData, const int32 DataCount, TArray<VTriangle>& Faces)
+	{
+		Faces.SetNumUninitialized(DataCount);
+		VTriangle* Face = Faces.GetData();
+		for (auto i = 0; i < DataCount; i++, Face++, ChunkData += Face32Size)
+		{
+			FMemory::Memcpy(Face->WedgeIndex, ChunkData, sizeof(Face->WedgeIndex));
+			Face->MatIndex = static_cast<char>(ChunkData[12]);
+			Face->AuxMatIndex = static_cast<char>(ChunkData[13]);
+			FMemory::Memcpy(&Face->SmoothingGroups, ChunkData + 14, sizeof(unsigned));
+		}
+	}
+
+	void ReadBones(const uint8* ChunkData, const int32 DataCount, TArray<VNamedBoneBinary>& Bones)
+	{
+		Bones.SetNum(DataCount);
+		for (auto i = 0; i < DataCount; i++, ChunkData += BoneSize)
+		{
+			VNamedBoneBinary& Bone = Bones[i];
+			const uint8* Src = ChunkData;
+			FMemory::Memcpy(Bone.Name, Src, sizeof(Bone.Name)); Src += sizeof(Bone.Name);
+			FMemory::Memcpy(&Bone.Flags, Src, sizeof(int)); Src += sizeof(int);
+			FMemory::Memcpy(&Bone.NumChildren, Src, sizeof(int)); Src += sizeof(int);
+			FMemory::Memcpy(&Bone.ParentIndex, Src, sizeof(int)); Src += sizeof(int);
+			FMemory::Memcpy(&Bone.BonePos.Orientation, Src, 4 * sizeof(float)); Src += 4 * sizeof(float);
+			FMemory::Memcpy(&Bone.BonePos.Position, Src, 3 * sizeof(float)); Src += 3 * sizeof(float);
+			FMemory::Memcpy(&Bone.BonePos.Length, Src, sizeof(float)); Src += sizeof(float);
+			FMemory::Memcpy(&Bone.BonePos.XSize, Src, sizeof(float)); Src += sizeof(float);
+			FMemory::Memcpy(&Bone.BonePos.YSize, Src, sizeof(float)); Src += sizeof(float);
+			FMemory::Memcpy(&Bone.BonePos.ZSize, Src, sizeof(float));
+		}
+	}
+}
+
+PSKReader::PSKReader(const FString InFilename)
+	: bHasVertexNormals(false)
+	, bHasVertexColors(false)
+	, bHasExtraUVs(false)
+	, Filename(InFilename)
+{
+}
+
+PSKReader::~PSKReader()
+{
+	Close();
+}
+
+bool PSKReader::Open()
+{
+	if (bOpened)
+		return FileData != nullptr;
+	bOpened = true;
+
+	// Map the file and parse straight out of the mapping, falling back to one bulk read where mapping is unsupported
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (MappedFile)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	}
+	if (MappedRegion)
+	{
+		FileData = MappedRegion->GetMappedPtr();
+		FileSize = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		MappedFile.Reset();
+		if (!FFileHelper::LoadFileToArray(FileBytes, *Filename))
+			return false;
+		FileData = FileBytes.GetData();
+		FileSize = FileBytes.Num();
+	}
+
+	if (!IndexChunks())
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void PSKReader::Close()
+{
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	FileBytes.Empty();
+	FileData = nullptr;
+	FileSize = 0;
+	ChunkIndex.Empty();
+	bOpened = false;
 }
 
-bool PSKReader::Read()
+bool PSKReader::Read(const EPSKChunk Chunks)
 {
+	if (!Open())
+		return false;
+
+	const auto Wanted = Chunks & ~DecodedChunks;
+	if (Wanted == EPSKChunk::None)
+		return true;
+
+	for (const auto& Entry : ChunkIndex)
+	{
+		if (EnumHasAnyFlags(Wanted, Entry.Kind) && !DecodeChunk(Entry))
+			return false;
+	}
+	DecodedChunks |= Wanted;
+
+	bHasVertexNormals = Normals.Num() > 0;
+	bHasVertexColors = VertexColors.Num() > 0;
+	bHasExtraUVs = ExtraUVs.Num() > 0;
+	return true;
+}
+
+bool PSKReader::HasChunk(const EPSKChunk Chunk) const
+{
+	return ChunkIndex.ContainsByPredicate([Chunk](const FChunkEntry& Entry) { return EnumHasAnyFlags(Chunk, Entry.Kind); });
+}
+
+int32 PSKReader::GetChunkCount(const EPSKChunk Chunk) const
+{
+	auto Count = 0;
+	for (const auto& Entry : ChunkIndex)
+	{
+		if (EnumHasAnyFlags(Chunk, Entry.Kind))
+			Count += Entry.Header.DataCount;
+	}
+	return Count;
+}
+
+bool PSKReader::IndexChunks()
+{
+	if (FileSize < static_cast<int64>(sizeof(VChunkHeader)))
+		return false;
+
 	VChunkHeader Header;
-	Ar.read(reinterpret_cast<char*>(&Header), sizeof(VChunkHeader));
+	FMemory::Memcpy(&Header, FileData, sizeof(VChunkHeader));
+	Header.ChunkID[19] = 0;
 
 	if (!CheckHeader(Header))
 		return false;
 
+	// A mesh has a dozen chunks at most
+	ChunkIndex.Reset(16);
+
 	VChunkHeader Chunk;
-	while (!Ar.eof())
+	int64 Offset = sizeof(VChunkHeader);
+	while (Offset + static_cast<int64>(sizeof(VChunkHeader)) <= FileSize)
 	{
-		Ar.read(reinterpret_cast<char*>(&Chunk), sizeof(VChunkHeader));
-		const auto DataCount = Chunk.DataCount;
+		FMemory::Memcpy(&Chunk, FileData + Offset, sizeof(VChunkHeader));
+		Offset += sizeof(VChunkHeader);
+
+		// Validated once here, decoding reads inside [Offset, Offset + DataSize * DataCount)
+		if (Chunk.DataSize < 0 || Chunk.DataCount < 0)
+			return false;
+
+		const int64 ChunkBytes = static_cast<int64>(Chunk.DataSize) * Chunk.DataCount;
+		if (ChunkBytes > FileSize - Offset)
+			return false;
 
+		auto Kind = EPSKChunk::None;
 		if (CHUNK("PNTS0000"))
-		{
-			Vertices.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Vertices[i]), sizeof(FVector3f));
-			}
-		}
+			Kind = EPSKChunk::Points;
 		else if (CHUNK("VTXW0000"))
-		{
-			Wedges.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Wedges[i]), sizeof(VVertex));
-				if (DataCount <= 65536)
-				{
-					Wedges[i].PointIndex &= 0xFFFF;
-				}
-			}
-		}
-		else if (CHUNK("FACE0000"))
-		{
-			Faces.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				for (auto j = 0; j < 3; j++)
-				{
-					Ar.read(reinterpret_cast<char*>(&Faces[i].WedgeIndex[j]), sizeof(short));
-					Faces[i].WedgeIndex[j] &= 0xFFFF;
-				}
-	                
-				Ar.read(&Faces[i].MatIndex, sizeof(char));
-				Ar.read(&Faces[i].AuxMatIndex, sizeof(char));
-				Ar.read(reinterpret_cast<char*>(&Faces[i].SmoothingGroups), sizeof(unsigned));
-			}
-		}
-		else if (CHUNK("FACE3200"))
-		{
-			Faces.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Faces[i].WedgeIndex), sizeof Faces[i].WedgeIndex);
-				Ar.read(&Faces[i].MatIndex, sizeof(char));
-                Ar.read(&Faces[i].AuxMatIndex, sizeof(char));
-                Ar.read(reinterpret_cast<char*>(&Faces[i].SmoothingGroups), sizeof(unsigned));
-			}
-		}
+			Kind = EPSKChunk::Wedges;
+		else if (CHUNK("FACE0000") || CHUNK("FACE3200"))
+			Kind = EPSKChunk::Faces;
 		else if (CHUNK("MATT0000"))
-		{
-			Materials.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Materials[i]), sizeof(VMaterial));
-			}
-		}
+			Kind = EPSKChunk::Materials;
 		else if (CHUNK("VTXNORMS"))
-		{
-			Normals.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Normals[i]), sizeof(FVector3f));
-			}
-		}
+			Kind = EPSKChunk::Normals;
 		else if (CHUNK("VERTEXCOLOR"))
-		{
-			VertexColors.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&VertexColors[i]), sizeof(FColor));
-			}
-		}
+			Kind = EPSKChunk::VertexColors;
 		else if (CHUNK("EXTRAUVS"))
-		{
-			TArray<FVector2f> UVData;
-			UVData.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&UVData[i]), sizeof(FVector2f));
-			}
-
-			ExtraUVs.Add(UVData);
-		}
+			Kind = EPSKChunk::ExtraUVs;
 		else if (CHUNK("REFSKELT") || CHUNK("REFSKEL0"))
+			Kind = EPSKChunk::Bones;
+		else if (CHUNK("RAWWEIGHTS") || CHUNK("RAWW0000"))
+			Kind = EPSKChunk::Influences;
+
+		if (Kind != EPSKChunk::None)
 		{
-			Bones.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
-			{
-				Ar.read(reinterpret_cast<char*>(&Bones[i].Name), sizeof(Bones[i].Name));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].Flags), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].NumChildren), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].ParentIndex), sizeof(int));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Orientation), sizeof(FQuat4f));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Position), sizeof(FVector3f));
-	            	
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Length), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.XSize), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.YSize), sizeof(float));
-				Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.ZSize), sizeof(float));
-	            	
-			}
+			ChunkIndex.Add({ Kind, Chunk, Offset });
 		}
-		else if (CHUNK("RAWWEIGHTS") || CHUNK("RAWW0000"))
+		Offset += ChunkBytes;
+	}
+	return true;
+}
+
+bool PSKReader::DecodeChunk(const FChunkEntry& Entry)
+{
+	using namespace PSKReaderUtils;
+
+	const auto& Chunk = Entry.Header;
+	const auto DataCount = Chunk.DataCount;
+	const uint8* ChunkData = FileData + Entry.Offset;
+
+	switch (Entry.Kind)
+	{
+	case EPSKChunk::Points:
+		return CopyChunk(Chunk, ChunkData, Vertices);
+	case EPSKChunk::Wedges:
+		if (!CopyChunk(Chunk, ChunkData, Wedges))
+			return false;
+		if (DataCount <= 65536)
 		{
-			Influences.SetNum(DataCount);
-			for (auto i = 0; i < DataCount; i++)
+			// Small meshes store a 16 bit point index followed by padding
+			for (VVertex& Wedge : Wedges)
 			{
-				Ar.read(reinterpret_cast<char*>(&Influences[i]), sizeof(VRawBoneInfluence));
+				Wedge.PointIndex &= 0xFFFF;
 			}
 		}
-		else
+		return true;
+	case EPSKChunk::Faces:
+		if (CHUNK("FACE3200"))
 		{
-			Ar.ignore(Chunk.DataSize*DataCount); 
+			if (Chunk.DataSize != Face32Size)
+				return false;
+			ReadFaces32(ChunkData, DataCount, Faces);
+			return true;
 		}
+		if (Chunk.DataSize != Face16Size)
+			return false;
+		ReadFaces16(ChunkData, DataCount, Faces);
+		return true;
+	case EPSKChunk::Materials:
+		return CopyChunk(Chunk, ChunkData, Materials);
+	case EPSKChunk::Normals:
+		return CopyChunk(Chunk, ChunkData, Normals);
+	case EPSKChunk::VertexColors:
+		return CopyChunk(Chunk, ChunkData, VertexColors);
+	case EPSKChunk::ExtraUVs:
+		return CopyChunk(Chunk, ChunkData, ExtraUVs.AddDefaulted_GetRef());
+	case EPSKChunk::Bones:
+		if (Chunk.DataSize != BoneSize)
+			return false;
+		ReadBones(ChunkData, DataCount, Bones);
+		return true;
+	case EPSKChunk::Influences:
+		return CopyChunk(Chunk, ChunkData, Influences);
+	default:
+		return true;
 	}
-
-	bHasVertexNormals = Normals.Num() > 0;
-	bHasVertexColors = VertexColors.Num() > 0;
-	bHasExtraUVs = ExtraUVs.Num() > 0;
-	Ar.close();
-	return true;
 }
 
 bool PSKReader::CheckHeader(const VChunkHeader Header) const
 {
 	return std::strcmp(Header.ChunkID, HeaderBytes) == 0;
 }
-
-
@@ -0,0 +1,227 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PSKSkeletalImportBuilder.h"
+
+#include "PSKReader.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+namespace PSKSkeletalImportBuilder
+{
+	// Faces or points per ParallelFor task, small meshes stay on the calling thread
+	constexpr int32 ChunkSize = 4096;
+
+	int32 NumChunks(const int32 Num)
+	{
+		return FMath::DivideAndRoundUp(Num, ChunkSize);
+	}
+
+	EParallelForFlags Flags(const int32 Num)
+	{
+		return Num > ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	}
+
+	FORCEINLINE FVector3f MirrorY(const FVector3f& Vector)
+	{
+		return FVector3f(Vector.X, -Vector.Y, Vector.Z);
+	}
+}
+
+void FPSKSkeletalImportBuilder::Build(const PSKReader& Psk, FSkeletalMeshImportData& OutData)
+{
+	using namespace PSKSkeletalImportBuilder;
+
+	const auto NumPoints = Psk.Vertices.Num();
+	const auto NumFaces = Psk.Faces.Num();
+	const auto NumExtraUVs = FMath::Min(Psk.ExtraUVs.Num(), MAX_TEXCOORDS - 1);
+	const auto bHasNormals = Psk.bHasVertexNormals && Psk.Normals.Num() >= NumPoints;
+	const auto bHasVertexColors = Psk.bHasVertexColors && Psk.VertexColors.Num() >= Psk.Wedges.Num();
+
+	// Last wedge of a point wins, kept serial so the result doesn't depend on thread timing
+	TArray<FColor> PointVertexColors;
+	if (bHasVertexColors)
+	{
+		PointVertexColors.Init(FColor::White, NumPoints);
+		for (auto i = 0; i < Psk.Wedges.Num(); i++)
+		{
+			auto FixedColor = Psk.VertexColors[i];
+			Swap(FixedColor.R, FixedColor.B);
+			PointVertexColors[Psk.Wedges[i].PointIndex] = FixedColor;
+		}
+	}
+
+	OutData.Points.SetNumUninitialized(NumPoints);
+	OutData.PointToRawMap.SetNumUninitialized(NumPoints);
+	for (auto i = 0; i < NumPoints; i++)
+	{
+		OutData.Points[i] = MirrorY(Psk.Vertices[i]);
+		OutData.PointToRawMap[i] = i;
+	}
+
+	// Each psk face becomes three consecutive wedges in reverse order, which flips the winding back after the mirror
+	OutData.Wedges.SetNumUninitialized(NumFaces * 3);
+	OutData.Faces.SetNumUninitialized(NumFaces);
+	ParallelFor(NumChunks(NumFaces), [&](const int32 Chunk)
+	{
+		const auto End = FMath::Min((Chunk + 1) * ChunkSize, NumFaces);
+		for (auto FaceIndex = Chunk * ChunkSize; FaceIndex < End; FaceIndex++)
+		{
+			const auto& PskFace = Psk.Faces[FaceIndex];
+			auto& Face = OutData.Faces[FaceIndex];
+			Face.MatIndex = PskFace.MatIndex;
+			Face.AuxMatIndex = 0;
+			Face.SmoothingGroups = 1;
+
+			for (auto Corner = 0; Corner < 3; Corner++)
+			{
+				const auto PskCorner = 2 - Corner;
+				const auto PskWedgeIndex = PskFace.WedgeIndex[PskCorner];
+				const auto& PskWedge = Psk.Wedges[PskWedgeIndex];
+				const auto WedgeIndex = FaceIndex * 3 + Corner;
+
+				auto& Wedge = OutData.Wedges[WedgeIndex];
+				Wedge.VertexIndex = PskWedge.PointIndex;
+				Wedge.MatIndex = PskWedge.MatIndex;
+				Wedge.Reserved = 0;
+				Wedge.Color = bHasVertexColors ? PointVertexColors[PskWedge.PointIndex] : FColor::White;
+				Wedge.UVs[0] = FVector2f(PskWedge.U, PskWedge.V);
+				for (auto UVIdx = 0; UVIdx < NumExtraUVs; UVIdx++)
+				{
+					Wedge.UVs[UVIdx + 1] = Psk.ExtraUVs[UVIdx][PskWedgeIndex];
+				}
+				for (auto UVIdx = NumExtraUVs + 1; UVIdx < MAX_TEXCOORDS; UVIdx++)
+				{
+					Wedge.UVs[UVIdx] = FVector2f::ZeroVector;
+				}
+
+				Face.WedgeIndex[Corner] = WedgeIndex;
+				Face.TangentZ[Corner] = bHasNormals ? MirrorY(Psk.Normals[PskWedge.PointIndex]) : FVector3f::ZeroVector;
+				Face.TangentY[Corner] = FVector3f::ZeroVector;
+				Face.TangentX[Corner] = FVector3f::ZeroVector;
+			}
+		}
+	}, Flags(NumFaces));
+
+	OutData.RefBonesBinary.SetNum(Psk.Bones.Num());
+	for (auto i = 0; i < Psk.Bones.Num(); i++)
+	{
+		const auto& PskBone = Psk.Bones[i];
+		auto& Bone = OutData.RefBonesBinary[i];
+		Bone.Name = PskBone.Name;
+		Bone.NumChildren = PskBone.NumChildren;
+		Bone.ParentIndex = PskBone.ParentIndex == -1 ? INDEX_NONE : PskBone.ParentIndex;
+
+		const auto& PskBonePos = PskBone.BonePos;
+		Bone.BonePos.Transform.SetLocation(MirrorY(PskBonePos.Position));
+		Bone.BonePos.Transform.SetRotation(FQuat4f(PskBonePos.Orientation.X, -PskBonePos.Orientation.Y, PskBonePos.Orientation.Z, PskBonePos.Orientation.W).GetNormalized());
+		Bone.BonePos.Transform.SetScale3D(FVector3f::OneVector);
+		Bone.BonePos.Length = PskBonePos.Length;
+		Bone.BonePos.XSize = PskBonePos.XSize;
+		Bone.BonePos.YSize = PskBonePos.YSize;
+		Bone.BonePos.ZSize = PskBonePos.ZSize;
+	}
+
+	OutData.Influences.SetNumUninitialized(Psk.Influences.Num());
+	for (auto i = 0; i < Psk.Influences.Num(); i++)
+	{
+		const auto& PskInfluence = Psk.Influences[i];
+		auto& Influence = OutData.Influences[i];
+		Influence.Weight = PskInfluence.Weight;
+		Influence.VertexIndex = PskInfluence.PointIdx;
+		Influence.BoneIndex = PskInfluence.BoneIdx;
+	}
+	ProcessInfluences(OutData.Influences, NumPoints);
+
+	OutData.bDiffPose = false;
+	OutData.bHasNormals = bHasNormals;
+	OutData.bHasTangents = false;
+	OutData.bHasVertexColors = true;
+	OutData.NumTexCoords = 1 + NumExtraUVs;
+	OutData.bUseT0AsRefPose = false;
+}
+
+void FPSKSkeletalImportBuilder::ProcessInfluences(TArray<SkeletalMeshImportData::FRawBoneInfluence>& Influences, const int32 NumPoints)
+{
+	using namespace PSKSkeletalImportBuilder;
+	using FRawBoneInfluence = SkeletalMeshImportData::FRawBoneInfluence;
+
+	// Counting sort by vertex, the psk lists influences bone by bone
+	TArray<int32> Offsets;
+	Offsets.SetNumZeroed(NumPoints + 1);
+	for (const auto& Influence : Influences)
+	{
+		if (Influence.VertexIndex >= 0 && Influence.VertexIndex < NumPoints)
+		{
+			Offsets[Influence.VertexIndex + 1]++;
+		}
+	}
+	for (auto i = 0; i < NumPoints; i++)
+	{
+		Offsets[i + 1] += Offsets[i];
+	}
+
+	TArray<FRawBoneInfluence> Sorted;
+	Sorted.SetNumUninitialized(Offsets[NumPoints]);
+	{
+		TArray<int32> Cursors(Offsets.GetData(), NumPoints);
+		for (const auto& Influence : Influences)
+		{
+			if (Influence.VertexIndex >= 0 && Influence.VertexIndex < NumPoints)
+			{
+				Sorted[Cursors[Influence.VertexIndex]++] = Influence;
+			}
+		}
+	}
+
+	// Each vertex only has a handful, sorting and normalizing them is independent per vertex
+	TArray<int32> Kept;
+	Kept.SetNumUninitialized(NumPoints);
+	ParallelFor(NumChunks(NumPoints), [&](const int32 Chunk)
+	{
+		const auto End = FMath::Min((Chunk + 1) * ChunkSize, NumPoints);
+		for (auto Point = Chunk * ChunkSize; Point < End; Point++)
+		{
+			const auto Begin = Offsets[Point];
+			auto Num = Offsets[Point + 1] - Begin;
+			if (Num > 1)
+			{
+				// Bone index breaks ties so equal weights always come out in the same order
+				Algo::Sort(TArrayView<FRawBoneInfluence>(Sorted.GetData() + Begin, Num), [](const FRawBoneInfluence& A, const FRawBoneInfluence& B)
+				{
+					return A.Weight != B.Weight ? A.Weight > B.Weight : A.BoneIndex < B.BoneIndex;
+				});
+				Num = FMath::Min(Num, MAX_TOTAL_INFLUENCES);
+			}
+
+			auto TotalWeight = 0.0f;
+			for (auto i = 0; i < Num; i++)
+			{
+				TotalWeight += Sorted[Begin + i].Weight;
+			}
+			if (TotalWeight > SMALL_NUMBER)
+			{
+				const auto Scale = 1.0f / TotalWeight;
+				for (auto i = 0; i < Num; i++)
+				{
+					Sorted[Begin + i].Weight *= Scale;
+				}
+			}
+			Kept[Point] = Num;
+		}
+	}, Flags(NumPoints));
+
+	Influences.Reset(Sorted.Num() + NumPoints / 8);
+	for (auto Point = 0; Point < NumPoints; Point++)
+	{
+		if (Kept[Point] == 0)
+		{
+			FRawBoneInfluence& Influence = Influences.AddDefaulted_GetRef();
+			Influence.Weight = 1.0f;
+			Influence.VertexIndex = Point;
+			Influence.BoneIndex = 0;
+			continue;
+		}
+		Influences.Append(Sorted.GetData() + Offsets[Point], Kept[Point]);
+	}
+}
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Rendering/SkeletalMeshLODImporterData.h"
+
+class PSKReader;
+
+/**
+ * Fills FSkeletalMeshImportData from a parsed .psk, everything except the materials, which need UObjects.
+ *
+ * Every array is sized once from the chunk counts and filled by index, with the Y mirror and winding flip done on
+ * contiguous arrays and the faces split across worker threads. Influences are sorted by vertex, cut to the engine's
+ * per vertex limit and normalized before the mesh builder sees them. Touches no UObjects, safe on worker threads.
+ */
+class FPSKSkeletalImportBuilder
+{
+public:
+	static void Build(const PSKReader& Psk, FSkeletalMeshImportData& OutData);
+
+	/**
+	 * Sorts influences by vertex and then by descending weight, keeps at most MAX_TOTAL_INFLUENCES per vertex and
+	 * normalizes their weights. Points without any get the root bone, like the engine's own importers do.
+	 */
+	static void ProcessInfluences(TArray<SkeletalMeshImportData::FRawBoneInfluence>& Influences, int32 NumPoints);
+};
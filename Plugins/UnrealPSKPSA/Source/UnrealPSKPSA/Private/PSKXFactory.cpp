@@ -5,56 +5,77 @@
 #include "ActorXUtils.h"
 #include "PSKReader.h"
 #include "RawMesh.h"
+#include "PSKXMaterialCache.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "Materials/MaterialInstanceConstant.h"
-#include "Editor/UnrealEd/Classes/Factories/MaterialInstanceConstantFactoryNew.h"
-#include "EditorAssetLibrary.h"
-#include "AssetToolsModule.h"
-#include "IAssetTools.h"
 #include "Misc/FileHelper.h"
-#include "Materials/MaterialInstanceConstant.h"
 
 UObject* UPSKXFactory::Import(const FString Filename, UObject* Parent, const FName Name, const EObjectFlags Flags) const
 {
-	const auto Reader = new PSKReader(Filename);
-	if (!Reader->Read())
+	FPSKXMeshData Data;
+	if (!LoadMeshData(Filename, Data))
 	{
 		return nullptr;
 	}
-	auto bHasNormals = Reader->Normals.Num() > 0;
-	auto bHasVertexColors = Reader->VertexColors.Num() > 0;
+	FPSKXMaterialCache Materials;
+	return CreateMesh(Data, Parent, Name, Flags, Materials);
+}
+
+bool UPSKXFactory::LoadMeshData(const FString& Filename, FPSKXMeshData& OutData)
+{
+	auto Reader = PSKReader(Filename);
+	if (!Reader.Read(EPSKChunk::StaticMesh))
+	{
+		return false;
+	}
+	auto bHasNormals = Reader.Normals.Num() > 0;
+	auto bHasVertexColors = Reader.VertexColors.Num() > 0;
 
 	TArray<FColor> FaceVertexColors;
-	FaceVertexColors.Init(FColor::White, Reader->VertexColors.Num());
+	FaceVertexColors.Init(FColor::White, Reader.VertexColors.Num());
 	if (bHasVertexColors)
 	{
-		for (auto i = 0; i < Reader->Wedges.Num(); i++)
+		for (auto i = 0; i < Reader.Wedges.Num(); i++)
 		{
-			auto FixedColor = Reader->VertexColors[i];
+			auto FixedColor = Reader.VertexColors[i];
 			Swap(FixedColor.R, FixedColor.B);
-			FaceVertexColors[Reader->Wedges[i].PointIndex] = FixedColor;
+			FaceVertexColors[Reader.Wedges[i].PointIndex] = FixedColor;
 		}
 	}
-	auto RawMesh = FRawMesh();
-	for (auto Vertex : Reader->Vertices)
+
+	auto& RawMesh = OutData.RawMesh;
+	const auto NumWedges = Reader.Faces.Num() * 3;
+	RawMesh.VertexPositions.Reserve(Reader.Vertices.Num());
+	RawMesh.WedgeIndices.Reserve(NumWedges);
+	RawMesh.WedgeTangentX.Reserve(NumWedges);
+	RawMesh.WedgeTangentY.Reserve(NumWedges);
+	RawMesh.WedgeTangentZ.Reserve(NumWedges);
+	RawMesh.FaceMaterialIndices.Reserve(Reader.Faces.Num());
+	RawMesh.FaceSmoothingMasks.Reserve(Reader.Faces.Num());
+	for (auto UVIdx = 0; UVIdx <= Reader.ExtraUVs.Num() && UVIdx < MAX_MESH_TEXTURE_COORDS; UVIdx++)
+	{
+		RawMesh.WedgeTexCoords[UVIdx].Reserve(NumWedges);
+	}
+	if (bHasVertexColors) RawMesh.WedgeColors.Reserve(NumWedges);
+
+	for (auto Vertex : Reader.Vertices)
 	{
 		auto FixedVertex = Vertex;
 		FixedVertex.Y = -FixedVertex.Y; // mirror y axis cuz ue dumb dumb
 		RawMesh.VertexPositions.Add(FixedVertex);
 	}
 
-	for (const auto Face : Reader->Faces)
+	for (const auto& Face : Reader.Faces)
 	{
 		for (auto VtxIdx = 2; VtxIdx >= 0; VtxIdx--) // reverse face winding to account for -y vertex pos
 		{
-			const auto Wedge = Reader->Wedges[Face.WedgeIndex[VtxIdx]];
+			const auto& Wedge = Reader.Wedges[Face.WedgeIndex[VtxIdx]];
 
 			RawMesh.WedgeIndices.Add(Wedge.PointIndex);
 			RawMesh.WedgeTexCoords[0].Add(FVector2f(Wedge.U, Wedge.V));
 
-			for (auto UVIdx = 0; UVIdx < Reader->ExtraUVs.Num(); UVIdx++)
+			for (auto UVIdx = 0; UVIdx < Reader.ExtraUVs.Num(); UVIdx++)
 			{
-				auto UV = Reader->ExtraUVs[UVIdx][Face.WedgeIndex[VtxIdx]];
+				auto UV = Reader.ExtraUVs[UVIdx][Face.WedgeIndex[VtxIdx]];
 				RawMesh.WedgeTexCoords[UVIdx+1].Add(UV);
 			}
 
@@ -62,7 +83,7 @@ UObject* UPSKXFactory::Import(const FString Filename, UObject* Parent, const FNa
 
 			if (bHasNormals)
 			{
-				Normal = Reader->Normals[Wedge.PointIndex];
+				Normal = Reader.Normals[Wedge.PointIndex];
 				Normal.Y = -Normal.Y;
 			}
 
@@ -77,36 +98,26 @@ UObject* UPSKXFactory::Import(const FString Filename, UObject* Parent, const FNa
 		RawMesh.FaceSmoothingMasks.Add(1);
 	}
 
+	OutData.MaterialNames.Reserve(Reader.Materials.Num());
+	for (const auto& Material : Reader.Materials)
+	{
+		OutData.MaterialNames.Add(FString(Material.MaterialName));
+	}
+	OutData.bHasNormals = bHasNormals;
+	return true;
+}
+
+UStaticMesh* UPSKXFactory::CreateMesh(FPSKXMeshData& Data, UObject* Parent, const FName Name, const EObjectFlags Flags, FPSKXMaterialCache& Materials) const
+{
+	check(IsInGameThread());
+
 	const auto StaticMesh = CastChecked<UStaticMesh>(CreateOrOverwriteAsset(UStaticMesh::StaticClass(), Parent, Name, Flags));
-	for (auto i = 0; i < Reader->Materials.Num(); i++)
+	Materials.Prepare(Data.MaterialNames);
+	StaticMesh->GetStaticMaterials().Reserve(Data.MaterialNames.Num());
+	for (auto i = 0; i < Data.MaterialNames.Num(); i++)
 	{
-		auto Material = Reader->Materials[i];
-		auto MaterialName = FName(Material.MaterialName);
-		auto MaterialNamey = FString(Material.MaterialName);
-		FString NewPathMat = "/Game/ValorantContent/Materials/";
-		IAssetTools& AssetTools = FModuleManager::GetModuleChecked<FAssetToolsModule>("AssetTools").Get();
-		UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
-		auto singpath = FPaths::Combine(NewPathMat, MaterialNamey);
-		UObject* CheckAsset = UEditorAssetLibrary::LoadAsset(singpath);
-		if (CheckAsset == nullptr)
-		{
-			CheckAsset = AssetTools.CreateAsset(MaterialNamey, NewPathMat, UMaterialInstanceConstant::StaticClass(), Factory);
-			TArray< FStringFormatArg > args;
-			args.Add(FStringFormatArg(MaterialNamey));
-			FString PathMat = FString::Format(TEXT("/Game/ValorantContent/Materials/{0}.{0}"), args);
-			auto Asset = UEditorAssetLibrary::LoadAsset(PathMat);
-			UMaterialInstanceConstant* MaterialInstance = CastChecked<UMaterialInstanceConstant>(Asset);
-			MaterialInstance->MarkPackageDirty();
-			FStaticMaterial StaticMaterial;
-			StaticMaterial.MaterialInterface = MaterialInstance;
-			StaticMesh->GetStaticMaterials().Add(StaticMaterial);
-			StaticMesh->GetSectionInfoMap().Set(0, i, FMeshSectionInfo(i));
-			continue;
-		}
-		UMaterialInstanceConstant* MaterialInstance = CastChecked<UMaterialInstanceConstant>(CheckAsset);
-		MaterialInstance->MarkPackageDirty();
 		FStaticMaterial StaticMaterial;
-		StaticMaterial.MaterialInterface = MaterialInstance;
+		StaticMaterial.MaterialInterface = Materials.Resolve(Data.MaterialNames[i]);
 		StaticMesh->GetStaticMaterials().Add(StaticMaterial);
 		StaticMesh->GetSectionInfoMap().Set(0, i, FMeshSectionInfo(i));
 	}
@@ -116,8 +127,8 @@ UObject* UPSKXFactory::Import(const FString Filename, UObject* Parent, const FNa
 	SourceModel.BuildSettings.bRecomputeTangents = false;
 	SourceModel.BuildSettings.bGenerateLightmapUVs = false;
 	SourceModel.BuildSettings.bComputeWeightedNormals = false;
-	SourceModel.BuildSettings.bRecomputeNormals = !bHasNormals;
-	SourceModel.SaveRawMesh(RawMesh);
+	SourceModel.BuildSettings.bRecomputeNormals = !Data.bHasNormals;
+	SourceModel.SaveRawMesh(Data.RawMesh);
 
 	StaticMesh->Build();
 	StaticMesh->PostEditChange();
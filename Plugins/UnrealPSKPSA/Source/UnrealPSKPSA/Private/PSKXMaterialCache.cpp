@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PSKXMaterialCache.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Factories/MaterialInstanceConstantFactoryNew.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Misc/FeedbackContext.h"
+#include "Misc/PackageName.h"
+
+FPSKXMaterialCache::FPSKXMaterialCache(const FString& InMaterialsPath) : MaterialsPath(InMaterialsPath)
+{
+	check(IsInGameThread());
+
+	// Only the folder itself, the same assets a lookup by path would find
+	TArray<FAssetData> Assets;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.GetAssetsByPath(FName(*MaterialsPath), Assets, false);
+
+	Existing.Reserve(Assets.Num());
+	for (const auto& Asset : Assets)
+	{
+		Existing.Add(Asset.AssetName, Asset.ToSoftObjectPath());
+	}
+}
+
+void FPSKXMaterialCache::Prepare(const TArray<FString>& MaterialNames)
+{
+	check(IsInGameThread());
+
+	TArray<FName> Missing;
+	for (const auto& MaterialName : MaterialNames)
+	{
+		const FName Name(*MaterialName);
+		if (!Resolved.Contains(Name) && !Existing.Contains(Name))
+		{
+			Missing.AddUnique(Name);
+		}
+	}
+	if (Missing.Num() > 0)
+	{
+		Create(Missing);
+	}
+}
+
+UMaterialInterface* FPSKXMaterialCache::Resolve(const FString& MaterialName)
+{
+	check(IsInGameThread());
+
+	const FName Name(*MaterialName);
+	if (const auto Found = Resolved.Find(Name))
+	{
+		if (Found->IsValid())
+		{
+			return Found->Get();
+		}
+		// Deleted since, look it up again
+		Resolved.Remove(Name);
+	}
+
+	if (const auto ObjectPath = Existing.Find(Name))
+	{
+		const auto Material = Cast<UMaterialInterface>(ObjectPath->TryLoad());
+		Resolved.Add(Name, Material);
+		return Material;
+	}
+
+	Create({ Name });
+	const auto Created = Resolved.Find(Name);
+	return Created ? Created->Get() : nullptr;
+}
+
+void FPSKXMaterialCache::Create(const TArray<FName>& MaterialNames)
+{
+	// Straight through the factory, the asset tools' checks and dialogs would only cost time per asset. The registry
+	// may not have scanned the folder yet, so a package that exists on disk or in memory is loaded, never replaced.
+	const auto Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+	for (const auto& Name : MaterialNames)
+	{
+		const auto PackageName = FPaths::Combine(MaterialsPath, Name.ToString());
+		if (FPackageName::DoesPackageExist(PackageName) || FindPackage(nullptr, *PackageName) != nullptr)
+		{
+			const auto ObjectPath = PackageName + TEXT(".") + Name.ToString();
+			const auto Material = LoadObject<UMaterialInterface>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+			Existing.Add(Name, FSoftObjectPath(ObjectPath));
+			Resolved.Add(Name, Material);
+			continue;
+		}
+
+		const auto Package = CreatePackage(*PackageName);
+		const auto MaterialInstance = Cast<UMaterialInstanceConstant>(Factory->FactoryCreateNew(
+			UMaterialInstanceConstant::StaticClass(), Package, Name, RF_Public | RF_Standalone | RF_Transactional, nullptr, GWarn));
+		if (MaterialInstance == nullptr)
+		{
+			continue;
+		}
+
+		FAssetRegistryModule::AssetCreated(MaterialInstance);
+		MaterialInstance->MarkPackageDirty();
+		Existing.Add(Name, FSoftObjectPath(MaterialInstance));
+		Resolved.Add(Name, MaterialInstance);
+		NumCreated++;
+	}
+}
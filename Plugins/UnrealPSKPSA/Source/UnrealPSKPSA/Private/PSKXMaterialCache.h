@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UMaterialInterface;
+
+/**
+ * Resolves .pskx material slot names to the material instances in the materials folder, for a whole import session.
+ *
+ * The folder is indexed once from the asset registry instead of looking each slot up by path, a material is loaded at
+ * most once however many meshes use it, and the instances missing from the folder are created together in Prepare.
+ * Game thread only.
+ */
+class FPSKXMaterialCache
+{
+public:
+	explicit FPSKXMaterialCache(const FString& InMaterialsPath = TEXT("/Game/ValorantContent/Materials"));
+
+	/** Creates the instances that none of MaterialNames have yet, in one pass */
+	void Prepare(const TArray<FString>& MaterialNames);
+
+	/** The material for a slot, created if Prepare didn't see it. Null if the name is taken by something that isn't a material. */
+	UMaterialInterface* Resolve(const FString& MaterialName);
+
+	/** Number of instances this session created */
+	int32 GetNumCreated() const { return NumCreated; }
+
+private:
+	void Create(const TArray<FName>& MaterialNames);
+
+	FString MaterialsPath;
+
+	/** Object paths of the assets already in the folder, by asset name */
+	TMap<FName, FSoftObjectPath> Existing;
+
+	/** Loaded or created so far */
+	TMap<FName, TWeakObjectPtr<UMaterialInterface>> Resolved;
+
+	int32 NumCreated = 0;
+};
@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PSAReader.h"
+#include "PSKBenchmarkUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <fstream>
+
+namespace PSAReaderTests
+{
+	using namespace PSKBenchmarkUtils;
+
+	// An agent's animation library, long sequences of a full body rig in one file
+	constexpr int32 NumBones = 120;
+	constexpr int32 NumSequences = 12;
+	constexpr int32 FramesPerSequence = 600;
+	constexpr int32 Runs = 3;
+
+	float KeyValue(const int32 Frame, const int32 Bone, const int32 Channel)
+	{
+		return FMath::Sin(Frame * 0.05f + Bone * 0.3f + Channel);
+	}
+
+	TArray<uint8> MakeFile()
+	{
+		TArray<uint8> Out;
+		AddChunk(Out, "ANIMHEAD", 0, 0, nullptr);
+
+		// Bones are packed to 120 bytes on disk
+		TArray<uint8> Bones;
+		Bones.SetNumZeroed(NumBones * 120);
+		for (auto i = 0; i < NumBones; i++)
+		{
+			uint8* Bone = Bones.GetData() + i * 120;
+			FCStringAnsi::Strncpy(reinterpret_cast<char*>(Bone), TCHAR_TO_ANSI(*FString::Printf(TEXT("bone_%03d"), i)), 64);
+			const int32 Parent = i - 1;
+			FMemory::Memcpy(Bone + 72, &Parent, sizeof(Parent));
+		}
+		AddChunk(Out, "BONENAMES", 120, NumBones, Bones.GetData());
+
+		TArray<VAnimInfoBinary> Sequences;
+		for (auto i = 0; i < NumSequences; i++)
+		{
+			VAnimInfoBinary& Info = Sequences.AddZeroed_GetRef();
+			FCStringAnsi::Strncpy(Info.Name, TCHAR_TO_ANSI(*FString::Printf(TEXT("Ability_%d"), i)), sizeof(Info.Name));
+			Info.TotalBones = NumBones;
+			Info.AnimRate = 30.0f;
+			Info.TrackTime = FramesPerSequence;
+			Info.FirstRawFrame = i * FramesPerSequence;
+			Info.NumRawFrames = FramesPerSequence;
+		}
+		AddChunk(Out, "ANIMINFO", sizeof(VAnimInfoBinary), NumSequences, Sequences.GetData());
+
+		// Keys are packed to 32 bytes on disk
+		const auto NumKeys = NumSequences * FramesPerSequence * NumBones;
+		TArray<float> Keys;
+		TArray<VAnimScaleKey> ScaleKeys;
+		Keys.Reserve(NumKeys * 8);
+		ScaleKeys.Reserve(NumKeys);
+		for (auto Frame = 0; Frame < NumSequences * FramesPerSequence; Frame++)
+		{
+			for (auto Bone = 0; Bone < NumBones; Bone++)
+			{
+				const auto Rotation = FQuat4f(FRotator3f(KeyValue(Frame, Bone, 0) * 90.0f, KeyValue(Frame, Bone, 1) * 90.0f, 0.0f));
+				Keys.Append({ KeyValue(Frame, Bone, 2), KeyValue(Frame, Bone, 3), KeyValue(Frame, Bone, 4), Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, 1.0f });
+				ScaleKeys.Add({ FVector3f(1.0f + KeyValue(Frame, Bone, 5) * 0.1f), 1.0f });
+			}
+		}
+		AddChunk(Out, "ANIMKEYS", 32, NumKeys, Keys.GetData());
+		AddChunk(Out, "SCALEKEYS", sizeof(VAnimScaleKey), NumKeys, ScaleKeys.GetData());
+		return Out;
+	}
+
+	/** The reader PSAReader replaced, element by element through std::ifstream, first sequence only */
+	struct FReferenceReader
+	{
+		VAnimInfoBinary AnimInfo;
+		TArray<VNamedBoneBinary> Bones;
+		TArray<VQuatAnimKey> AnimKeys;
+		TArray<VAnimScaleKey> ScaleKeys;
+
+		bool Read(const FString& Filename)
+		{
+			std::ifstream Ar(ToCStr(Filename), std::ios::binary);
+			VChunkHeader Chunk;
+			Ar.read(reinterpret_cast<char*>(&Chunk), sizeof(VChunkHeader));
+			while (Ar.read(reinterpret_cast<char*>(&Chunk), sizeof(VChunkHeader)))
+			{
+				const auto DataCount = Chunk.DataCount;
+				if (CHUNK("ANIMINFO"))
+				{
+					Ar.read(reinterpret_cast<char*>(&AnimInfo), sizeof(VAnimInfoBinary));
+					Ar.ignore(static_cast<std::streamsize>(Chunk.DataSize) * (DataCount - 1));
+				}
+				else if (CHUNK("BONENAMES"))
+				{
+					Bones.SetNum(DataCount);
+					for (auto i = 0; i < DataCount; i++)
+					{
+						Ar.read(reinterpret_cast<char*>(&Bones[i].Name), sizeof(Bones[i].Name));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].Flags), sizeof(int));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].NumChildren), sizeof(int));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].ParentIndex), sizeof(int));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Orientation), sizeof(FQuat4f));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Position), sizeof(FVector3f));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.Length), sizeof(float));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.XSize), sizeof(float));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.YSize), sizeof(float));
+						Ar.read(reinterpret_cast<char*>(&Bones[i].BonePos.ZSize), sizeof(float));
+					}
+				}
+				else if (CHUNK("ANIMKEYS"))
+				{
+					AnimKeys.SetNum(DataCount);
+					for (auto i = 0; i < DataCount; i++)
+					{
+						Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Position), sizeof(FVector3f));
+						Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Orientation), sizeof(FQuat4f));
+						Ar.read(reinterpret_cast<char*>(&AnimKeys[i].Time), sizeof(float));
+					}
+				}
+				else if (CHUNK("SCALEKEYS"))
+				{
+					ScaleKeys.SetNum(DataCount);
+					for (auto i = 0; i < DataCount; i++)
+					{
+						Ar.read(reinterpret_cast<char*>(&ScaleKeys[i].ScaleVector), sizeof(FVector3f));
+						Ar.read(reinterpret_cast<char*>(&ScaleKeys[i].Time), sizeof(float));
+					}
+				}
+				else
+				{
+					Ar.ignore(static_cast<std::streamsize>(Chunk.DataSize) * DataCount);
+				}
+			}
+			return Bones.Num() > 0;
+		}
+	};
+}
+
+/**
+ * Time reading a long multi-sequence .psa against the std::ifstream reader it replaced, and check every sequence and
+ * its scale keys come out of the one read
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPSAReaderBenchmark, "UnrealPSKPSA.Benchmark.PSAReader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FPSAReaderBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PSAReaderTests;
+
+	const auto Root = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PSAReader"));
+	const auto File = FPaths::Combine(Root, TEXT("Agent_Abilities.psa"));
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	FFileHelper::SaveArrayToFile(MakeFile(), *File);
+
+	PSAReader Psa(File);
+	if (!TestTrue(TEXT("Read"), Psa.Read()))
+	{
+		return false;
+	}
+	FReferenceReader Reference;
+	TestTrue(TEXT("Reference read"), Reference.Read(File));
+
+	TestEqual(TEXT("Sequences"), Psa.Sequences.Num(), NumSequences);
+	TestEqual(TEXT("Bones"), Psa.Bones.Num(), Reference.Bones.Num());
+	TestEqual(TEXT("Keys"), Psa.AnimKeys.Num(), Reference.AnimKeys.Num());
+	TestTrue(TEXT("Scale keys"), Psa.bHasScaleKeys);
+	TestEqual(TEXT("First sequence"), FString(ANSI_TO_TCHAR(Psa.AnimInfo.Name)), FString(ANSI_TO_TCHAR(Reference.AnimInfo.Name)));
+	if (Psa.AnimKeys.Num() == Reference.AnimKeys.Num() && Psa.ScaleKeys.Num() == Reference.ScaleKeys.Num())
+	{
+		auto Mismatches = 0;
+		for (auto i = 0; i < Psa.AnimKeys.Num(); i++)
+		{
+			const auto& A = Psa.AnimKeys[i];
+			const auto& B = Reference.AnimKeys[i];
+			if (A.Position != B.Position || !A.Orientation.Equals(B.Orientation, 0.0f) || A.Time != B.Time || Psa.ScaleKeys[i].ScaleVector != Reference.ScaleKeys[i].ScaleVector)
+			{
+				Mismatches++;
+			}
+		}
+		TestEqual(TEXT("Keys differing from the reference"), Mismatches, 0);
+	}
+
+	for (auto Sequence = 0; Sequence < NumSequences; Sequence++)
+	{
+		const auto Keys = Psa.GetSequenceKeys(Sequence);
+		const auto ScaleKeys = Psa.GetSequenceScaleKeys(Sequence);
+		TestEqual(FString::Printf(TEXT("Sequence %d keys"), Sequence), Keys.Num(), FramesPerSequence * NumBones);
+		TestEqual(FString::Printf(TEXT("Sequence %d scale keys"), Sequence), ScaleKeys.Num(), FramesPerSequence * NumBones);
+		if (Keys.Num() > 0)
+		{
+			// First key of the sequence is frame FirstRawFrame of bone 0
+			const auto Frame = Sequence * FramesPerSequence;
+			TestEqual(FString::Printf(TEXT("Sequence %d starts at its own frame"), Sequence), Keys[0].Position.X, KeyValue(Frame, 0, 2));
+		}
+	}
+
+	const auto ReferenceSeconds = BestOf(Runs, [&File]
+	{
+		FReferenceReader Reader;
+		Reader.Read(File);
+	});
+	const auto ReaderSeconds = BestOf(Runs, [&File]
+	{
+		PSAReader Reader(File);
+		Reader.Read();
+	});
+
+	AddInfo(FString::Printf(TEXT("%d sequences of %d frames, %d bones, %lld bytes  std::ifstream %8.2f ms  PSAReader %7.2f ms  %.1fx"),
+		NumSequences, FramesPerSequence, NumBones, IFileManager::Get().FileSize(*File),
+		ReferenceSeconds * 1000.0, ReaderSeconds * 1000.0, Speedup(ReferenceSeconds, ReaderSeconds)));
+
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "PSKReader.h"
+
+/** What the reader and import benchmarks share, only included from their WITH_DEV_AUTOMATION_TESTS blocks */
+namespace PSKBenchmarkUtils
+{
+	/** Fastest of Runs calls to Function, in seconds */
+	template <typename FunctionType>
+	double BestOf(const int32 Runs, FunctionType&& Function)
+	{
+		auto Best = TNumericLimits<double>::Max();
+		for (auto Run = 0; Run < Runs; Run++)
+		{
+			const auto Start = FPlatformTime::Seconds();
+			Function();
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+		}
+		return Best;
+	}
+
+	/** How many times faster Seconds is than ReferenceSeconds */
+	inline double Speedup(const double ReferenceSeconds, const double Seconds)
+	{
+		return ReferenceSeconds / FMath::Max(Seconds, SMALL_NUMBER);
+	}
+
+	/** Appends a chunk header and its data the way the exporters write .psk and .psa files */
+	inline void AddChunk(TArray<uint8>& Out, const char* ChunkID, const int32 DataSize, const int32 DataCount, const void* Data)
+	{
+		VChunkHeader Header;
+		FMemory::Memzero(Header);
+		FCStringAnsi::Strncpy(Header.ChunkID, ChunkID, sizeof(Header.ChunkID));
+		Header.TypeFlag = 0x1E83B9;
+		Header.DataSize = DataSize;
+		Header.DataCount = DataCount;
+		Out.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+		if (Data != nullptr)
+		{
+			Out.Append(static_cast<const uint8*>(Data), DataSize * DataCount);
+		}
+	}
+}
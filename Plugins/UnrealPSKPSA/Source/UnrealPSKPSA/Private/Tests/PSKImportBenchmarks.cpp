@@ -0,0 +1,268 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PSKReader.h"
+#include "PSKSkeletalImportBuilder.h"
+#include "PSKBenchmarkUtils.h"
+#include "Algo/Count.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+namespace PSKImportTests
+{
+	using namespace PSKBenchmarkUtils;
+
+	constexpr int32 Runs = 5;
+
+	// Roughly a hero character, a grid of quads with seams so wedges outnumber points
+	constexpr int32 GridSize = 320;
+	constexpr int32 NumBones = 180;
+	constexpr int32 InfluencesPerPoint = 6;
+
+	/** A large skinned character built in memory, for when no real ones are given on the command line */
+	void MakeCharacter(PSKReader& Psk)
+	{
+		Psk.bHasVertexNormals = true;
+		Psk.bHasVertexColors = true;
+		Psk.bHasExtraUVs = true;
+
+		const auto Row = GridSize + 1;
+		for (auto y = 0; y <= GridSize; y++)
+		{
+			for (auto x = 0; x <= GridSize; x++)
+			{
+				Psk.Vertices.Add(FVector3f(x, y, FMath::Sin(x * 0.1f) * 10.0f));
+				Psk.Normals.Add(FVector3f(0, FMath::Sin(y * 0.05f), 1).GetSafeNormal());
+			}
+		}
+
+		Psk.ExtraUVs.SetNum(1);
+		for (auto y = 0; y < GridSize; y++)
+		{
+			for (auto x = 0; x < GridSize; x++)
+			{
+				const int32 Corners[4] = { y * Row + x, y * Row + x + 1, (y + 1) * Row + x + 1, (y + 1) * Row + x };
+				const auto FirstWedge = Psk.Wedges.Num();
+				for (const auto Point : Corners)
+				{
+					VVertex Wedge;
+					Wedge.PointIndex = Point;
+					Wedge.U = (Point % Row) / static_cast<float>(GridSize);
+					Wedge.V = (Point / Row) / static_cast<float>(GridSize);
+					Wedge.MatIndex = (x / 64) % 4;
+					Wedge.Reserved = 0;
+					Wedge.Pad = 0;
+					Psk.Wedges.Add(Wedge);
+					Psk.VertexColors.Add(FColor(x, y, 255 - x, 255));
+					Psk.ExtraUVs[0].Add(FVector2f(Wedge.V, Wedge.U));
+				}
+
+				for (const auto& Tri : { FIntVector(0, 1, 2), FIntVector(0, 2, 3) })
+				{
+					VTriangle Face;
+					Face.WedgeIndex[0] = FirstWedge + Tri.X;
+					Face.WedgeIndex[1] = FirstWedge + Tri.Y;
+					Face.WedgeIndex[2] = FirstWedge + Tri.Z;
+					Face.MatIndex = (x / 64) % 4;
+					Face.AuxMatIndex = 0;
+					Face.SmoothingGroups = 1;
+					Psk.Faces.Add(Face);
+				}
+			}
+		}
+
+		for (auto i = 0; i < NumBones; i++)
+		{
+			VNamedBoneBinary Bone;
+			FMemory::Memzero(Bone);
+			FCStringAnsi::Strncpy(Bone.Name, TCHAR_TO_ANSI(*FString::Printf(TEXT("bone_%03d"), i)), sizeof(Bone.Name));
+			Bone.NumChildren = i + 1 < NumBones ? 1 : 0;
+			Bone.ParentIndex = i == 0 ? -1 : i - 1;
+			Bone.BonePos.Orientation = FQuat4f::Identity;
+			Bone.BonePos.Position = FVector3f(0, i, 0);
+			Psk.Bones.Add(Bone);
+		}
+
+		// Listed bone by bone like an exporter writes them, a few points left unweighted
+		for (auto Slot = 0; Slot < InfluencesPerPoint; Slot++)
+		{
+			for (auto Point = 0; Point < Psk.Vertices.Num(); Point++)
+			{
+				if (Point % 97 == 0)
+					continue;
+
+				VRawBoneInfluence Influence;
+				Influence.PointIdx = Point;
+				Influence.BoneIdx = (Point / 7 + Slot * 13) % NumBones;
+				Influence.Weight = 1.0f / (Slot + 1);
+				Psk.Influences.Add(Influence);
+			}
+		}
+	}
+
+	/** The builder UPSKFactory::Import used before, element by element through Add */
+	void BuildReference(const PSKReader& Psk, FSkeletalMeshImportData& OutData)
+	{
+		TArray<FColor> PointVertexColors;
+		PointVertexColors.Init(FColor::White, Psk.Vertices.Num());
+		if (Psk.bHasVertexColors)
+		{
+			for (auto i = 0; i < Psk.Wedges.Num(); i++)
+			{
+				auto FixedColor = Psk.VertexColors[i];
+				Swap(FixedColor.R, FixedColor.B);
+				PointVertexColors[Psk.Wedges[i].PointIndex] = FixedColor;
+			}
+		}
+
+		for (auto Vertex : Psk.Vertices)
+		{
+			Vertex.Y = -Vertex.Y;
+			OutData.Points.Add(Vertex);
+			OutData.PointToRawMap.Add(OutData.Points.Num() - 1);
+		}
+
+		for (const auto PskFace : Psk.Faces)
+		{
+			SkeletalMeshImportData::FTriangle Face;
+			Face.MatIndex = PskFace.MatIndex;
+			Face.SmoothingGroups = 1;
+			Face.AuxMatIndex = 0;
+
+			for (auto VertexIndex : { 2, 1, 0 })
+			{
+				const auto PskWedge = Psk.Wedges[PskFace.WedgeIndex[VertexIndex]];
+
+				SkeletalMeshImportData::FVertex Wedge;
+				Wedge.MatIndex = PskWedge.MatIndex;
+				Wedge.VertexIndex = PskWedge.PointIndex;
+				Wedge.Color = Psk.bHasVertexColors ? PointVertexColors[PskWedge.PointIndex] : FColor::White;
+				Wedge.UVs[0] = FVector2f(PskWedge.U, PskWedge.V);
+				for (auto UVIdx = 0; UVIdx < Psk.ExtraUVs.Num(); UVIdx++)
+				{
+					Wedge.UVs[UVIdx + 1] = Psk.ExtraUVs[UVIdx][PskFace.WedgeIndex[VertexIndex]];
+				}
+
+				auto Normal = Psk.bHasVertexNormals ? Psk.Normals[PskWedge.PointIndex] : FVector3f::ZeroVector;
+				Normal.Y = -Normal.Y;
+				Face.WedgeIndex[VertexIndex] = OutData.Wedges.Add(Wedge);
+				Face.TangentZ[VertexIndex] = Normal;
+			}
+			Swap(Face.WedgeIndex[0], Face.WedgeIndex[2]);
+			Swap(Face.TangentZ[0], Face.TangentZ[2]);
+
+			OutData.Faces.Add(Face);
+		}
+
+		for (auto PskInfluence : Psk.Influences)
+		{
+			SkeletalMeshImportData::FRawBoneInfluence Influence;
+			Influence.BoneIndex = PskInfluence.BoneIdx;
+			Influence.VertexIndex = PskInfluence.PointIdx;
+			Influence.Weight = PskInfluence.Weight;
+			OutData.Influences.Add(Influence);
+		}
+	}
+
+	void Measure(FAutomationTestBase& Test, const FString& Label, const PSKReader& Psk)
+	{
+		const auto ReferenceSeconds = BestOf(Runs, [&Psk]
+		{
+			FSkeletalMeshImportData Data;
+			BuildReference(Psk, Data);
+		});
+		const auto BuilderSeconds = BestOf(Runs, [&Psk]
+		{
+			FSkeletalMeshImportData Data;
+			FPSKSkeletalImportBuilder::Build(Psk, Data);
+		});
+
+		FSkeletalMeshImportData Reference;
+		BuildReference(Psk, Reference);
+		FSkeletalMeshImportData Built;
+		FPSKSkeletalImportBuilder::Build(Psk, Built);
+
+		Test.TestEqual(Label + TEXT(": points"), Built.Points.Num(), Reference.Points.Num());
+		Test.TestEqual(Label + TEXT(": wedges"), Built.Wedges.Num(), Reference.Wedges.Num());
+		Test.TestEqual(Label + TEXT(": faces"), Built.Faces.Num(), Reference.Faces.Num());
+		if (Built.Faces.Num() == Reference.Faces.Num() && Built.Wedges.Num() == Reference.Wedges.Num())
+		{
+			auto Mismatches = 0;
+			for (auto i = 0; i < Built.Faces.Num(); i++)
+			{
+				for (auto Corner = 0; Corner < 3; Corner++)
+				{
+					const auto& A = Built.Wedges[Built.Faces[i].WedgeIndex[Corner]];
+					const auto& B = Reference.Wedges[Reference.Faces[i].WedgeIndex[Corner]];
+					if (A.VertexIndex != B.VertexIndex || A.UVs[0] != B.UVs[0] || A.UVs[1] != B.UVs[1] || A.Color != B.Color
+						|| !Built.Faces[i].TangentZ[Corner].Equals(Reference.Faces[i].TangentZ[Corner]))
+					{
+						Mismatches++;
+					}
+				}
+			}
+			Test.TestEqual(Label + TEXT(": corners differing from the reference"), Mismatches, 0);
+		}
+
+		// Every point ends up with weights summing to one, sorted heaviest first
+		TArray<float> Sums;
+		Sums.SetNumZeroed(Built.Points.Num());
+		auto Unsorted = 0;
+		for (auto i = 0; i < Built.Influences.Num(); i++)
+		{
+			const auto& Influence = Built.Influences[i];
+			Sums[Influence.VertexIndex] += Influence.Weight;
+			if (i > 0 && Built.Influences[i - 1].VertexIndex == Influence.VertexIndex && Built.Influences[i - 1].Weight < Influence.Weight)
+				Unsorted++;
+		}
+		const auto Unnormalized = Algo::CountIf(Sums, [](const float Sum) { return !FMath::IsNearlyEqual(Sum, 1.0f, KINDA_SMALL_NUMBER); });
+		Test.TestEqual(Label + TEXT(": points whose weights don't sum to one"), static_cast<int32>(Unnormalized), 0);
+		Test.TestEqual(Label + TEXT(": influences out of order"), Unsorted, 0);
+
+		Test.AddInfo(FString::Printf(TEXT("%s  %d points %d wedges %d faces %d influences  reference %7.2f ms  builder %7.2f ms  %.2fx"),
+			*Label, Psk.Vertices.Num(), Psk.Wedges.Num(), Psk.Faces.Num(), Psk.Influences.Num(),
+			ReferenceSeconds * 1000.0, BuilderSeconds * 1000.0, Speedup(ReferenceSeconds, BuilderSeconds)));
+	}
+}
+
+/**
+ * Time building the skeletal import data for a large character, the old Add loops against FPSKSkeletalImportBuilder.
+ * Pass -PSKBenchmarkDir=<folder> to also run over every .psk in that folder.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPSKSkeletalImportBuilderBenchmark, "UnrealPSKPSA.Benchmark.SkeletalImportBuilder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FPSKSkeletalImportBuilderBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PSKImportTests;
+
+	{
+		PSKReader Psk(TEXT(""));
+		MakeCharacter(Psk);
+		Measure(*this, TEXT("Synthetic"), Psk);
+	}
+
+	FString Folder;
+	if (FParse::Value(FCommandLine::Get(), TEXT("PSKBenchmarkDir="), Folder))
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFilesRecursive(Files, *Folder, TEXT("*.psk"), true, false);
+		for (const auto& File : Files)
+		{
+			PSKReader Psk(File);
+			if (!Psk.Read())
+			{
+				AddWarning(FString::Printf(TEXT("Couldn't read %s"), *File));
+				continue;
+			}
+			Measure(*this, FPaths::GetBaseFilename(File), Psk);
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,183 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PSKImportManifest.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace PSKImportManifestTests
+{
+	// A map's worth of exported files split into regions, as Uiana lays them out
+	constexpr int32 NumRegions = 8;
+	constexpr int32 MeshesPerRegion = 250;
+	constexpr int32 TexturesPerRegion = 60;
+	constexpr int32 MinMeshBytes = 8 * 1024;
+	constexpr int32 MaxMeshBytes = 48 * 1024;
+	constexpr int32 TextureBytes = 64 * 1024;
+
+	struct FItem
+	{
+		FString Key;
+		FString SourcePath;
+		FString SidecarPath;
+		const TCHAR* Settings;
+		int32 Region;
+	};
+
+	void WriteFile(FRandomStream& Random, const FString& Path, const int32 Size)
+	{
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(Size);
+		for (auto& Byte : Data)
+		{
+			Byte = static_cast<uint8>(Random.RandHelper(256));
+		}
+		FFileHelper::SaveArrayToFile(Data, *Path);
+	}
+
+	TArray<FItem> MakeMapTree(const FString& Root)
+	{
+		FRandomStream Random(0x5053);
+		TArray<FItem> Items;
+		for (auto Region = 0; Region < NumRegions; Region++)
+		{
+			const auto RegionDir = FPaths::Combine(Root, FString::Printf(TEXT("Region_%d"), Region));
+			for (auto i = 0; i < MeshesPerRegion; i++)
+			{
+				const auto Name = FString::Printf(TEXT("SM_R%d_%04d_LOD0"), Region, i);
+				FItem& Item = Items.AddDefaulted_GetRef();
+				Item.Key = FString::Printf(TEXT("/Game/ValorantContent/Meshes/%s.%s"), *Name, *Name.Replace(TEXT("_LOD0"), TEXT("")));
+				Item.SourcePath = FPaths::Combine(RegionDir, TEXT("Meshes"), Name + TEXT(".pskx"));
+				Item.SidecarPath = FPaths::Combine(RegionDir, TEXT("Objects"), Name + TEXT(".json"));
+				Item.Settings = TEXT("Mesh 1");
+				Item.Region = Region;
+				WriteFile(Random, Item.SourcePath, Random.RandRange(MinMeshBytes, MaxMeshBytes));
+				FFileHelper::SaveStringToFile(FString::Printf(TEXT("[{\"Properties\":{}},{},{\"Properties\":{\"LightMapResolution\":%d}}]"), 64 << (i % 4)), *Item.SidecarPath);
+			}
+			for (auto i = 0; i < TexturesPerRegion; i++)
+			{
+				const auto Name = FString::Printf(TEXT("T_R%d_%04d_DF"), Region, i);
+				FItem& Item = Items.AddDefaulted_GetRef();
+				Item.Key = FString::Printf(TEXT("/Game/ValorantContent/Textures/%s.%s"), *Name, *Name);
+				Item.SourcePath = FPaths::Combine(RegionDir, TEXT("Textures"), Name + TEXT(".png"));
+				Item.Settings = TEXT("Texture 1 0 1");
+				Item.Region = Region;
+				WriteFile(Random, Item.SourcePath, TextureBytes);
+			}
+		}
+		return Items;
+	}
+
+	FPSKImportRecord Describe(const FItem& Item)
+	{
+		return FPSKImportRecord::Describe(Item.Key, Item.SourcePath, Item.SidecarPath, Item.Settings);
+	}
+
+	/** The decision each re-import makes per item before it imports anything, returns how many would be imported */
+	int32 CountChanged(const FPSKImportManifest& Manifest, const TArray<FItem>& Items, int32& OutNumHashed)
+	{
+		auto NumChanged = 0;
+		OutNumHashed = 0;
+		for (const auto& Item : Items)
+		{
+			auto Record = Describe(Item);
+			auto Decision = Manifest.Check(Item.Key, Record, true);
+			if (Decision == EPSKImportDecision::Hash)
+			{
+				Record.ComputeHashes(Item.SourcePath, Item.SidecarPath);
+				OutNumHashed++;
+				Decision = Manifest.Check(Item.Key, Record, true);
+			}
+			if (Decision == EPSKImportDecision::Import)
+			{
+				NumChanged++;
+			}
+		}
+		return NumChanged;
+	}
+}
+
+/**
+ * Time a no-op re-import check over a synthetic map tree against hashing every file, then touch one region with new
+ * content and re-export another with the same bytes, and check only the first is picked up.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPSKImportManifestBenchmark, "UnrealPSKPSA.Benchmark.ImportManifest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FPSKImportManifestBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PSKImportManifestTests;
+
+	const auto Root = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PSKImportManifest"));
+	const auto ManifestFile = FPaths::Combine(Root, TEXT("ImportManifest.bin"));
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	const auto Items = MakeMapTree(Root);
+
+	// A fresh import, every file hashed and recorded
+	auto Start = FPlatformTime::Seconds();
+	{
+		FPSKImportManifest Manifest(ManifestFile);
+		for (const auto& Item : Items)
+		{
+			auto Record = Describe(Item);
+			Record.ComputeHashes(Item.SourcePath, Item.SidecarPath);
+			Manifest.Record(Item.Key, Record);
+		}
+		TestTrue(TEXT("Manifest saves"), Manifest.Save());
+	}
+	const auto HashAllSeconds = FPlatformTime::Seconds() - Start;
+
+	// The next editor session, nothing changed
+	Start = FPlatformTime::Seconds();
+	FPSKImportManifest Manifest(ManifestFile);
+	const auto LoadSeconds = FPlatformTime::Seconds() - Start;
+	TestEqual(TEXT("Records loaded"), Manifest.Num(), Items.Num());
+
+	int32 NumHashed;
+	Start = FPlatformTime::Seconds();
+	const auto NumChanged = CountChanged(Manifest, Items, NumHashed);
+	const auto NoOpSeconds = FPlatformTime::Seconds() - Start;
+	TestEqual(TEXT("No-op re-import: items to import"), NumChanged, 0);
+	TestEqual(TEXT("No-op re-import: files hashed"), NumHashed, 0);
+	TestTrue(TEXT("Deleted asset is imported again"), Manifest.Check(Items[0].Key, Describe(Items[0]), false) == EPSKImportDecision::Import);
+
+	// Region 0 edited, region 1 exported again with identical bytes, both with new times
+	FRandomStream Random(0x5054);
+	const auto Later = FDateTime::UtcNow() + FTimespan::FromHours(1);
+	auto NumEdited = 0;
+	auto NumTouched = 0;
+	for (const auto& Item : Items)
+	{
+		if (Item.Region == 0)
+		{
+			WriteFile(Random, Item.SourcePath, static_cast<int32>(IFileManager::Get().FileSize(*Item.SourcePath)));
+			IFileManager::Get().SetTimeStamp(*Item.SourcePath, Later);
+			NumEdited++;
+		}
+		else if (Item.Region == 1)
+		{
+			IFileManager::Get().SetTimeStamp(*Item.SourcePath, Later);
+			NumTouched++;
+		}
+	}
+
+	Start = FPlatformTime::Seconds();
+	const auto NumRegionChanged = CountChanged(Manifest, Items, NumHashed);
+	const auto RegionSeconds = FPlatformTime::Seconds() - Start;
+	TestEqual(TEXT("One region edited: items to import"), NumRegionChanged, NumEdited);
+	TestEqual(TEXT("One region edited: files hashed"), NumHashed, NumEdited + NumTouched);
+
+	AddInfo(FString::Printf(TEXT("%d items  hash everything %8.2f ms  load manifest %6.2f ms  no-op check %6.2f ms  one region edited, one re-exported %7.2f ms"),
+		Items.Num(), HashAllSeconds * 1000.0, LoadSeconds * 1000.0, NoOpSeconds * 1000.0, RegionSeconds * 1000.0));
+
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,296 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PSKReader.h"
+#include "PSKBenchmarkUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace PSKReaderTests
+{
+	using namespace PSKBenchmarkUtils;
+
+	// A region's worth of props, small enough to stay in the file cache so the numbers are decode cost
+	constexpr int32 NumFiles = 64;
+	constexpr int32 NumPoints = 20000;
+	constexpr int32 NumWedges = 80000;
+	constexpr int32 NumFaces = 40000;
+	constexpr int32 NumBones = 64;
+	constexpr int32 Runs = 3;
+
+	/** A .pskx with every chunk the reader knows plus one it doesn't, in the order exporters write them */
+	TArray<uint8> MakeFile(const int32 Seed)
+	{
+		TArray<uint8> Out;
+		AddChunk(Out, "ACTRHEAD", 0, 0, nullptr);
+
+		TArray<FVector3f> Points;
+		TArray<FVector3f> Normals;
+		for (auto i = 0; i < NumPoints; i++)
+		{
+			Points.Add(FVector3f(i % 100, i / 100, Seed));
+			Normals.Add(FVector3f::UpVector);
+		}
+		AddChunk(Out, "PNTS0000", sizeof(FVector3f), NumPoints, Points.GetData());
+
+		TArray<VVertex> Wedges;
+		TArray<FColor> Colors;
+		TArray<FVector2f> UVs;
+		for (auto i = 0; i < NumWedges; i++)
+		{
+			VVertex Wedge;
+			FMemory::Memzero(Wedge);
+			Wedge.PointIndex = i % NumPoints;
+			Wedge.U = i * 0.001f;
+			Wedge.V = Seed * 0.01f;
+			Wedges.Add(Wedge);
+			Colors.Add(FColor(i, Seed, 0, 255));
+			UVs.Add(FVector2f(Wedge.V, Wedge.U));
+		}
+		AddChunk(Out, "VTXW0000", sizeof(VVertex), NumWedges, Wedges.GetData());
+
+		// 32 bit faces are packed to 18 bytes on disk
+		TArray<uint8> Faces;
+		for (auto i = 0; i < NumFaces; i++)
+		{
+			const int32 Indices[3] = { (i * 2) % NumWedges, (i * 2 + 1) % NumWedges, (i * 2 + 2) % NumWedges };
+			const uint8 MatIndex[2] = { static_cast<uint8>(i % 3), 0 };
+			const uint32 SmoothingGroups = 1;
+			Faces.Append(reinterpret_cast<const uint8*>(Indices), sizeof(Indices));
+			Faces.Append(MatIndex, sizeof(MatIndex));
+			Faces.Append(reinterpret_cast<const uint8*>(&SmoothingGroups), sizeof(SmoothingGroups));
+		}
+		AddChunk(Out, "FACE3200", 18, NumFaces, Faces.GetData());
+
+		TArray<VMaterial> Materials;
+		for (auto i = 0; i < 3; i++)
+		{
+			VMaterial& Material = Materials.AddZeroed_GetRef();
+			FCStringAnsi::Strncpy(Material.MaterialName, TCHAR_TO_ANSI(*FString::Printf(TEXT("MI_Prop_%d"), i)), sizeof(Material.MaterialName));
+		}
+		AddChunk(Out, "MATT0000", sizeof(VMaterial), Materials.Num(), Materials.GetData());
+
+		const uint32 Unknown[4] = { 1, 2, 3, 4 };
+		AddChunk(Out, "MRPHINFO", sizeof(Unknown), 1, Unknown);
+
+		AddChunk(Out, "VTXNORMS", sizeof(FVector3f), NumPoints, Normals.GetData());
+		AddChunk(Out, "VERTEXCOLOR", sizeof(FColor), NumWedges, Colors.GetData());
+		AddChunk(Out, "EXTRAUVS0", sizeof(FVector2f), NumWedges, UVs.GetData());
+
+		// Bones are packed to 120 bytes on disk
+		TArray<uint8> Bones;
+		Bones.SetNumZeroed(NumBones * 120);
+		for (auto i = 0; i < NumBones; i++)
+		{
+			uint8* Bone = Bones.GetData() + i * 120;
+			FCStringAnsi::Strncpy(reinterpret_cast<char*>(Bone), TCHAR_TO_ANSI(*FString::Printf(TEXT("bone_%02d"), i)), 64);
+			const int32 Parent = i - 1;
+			FMemory::Memcpy(Bone + 72, &Parent, sizeof(Parent));
+			const float W = 1.0f;
+			FMemory::Memcpy(Bone + 88, &W, sizeof(W));
+		}
+		AddChunk(Out, "REFSKELT", 120, NumBones, Bones.GetData());
+
+		TArray<VRawBoneInfluence> Influences;
+		for (auto i = 0; i < NumPoints; i++)
+		{
+			Influences.Add({ 1.0f, i, i % NumBones });
+		}
+		AddChunk(Out, "RAWWEIGHTS", sizeof(VRawBoneInfluence), Influences.Num(), Influences.GetData());
+		return Out;
+	}
+
+	/** A .psk holding only 16 bit faces, packed to 12 bytes on disk, with indices above 32767 and both material bytes set */
+	TArray<uint8> MakeFaces16File(const int32 Count, TArray<uint8>& OutFaces)
+	{
+		OutFaces.Reset(Count * 12);
+		for (auto i = 0; i < Count; i++)
+		{
+			const uint16 Indices[3] = { static_cast<uint16>(i * 3), static_cast<uint16>(65535 - i), static_cast<uint16>(i * 7 + 32768) };
+			const uint8 MatIndex[2] = { static_cast<uint8>(i % 5), static_cast<uint8>(0x80 | (i % 3)) };
+			const uint32 SmoothingGroups = 1u << (i % 32);
+			OutFaces.Append(reinterpret_cast<const uint8*>(Indices), sizeof(Indices));
+			OutFaces.Append(MatIndex, sizeof(MatIndex));
+			OutFaces.Append(reinterpret_cast<const uint8*>(&SmoothingGroups), sizeof(SmoothingGroups));
+		}
+
+		TArray<uint8> Out;
+		AddChunk(Out, "ACTRHEAD", 0, 0, nullptr);
+		AddChunk(Out, "FACE0000", 12, Count, OutFaces.GetData());
+		return Out;
+	}
+
+	/** Field by field decode of 16 bit faces, the reference the reader's widening is checked and timed against */
+	void DecodeFaces16(const TArray<uint8>& Data, TArray<VTriangle>& Faces)
+	{
+		Faces.SetNumUninitialized(Data.Num() / 12);
+		const uint8* Src = Data.GetData();
+		for (auto& Face : Faces)
+		{
+			uint16 Indices[3];
+			FMemory::Memcpy(Indices, Src, sizeof(Indices));
+			Face.WedgeIndex[0] = Indices[0];
+			Face.WedgeIndex[1] = Indices[1];
+			Face.WedgeIndex[2] = Indices[2];
+			Face.MatIndex = static_cast<char>(Src[6]);
+			Face.AuxMatIndex = static_cast<char>(Src[7]);
+			FMemory::Memcpy(&Face.SmoothingGroups, Src + 8, sizeof(unsigned));
+			Src += 12;
+		}
+	}
+
+	/** Best of a few passes over every file, decoding the given chunks */
+	double TimePass(const TArray<FString>& Files, const EPSKChunk Chunks, const bool bIndexOnly, int32& OutFailures)
+	{
+		OutFailures = 0;
+		return BestOf(Runs, [&Files, Chunks, bIndexOnly, &OutFailures]
+		{
+			// Every run sees the same files, count one run's failures
+			OutFailures = 0;
+			for (const auto& File : Files)
+			{
+				PSKReader Reader(File);
+				if (!(bIndexOnly ? Reader.Open() : Reader.Read(Chunks)))
+				{
+					OutFailures++;
+				}
+			}
+		});
+	}
+}
+
+/**
+ * Time reading a batch of .pskx files the way each caller does, against decoding every chunk, and check a subset read
+ * decodes what was asked for and nothing else
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPSKReaderChunkBenchmark, "UnrealPSKPSA.Benchmark.PSKReaderChunks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FPSKReaderChunkBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace PSKReaderTests;
+
+	const auto Root = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PSKReaderChunks"));
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	TArray<FString> Files;
+	for (auto i = 0; i < NumFiles; i++)
+	{
+		const auto& File = Files.Add_GetRef(FPaths::Combine(Root, FString::Printf(TEXT("SM_Prop_%02d.pskx"), i)));
+		FFileHelper::SaveArrayToFile(MakeFile(i), *File);
+	}
+
+	// Correctness against a full read
+	{
+		PSKReader Full(Files[0]);
+		TestTrue(TEXT("Full read"), Full.Read());
+
+		PSKReader Subset(Files[0]);
+		TestTrue(TEXT("Open"), Subset.Open());
+		TestEqual(TEXT("Wedge count from the index"), Subset.GetChunkCount(EPSKChunk::Wedges), NumWedges);
+		TestTrue(TEXT("Index sees the bones"), Subset.HasChunk(EPSKChunk::Bones));
+		TestEqual(TEXT("Open decodes nothing"), Subset.Vertices.Num() + Subset.Wedges.Num() + Subset.Influences.Num(), 0);
+
+		TestTrue(TEXT("Positions only"), Subset.Read(EPSKChunk::Points));
+		TestTrue(TEXT("Positions match"), Subset.Vertices == Full.Vertices);
+		TestEqual(TEXT("Positions only leaves wedges"), Subset.Wedges.Num(), 0);
+		TestEqual(TEXT("Positions only leaves weights"), Subset.Influences.Num(), 0);
+
+		TestTrue(TEXT("Vertex colors later"), Subset.Read(EPSKChunk::VertexColors | EPSKChunk::Points));
+		TestTrue(TEXT("Colors match"), Subset.VertexColors == Full.VertexColors);
+		TestEqual(TEXT("Points aren't decoded twice"), Subset.Vertices.Num(), NumPoints);
+		TestTrue(TEXT("Colors flag"), Subset.bHasVertexColors);
+		TestFalse(TEXT("Normals flag"), Subset.bHasVertexNormals);
+
+		TestTrue(TEXT("Everything else"), Subset.Read());
+		TestEqual(TEXT("Faces"), Subset.Faces.Num(), Full.Faces.Num());
+		TestEqual(TEXT("Bones"), Subset.Bones.Num(), Full.Bones.Num());
+		TestEqual(TEXT("Extra UV channels"), Subset.ExtraUVs.Num(), 1);
+	}
+
+	struct FPattern
+	{
+		const TCHAR* Name;
+		EPSKChunk Chunks;
+		bool bIndexOnly;
+	};
+	const FPattern Patterns[] = {
+		{ TEXT("Skeletal import, every chunk"), EPSKChunk::All, false },
+		{ TEXT("Static mesh import"), EPSKChunk::StaticMesh, false },
+		{ TEXT("Vertex painting, positions"), EPSKChunk::Points, false },
+		{ TEXT("Mesh fix, vertex colors"), EPSKChunk::VertexColors, false },
+		{ TEXT("Chunk counts, index only"), EPSKChunk::None, true },
+	};
+
+	int32 Failures;
+	const auto FullSeconds = TimePass(Files, EPSKChunk::All, false, Failures);
+	for (const auto& Pattern : Patterns)
+	{
+		const auto Seconds = TimePass(Files, Pattern.Chunks, Pattern.bIndexOnly, Failures);
+		TestEqual(FString::Printf(TEXT("%s: files that failed"), Pattern.Name), Failures, 0);
+		AddInfo(FString::Printf(TEXT("%-32s %d files  %7.2f ms  %7.1f us per file  %5.1fx faster than a full read"),
+			Pattern.Name, Files.Num(), Seconds * 1000.0, Seconds * 1000000.0 / Files.Num(), Speedup(FullSeconds, Seconds)));
+	}
+
+	IFileManager::Get().DeleteDirectory(*Root, false, true);
+	return true;
+}
+
+/** Check the 16 bit face decode widens indices without sign extension and keeps the material bytes, and time it */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPSKReaderFaces16Benchmark, "UnrealPSKPSA.Benchmark.PSKReaderFaces16", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FPSKReaderFaces16Benchmark::RunTest(const FString& Parameters)
+{
+	using namespace PSKReaderTests;
+
+	// 16 bit faces index at most 65536 wedges, a large prop's worth of triangles
+	constexpr int32 Count = 500000;
+	const auto File = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("PSKReaderFaces16.psk"));
+	TArray<uint8> RawFaces;
+	FFileHelper::SaveArrayToFile(MakeFaces16File(Count, RawFaces), *File);
+
+	TArray<VTriangle> Expected;
+	DecodeFaces16(RawFaces, Expected);
+
+	PSKReader Reader(File);
+	TestTrue(TEXT("Read faces"), Reader.Read(EPSKChunk::Faces));
+	TestEqual(TEXT("Face count"), Reader.Faces.Num(), Count);
+	auto Mismatches = 0;
+	for (auto i = 0; i < FMath::Min(Reader.Faces.Num(), Expected.Num()); i++)
+	{
+		const auto& A = Reader.Faces[i];
+		const auto& B = Expected[i];
+		if (FMemory::Memcmp(A.WedgeIndex, B.WedgeIndex, sizeof(A.WedgeIndex)) != 0 || A.MatIndex != B.MatIndex
+			|| A.AuxMatIndex != B.AuxMatIndex || A.SmoothingGroups != B.SmoothingGroups)
+		{
+			Mismatches++;
+		}
+	}
+	TestEqual(TEXT("Faces that differ from the reference decode"), Mismatches, 0);
+
+	// Opening maps and indexes the file, so what a faces read adds on top of it is the decode
+	const auto OpenSeconds = BestOf(Runs, [&File]
+	{
+		PSKReader Timed(File);
+		Timed.Open();
+	});
+	const auto ReadSeconds = BestOf(Runs, [&File]
+	{
+		PSKReader Timed(File);
+		Timed.Read(EPSKChunk::Faces);
+	});
+	const auto ReferenceSeconds = BestOf(Runs, [&RawFaces, &Expected]
+	{
+		DecodeFaces16(RawFaces, Expected);
+	});
+	const auto DecodeSeconds = FMath::Max(ReadSeconds - OpenSeconds, 0.0);
+	AddInfo(FString::Printf(TEXT("%d faces  reader decode %7.2f ms  field by field %7.2f ms  %5.1fx"),
+		Count, DecodeSeconds * 1000.0, ReferenceSeconds * 1000.0, Speedup(ReferenceSeconds, DecodeSeconds)));
+
+	IFileManager::Get().DeleteFile(*File);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
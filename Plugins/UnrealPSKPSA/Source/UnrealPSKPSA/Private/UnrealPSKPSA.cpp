@@ -2,6 +2,8 @@
 
 #include "UnrealPSKPSA.h"
 
+#include "PSKImportManifest.h"
+
 #define LOCTEXT_NAMESPACE "FUnrealPSKPSAModule"
 
 void FUnrealPSKPSAModule::StartupModule()
@@ -13,6 +15,7 @@ void FUnrealPSKPSAModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FPSKImportManifest::SaveSession();
 }
 
 #undef LOCTEXT_NAMESPACE
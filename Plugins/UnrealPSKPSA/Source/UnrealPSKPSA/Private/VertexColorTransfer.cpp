@@ -0,0 +1,182 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "VertexColorTransfer.h"
+
+#include "PSKReader.h"
+#include "HAL/FileManager.h"
+#include "Rendering/PositionVertexBuffer.h"
+
+namespace VertexColorTransfer
+{
+	// Enough for every mesh of a map; past this the cache is dropped rather than tracked per entry
+	constexpr int32 MaxCachedFiles = 512;
+}
+
+FVertexColorTransfer::FVertexColorTransfer(const float InTolerance)
+{
+	SetTolerance(InTolerance);
+}
+
+void FVertexColorTransfer::SetTolerance(const float InTolerance)
+{
+	const float NewTolerance = FMath::Max(InTolerance, KINDA_SMALL_NUMBER);
+	if (NewTolerance == Tolerance)
+		return;
+
+	Tolerance = NewTolerance;
+	// Cells as wide as the tolerance, so any match is in the vertex's own cell or one of its 26 neighbours
+	InvCellSize = 1.f / Tolerance;
+	HashedPoints = nullptr;
+}
+
+void FVertexColorTransfer::ResetCache()
+{
+	Cache.Reset();
+	HashedPoints = nullptr;
+}
+
+const TArray<FVector3f>* FVertexColorTransfer::GetSourcePoints(const FString& Filename)
+{
+	const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*Filename);
+	if (const TSharedRef<FCachedPoints>* Cached = Cache.Find(Filename))
+	{
+		if ((*Cached)->Timestamp == Timestamp)
+		{
+			return &(*Cached)->Points;
+		}
+	}
+
+	// Positions are all painting needs, the wedges, faces and weights are never decoded
+	auto Reader = PSKReader(Filename);
+	if (!Reader.Read(EPSKChunk::Points))
+	{
+		return nullptr;
+	}
+
+	if (Cache.Num() >= VertexColorTransfer::MaxCachedFiles)
+	{
+		ResetCache();
+	}
+
+	const TSharedRef<FCachedPoints> Entry = MakeShared<FCachedPoints>();
+	Entry->Timestamp = Timestamp;
+	Entry->Points = MoveTemp(Reader.Vertices);
+	for (auto& Point : Entry->Points)
+	{
+		Point.Y = -Point.Y;
+	}
+
+	// A replaced entry may be reallocated at the address the hash was built for
+	HashedPoints = nullptr;
+	Cache.Add(Filename, Entry);
+	return &Entry->Points;
+}
+
+int32 FVertexColorTransfer::Transfer(const TArray<FVector3f>& SourcePoints, const TArray<FColor>& SourceColors, const FPositionVertexBuffer& Target, TArray<FColor>& OutColors, const FColor MissingColor)
+{
+	// Colors are indexed by source point, points past the end of the color array have nothing to give
+	const int32 NumColored = FMath::Min(SourcePoints.Num(), SourceColors.Num());
+	if (HashedPoints != &SourcePoints || HashedCount != NumColored)
+	{
+		BuildHash(SourcePoints, NumColored);
+	}
+
+	const int32 NumVertices = Target.GetNumVertices();
+	OutColors.SetNumUninitialized(NumVertices, false);
+
+	int32 NumMissing = 0;
+	for (int32 Index = 0; Index < NumVertices; Index++)
+	{
+		const int32 Nearest = FindNearest(SourcePoints, Target.VertexPosition(Index));
+		if (Nearest == INDEX_NONE)
+		{
+			OutColors[Index] = MissingColor;
+			NumMissing++;
+			continue;
+		}
+		OutColors[Index] = SourceColors[Nearest];
+	}
+	return NumMissing;
+}
+
+FIntVector FVertexColorTransfer::Quantize(const FVector3f& Position) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Position.X * InvCellSize),
+		FMath::FloorToInt(Position.Y * InvCellSize),
+		FMath::FloorToInt(Position.Z * InvCellSize));
+}
+
+void FVertexColorTransfer::BuildHash(const TArray<FVector3f>& SourcePoints, const int32 NumColored)
+{
+	CellHeads.Reset();
+	CellHeads.Reserve(NumColored);
+	NextInCell.SetNumUninitialized(NumColored, false);
+
+	for (int32 Index = 0; Index < NumColored; Index++)
+	{
+		int32& Head = CellHeads.FindOrAdd(Quantize(SourcePoints[Index]), INDEX_NONE);
+		NextInCell[Index] = Head;
+		Head = Index;
+	}
+
+	HashedPoints = &SourcePoints;
+	HashedCount = NumColored;
+}
+
+int32 FVertexColorTransfer::FindNearest(const TArray<FVector3f>& SourcePoints, const FVector3f& Position) const
+{
+	const FIntVector Cell = Quantize(Position);
+	float BestDistSquared = FMath::Square(Tolerance);
+
+	// Nearly every vertex matches a point in its own cell, only look around when it doesn't
+	int32 Best = FindInCell(SourcePoints, Cell, Position, BestDistSquared);
+	if (Best != INDEX_NONE && BestDistSquared == 0.f)
+	{
+		return Best;
+	}
+
+	for (int32 Z = -1; Z <= 1; Z++)
+	{
+		for (int32 Y = -1; Y <= 1; Y++)
+		{
+			for (int32 X = -1; X <= 1; X++)
+			{
+				if (X == 0 && Y == 0 && Z == 0)
+				{
+					continue;
+				}
+
+				const int32 Found = FindInCell(SourcePoints, Cell + FIntVector(X, Y, Z), Position, BestDistSquared);
+				if (Found != INDEX_NONE)
+				{
+					Best = Found;
+				}
+			}
+		}
+	}
+	return Best;
+}
+
+int32 FVertexColorTransfer::FindInCell(const TArray<FVector3f>& SourcePoints, const FIntVector& Cell, const FVector3f& Position, float& BestDistSquared) const
+{
+	const int32* Head = CellHeads.Find(Cell);
+	if (!Head)
+	{
+		return INDEX_NONE;
+	}
+
+	// Chains run from the last added point, so on ties the last duplicate wins as it did with the exact-position map
+	int32 Best = INDEX_NONE;
+	for (int32 Index = *Head; Index != INDEX_NONE; Index = NextInCell[Index])
+	{
+		const float DistSquared = FVector3f::DistSquared(SourcePoints[Index], Position);
+		if (DistSquared < BestDistSquared || (Best == INDEX_NONE && DistSquared == BestDistSquared))
+		{
+			BestDistSquared = DistSquared;
+			Best = Index;
+		}
+	}
+	return Best;
+}
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FPositionVertexBuffer;
+
+/**
+ * Maps per-point colors from a .pskx onto the vertices of the static mesh built from it.
+ *
+ * The engine reorders and welds vertices when it builds a mesh, so colors are matched by position rather than index.
+ * Source points are quantized into a spatial hash; a target vertex takes the color of the nearest source point within
+ * Tolerance, searching the neighbouring cells when its own cell has no match. Parsed source points are cached per
+ * file and all buffers are reused between calls, so painting many instances of the same mesh parses it once.
+ */
+class FVertexColorTransfer
+{
+public:
+	explicit FVertexColorTransfer(float InTolerance);
+
+	/** Source points of Filename with Y mirrored into engine space, parsed on first use. Null if the file can't be read. */
+	const TArray<FVector3f>* GetSourcePoints(const FString& Filename);
+
+	/**
+	 * Fills OutColors with one color per vertex of Target.
+	 * Vertices with no source point within tolerance get MissingColor.
+	 * @return number of vertices that had no match
+	 */
+	int32 Transfer(const TArray<FVector3f>& SourcePoints, const TArray<FColor>& SourceColors, const FPositionVertexBuffer& Target, TArray<FColor>& OutColors, FColor MissingColor = FColor::White);
+
+	/** Changing the tolerance drops the spatial hash, setting the current value again keeps it */
+	void SetTolerance(float InTolerance);
+
+	/** Drops cached source points */
+	void ResetCache();
+
+private:
+	struct FCachedPoints
+	{
+		FDateTime Timestamp;
+		TArray<FVector3f> Points;
+	};
+
+	FIntVector Quantize(const FVector3f& Position) const;
+
+	void BuildHash(const TArray<FVector3f>& SourcePoints, int32 NumColored);
+
+	int32 FindNearest(const TArray<FVector3f>& SourcePoints, const FVector3f& Position) const;
+
+	int32 FindInCell(const TArray<FVector3f>& SourcePoints, const FIntVector& Cell, const FVector3f& Position, float& BestDistSquared) const;
+
+	float Tolerance = 0.f;
+
+	float InvCellSize = 0.f;
+
+	/** Shared so cached arrays keep their address while the map grows */
+	TMap<FString, TSharedRef<FCachedPoints>> Cache;
+
+	/** Head of each cell's chain, chained through NextInCell */
+	TMap<FIntVector, int32> CellHeads;
+
+	TArray<int32> NextInCell;
+
+	/** Source the hash was last built for, reused while painting many instances of one mesh */
+	const TArray<FVector3f>* HashedPoints = nullptr;
+
+	int32 HashedCount = 0;
+};
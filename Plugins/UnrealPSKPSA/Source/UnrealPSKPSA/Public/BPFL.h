@@ -6,6 +6,22 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "BPFL.generated.h"
 
+/** One component to paint from the per-point colors of the .pskx its mesh was imported from */
+USTRUCT(BlueprintType)
+struct FVertexPaintRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = VertexPainting)
+	UStaticMeshComponent* SMComp = nullptr;
+
+	UPROPERTY(BlueprintReadWrite, Category = VertexPainting)
+	TArray<FColor> VtxColorsArray;
+
+	UPROPERTY(BlueprintReadWrite, Category = VertexPainting)
+	FString FileName;
+};
+
 /**
  * 
  */
@@ -32,6 +48,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = VertexPainting)
 	static void PaintSMVertices(UStaticMeshComponent* SMComp, TArray<FColor> VtxColorsArray, FString FileName);
 	UFUNCTION(BlueprintCallable, Category = VertexPainting)
+	static void PaintSMVerticesBatch(const TArray<FVertexPaintRequest>& Requests);
+	UFUNCTION(BlueprintCallable, Category = VertexPainting)
 	static FColor ReturnFromHex(FString Beka);
 	static TMap<FVector3f, FColor> MakeHashmap(TArray<FVector3f> arr1, TArray<FColor> TestVtx);
 	static TArray<FColor> FixBrokenMesh(UStaticMesh* SMesh, FString ReaderFile, TArray<FColor> BrokenVtxColorArray, TArray<FVector3f> ReaderVerts);
@@ -1,4 +1,5 @@
 ﻿#pragma once
+
 #include "PSKReader.h"
 
 struct VAnimInfoBinary
@@ -31,24 +32,40 @@ struct VAnimScaleKey
 	float Time;
 };
 
+/**
+ * Reads .psa files.
+ *
+ * The file is read or mapped once and each chunk is decoded in a single pass into one contiguous array, keys of every
+ * sequence together. A file can hold several sequences, each one a run of frames in AnimKeys and ScaleKeys that
+ * GetSequenceKeys and GetSequenceScaleKeys slice out without copying.
+ */
 class PSAReader
 {
 public:
 	PSAReader(const FString Filename);
 	bool Read();
 
+	/** Keys of one sequence, frame by frame with a key per bone in each. Empty if the file doesn't hold them all. */
+	TArrayView<const VQuatAnimKey> GetSequenceKeys(int32 SequenceIndex) const;
+
+	/** Scale keys of one sequence laid out like its keys, empty if the file has none for it */
+	TArrayView<const VAnimScaleKey> GetSequenceScaleKeys(int32 SequenceIndex) const;
+
 	// Switches
 	bool bHasScaleKeys;
 	
 	// PSA
+	/** The first sequence, for callers that only import one */
 	VAnimInfoBinary AnimInfo;
+	TArray<VAnimInfoBinary> Sequences;
 	TArray<VNamedBoneBinary> Bones;
 	TArray<VQuatAnimKey> AnimKeys;
 	TArray<VAnimScaleKey> ScaleKeys;
 
 private:
 	bool CheckHeader(const VChunkHeader Header) const;
+	bool ReadChunks(const uint8* Data, int64 Size);
 	const char* HeaderBytes = "ANIMHEAD" + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00;
-	std::ifstream Ar;
+	FString Filename;
 	
 };
@@ -1,7 +1,5 @@
 ﻿#pragma once
 
-#include <fstream>
-
 #include "RawMesh.h"
 
 #define CHUNK(ChunkName) (strncmp(Chunk.ChunkID, ChunkName, strlen(ChunkName)) == 0)
@@ -68,12 +66,69 @@ struct VRawBoneInfluence
 	int BoneIdx;
 };
 
+// Shared by the psk and psa readers
+namespace PSKReaderUtils
+{
+	constexpr int32 BoneSize = 120;		// name[64], flags, children, parent, quat, position, length, size xyz
+
+	// VJointPos is padded in memory (FQuat4f is 16 byte aligned), so bones are unpacked field by field
+	void ReadBones(const uint8* ChunkData, int32 DataCount, TArray<VNamedBoneBinary>& Bones);
+}
+
+// Chunks a caller can ask PSKReader::Read for
+enum class EPSKChunk : uint16
+{
+	None			= 0,
+	Points			= 1 << 0,	// PNTS0000
+	Wedges			= 1 << 1,	// VTXW0000
+	Faces			= 1 << 2,	// FACE0000, FACE3200
+	Materials		= 1 << 3,	// MATT0000
+	Normals			= 1 << 4,	// VTXNORMS
+	VertexColors	= 1 << 5,	// VERTEXCOLOR
+	ExtraUVs		= 1 << 6,	// EXTRAUVS
+	Bones			= 1 << 7,	// REFSKELT, REFSKEL0
+	Influences		= 1 << 8,	// RAWWEIGHTS, RAWW0000
+
+	// What building a static mesh from a .pskx reads
+	StaticMesh		= Points | Wedges | Faces | Materials | Normals | VertexColors | ExtraUVs,
+	All				= StaticMesh | Bones | Influences,
+};
+ENUM_CLASS_FLAGS(EPSKChunk)
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Reads .psk and .pskx files.
+ *
+ * Open maps the file and indexes where each chunk starts without decoding any of them, Read then decodes just the
+ * chunks asked for. Later Reads decode more from the same mapping, so a caller that only needs positions or vertex
+ * colors never pays for wedges, faces or weights.
+ */
 class PSKReader
 {
 	
 public:
 	PSKReader(const FString Filename);
-	bool Read();
+	~PSKReader();
+
+	/** Maps the file and indexes its chunks, decoding nothing. Read calls it when needed. */
+	bool Open();
+
+	/** Decodes the requested chunks that aren't decoded yet, every chunk by default */
+	bool Read(EPSKChunk Chunks = EPSKChunk::All);
+
+	/**
+	 * Unmaps the file and drops the chunk index. Decoded arrays stay and are remembered, a later Read opens the file
+	 * again and decodes only the chunks it didn't have, so extra UV channels aren't appended twice.
+	 */
+	void Close();
+
+	/** Whether the file has any of the chunks, known between Open and Close without decoding them */
+	bool HasChunk(EPSKChunk Chunk) const;
+
+	/** Records in the file's chunks of this kind, known between Open and Close without decoding them */
+	int32 GetChunkCount(EPSKChunk Chunk) const;
 
 	// Switches
 	bool bHasVertexNormals;
@@ -94,9 +149,29 @@ public:
 	TArray<VRawBoneInfluence> Influences;
 
 private:
+	struct FChunkEntry
+	{
+		EPSKChunk Kind;
+		VChunkHeader Header;
+		int64 Offset;
+	};
+
 	bool CheckHeader(const VChunkHeader Header) const;
+	bool IndexChunks();
+	bool DecodeChunk(const FChunkEntry& Entry);
 	const char* HeaderBytes = "ACTRHEAD" + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00 + 0x00;
-	std::ifstream Ar;
+	FString Filename;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	/** The whole file, where it can't be mapped */
+	TArray64<uint8> FileBytes;
+	const uint8* FileData = nullptr;
+	int64 FileSize = 0;
+
+	TArray<FChunkEntry> ChunkIndex;
+	EPSKChunk DecodedChunks = EPSKChunk::None;
+	bool bOpened = false;
 	
 };
 
@@ -3,8 +3,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RawMesh.h"
 #include "PSKXFactory.generated.h"
 
+class FPSKXMaterialCache;
+
+/** Everything Import needs from a .pskx that can be built off the game thread */
+struct FPSKXMeshData
+{
+	FRawMesh RawMesh;
+	TArray<FString> MaterialNames;
+	bool bHasNormals = false;
+};
+
 UCLASS()
 class UNREALPSKPSA_API UPSKXFactory : public UFactory
 {
@@ -22,6 +33,13 @@ public:
 	}
 	
 	UObject* Import(const FString Filename, UObject* Parent, const FName Name, const EObjectFlags Flags) const;
+
+	// Parses the file and assembles the raw mesh. Touches no UObjects, safe to call from worker threads.
+	static bool LoadMeshData(const FString& Filename, FPSKXMeshData& OutData);
+
+	// Creates the static mesh asset from loaded data and builds it. Game thread only.
+	// Materials resolves the slots, share one across every mesh of an import.
+	UStaticMesh* CreateMesh(FPSKXMeshData& Data, UObject* Parent, const FName Name, const EObjectFlags Flags, FPSKXMaterialCache& Materials) const;
 	
 	UClass* FactoryClass = UStaticMesh::StaticClass();
 	FString FactoryExtension = "pskx";
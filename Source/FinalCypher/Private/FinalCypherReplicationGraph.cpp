@@ -0,0 +1,330 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FinalCypherReplicationGraph.h"
+#include "RelevancySubsystem.h"
+#include "SecureCharacter.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetDriver.h"
+#include "EngineLogs.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "ReplicationGraphTypes.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectIterator.h"
+
+void UFinalCypherReplicationGraphNode_Characters::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (ASecureCharacter* Character = Cast<ASecureCharacter>(ActorInfo.Actor))
+	{
+		Characters.AddUnique(Character);
+	}
+}
+
+bool UFinalCypherReplicationGraphNode_Characters::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const bool bRemoved = Characters.RemoveSingleSwap(Cast<ASecureCharacter>(ActorInfo.Actor), false) > 0;
+
+	// Characters destroyed without going through here leave stale entries behind
+	Characters.RemoveAllSwap([](const TWeakObjectPtr<ASecureCharacter>& Character) { return !Character.IsValid(); }, false);
+
+	if (!bRemoved && bWarnIfNotFound)
+	{
+		UE_LOG(LogNet, Warning, TEXT("UFinalCypherReplicationGraphNode_Characters::NotifyRemoveNetworkActor: %s not found"), *GetNameSafe(ActorInfo.Actor));
+	}
+	return bRemoved;
+}
+
+void UFinalCypherReplicationGraphNode_Characters::NotifyResetAllNetworkActors()
+{
+	Characters.Reset();
+	ConnectionLists.Reset();
+}
+
+void UFinalCypherReplicationGraphNode_Characters::NotifyRemoveConnection(UNetReplicationGraphConnection* ConnectionManager)
+{
+	ConnectionLists.Remove(ConnectionManager);
+}
+
+void UFinalCypherReplicationGraphNode_Characters::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	FActorRepListRefView& List = ConnectionLists.FindOrAdd(&Params.ConnectionManager);
+	List.Reset();
+	Gathered.Reset();
+
+	const UWorld* World = GraphGlobals.IsValid() ? GraphGlobals->World : nullptr;
+	const URelevancySubsystem* Relevancy = World ? World->GetSubsystem<URelevancySubsystem>() : nullptr;
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		APlayerController* Controller = Viewer.InViewer;
+		const TBitArray<>* Relevant = Relevancy ? Relevancy->GetRelevantCharacters(Controller) : nullptr;
+
+		if (Relevant)
+		{
+			for (TConstSetBitIterator<> It(*Relevant); It; ++It)
+			{
+				ASecureCharacter* Character = Relevancy->GetCharacter(It.GetIndex());
+				if (!Character)
+				{
+					continue;
+				}
+
+				if (Character->IrrelevantControllers.Num() > 0 && Character->IrrelevantControllers.Contains(Controller))
+				{
+					continue;
+				}
+
+				bool bAlreadyGathered = false;
+				Gathered.Add(Character, &bAlreadyGathered);
+				if (!bAlreadyGathered)
+				{
+					List.Add(Character);
+				}
+			}
+			continue;
+		}
+
+		// No precomputed bits for this viewer yet, fall back to a plain distance test
+		for (const TWeakObjectPtr<ASecureCharacter>& CharacterPtr : Characters)
+		{
+			ASecureCharacter* Character = CharacterPtr.Get();
+			if (!Character)
+			{
+				continue;
+			}
+
+			if (Character->IrrelevantControllers.Num() > 0 && Character->IrrelevantControllers.Contains(Controller))
+			{
+				continue;
+			}
+
+			if (FVector::DistSquared(Character->GetActorLocation(), Viewer.ViewLocation) < Character->NetCullDistanceSquared)
+			{
+				bool bAlreadyGathered = false;
+				Gathered.Add(Character, &bAlreadyGathered);
+				if (!bAlreadyGathered)
+				{
+					List.Add(Character);
+				}
+			}
+		}
+	}
+
+	if (List.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(List);
+	}
+}
+
+void UFinalCypherReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	ReplicationActorList.Reset();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		if (Viewer.InViewer)
+		{
+			ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+			if (APawn* Pawn = Viewer.InViewer->GetPawn())
+			{
+				ReplicationActorList.ConditionalAdd(Pawn);
+			}
+		}
+
+		if (Viewer.ViewTarget)
+		{
+			ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+		}
+	}
+
+	Super::GatherActorListsForConnection(Params);
+}
+
+void UFinalCypherReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	ClassRepNodePolicies.Set(AReplicationGraphDebugActor::StaticClass(), EFinalCypherRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), EFinalCypherRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), EFinalCypherRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), EFinalCypherRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), EFinalCypherRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(AInfo::StaticClass(), EFinalCypherRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(ASecureCharacter::StaticClass(), EFinalCypherRepNodeMapping::Characters);
+
+	const float ServerMaxTickRate = NetDriver ? NetDriver->NetServerMaxTickRate : 30.f;
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (!ActorCDO || !ActorCDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		// Skip blueprint compilation leftovers
+		if (Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const EFinalCypherRepNodeMapping Mapping = GetMappingPolicy(Class);
+
+		FClassReplicationInfo ClassInfo;
+		switch (Mapping)
+		{
+			case EFinalCypherRepNodeMapping::Spatialize_Static:
+			case EFinalCypherRepNodeMapping::Spatialize_Dynamic:
+				ClassInfo.SetCullDistanceSquared(ActorCDO->NetCullDistanceSquared);
+				break;
+			default:
+				// Characters are culled by their own node, the rest are not spatial
+				ClassInfo.SetCullDistanceSquared(0.f);
+				break;
+		}
+
+		ClassInfo.ReplicationPeriodFrame = FMath::Max<uint32>(1, FMath::RoundToInt(ServerMaxTickRate / FMath::Max(ActorCDO->NetUpdateFrequency, 1.f)));
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+void UFinalCypherReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = SpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	CharactersNode = CreateNewNode<UFinalCypherReplicationGraphNode_Characters>();
+	AddGlobalGraphNode(CharactersNode);
+}
+
+void UFinalCypherReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UFinalCypherReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantConnectionNode = CreateNewNode<UFinalCypherReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(AlwaysRelevantConnectionNode, RepGraphConnection);
+}
+
+void UFinalCypherReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	if (ASecureCharacter* Parent = GetParentCharacter(ActorInfo.Actor))
+	{
+		GlobalActorReplicationInfoMap.AddDependentActor(Parent, ActorInfo.Actor);
+		DependentParents.Add(ActorInfo.Actor, Parent);
+		return;
+	}
+
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+		case EFinalCypherRepNodeMapping::RelevantAllConnections:
+			AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Characters:
+			CharactersNode->NotifyAddNetworkActor(ActorInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Spatialize_Static:
+			GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Spatialize_Dynamic:
+			GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+			break;
+		default:
+			break;
+	}
+}
+
+void UFinalCypherReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	TWeakObjectPtr<ASecureCharacter> Parent;
+	if (DependentParents.RemoveAndCopyValue(ActorInfo.Actor, Parent))
+	{
+		if (Parent.IsValid())
+		{
+			GlobalActorReplicationInfoMap.RemoveDependentActor(Parent.Get(), ActorInfo.Actor);
+		}
+		return;
+	}
+
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+		case EFinalCypherRepNodeMapping::RelevantAllConnections:
+			AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Characters:
+			CharactersNode->NotifyRemoveNetworkActor(ActorInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Spatialize_Static:
+			GridNode->RemoveActor_Static(ActorInfo);
+			break;
+		case EFinalCypherRepNodeMapping::Spatialize_Dynamic:
+			GridNode->RemoveActor_Dynamic(ActorInfo);
+			break;
+		default:
+			break;
+	}
+}
+
+void UFinalCypherReplicationGraph::RemoveClientConnection(UNetConnection* NetConnection)
+{
+	for (UNetReplicationGraphConnection* ConnectionManager : Connections)
+	{
+		if (ConnectionManager && ConnectionManager->NetConnection == NetConnection)
+		{
+			CharactersNode->NotifyRemoveConnection(ConnectionManager);
+		}
+	}
+
+	Super::RemoveClientConnection(NetConnection);
+}
+
+ASecureCharacter* UFinalCypherReplicationGraph::GetParentCharacter(const AActor* Actor)
+{
+	if (!Actor || Actor->IsA<ASecureCharacter>() || Actor->bAlwaysRelevant || Actor->bOnlyRelevantToOwner)
+	{
+		return nullptr;
+	}
+
+	if (ASecureCharacter* Owner = Cast<ASecureCharacter>(Actor->GetOwner()))
+	{
+		return Owner;
+	}
+	return Cast<ASecureCharacter>(Actor->GetAttachParentActor());
+}
+
+EFinalCypherRepNodeMapping UFinalCypherReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	if (const EFinalCypherRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	EFinalCypherRepNodeMapping Mapping = EFinalCypherRepNodeMapping::NotRouted;
+	const AActor* ActorCDO = Class ? Cast<AActor>(Class->GetDefaultObject()) : nullptr;
+	if (ActorCDO && !ActorCDO->bOnlyRelevantToOwner)
+	{
+		if (ActorCDO->bAlwaysRelevant)
+		{
+			Mapping = EFinalCypherRepNodeMapping::RelevantAllConnections;
+		}
+		else if (ActorCDO->GetRootComponent() && ActorCDO->GetRootComponent()->Mobility == EComponentMobility::Static)
+		{
+			Mapping = EFinalCypherRepNodeMapping::Spatialize_Static;
+		}
+		else
+		{
+			Mapping = EFinalCypherRepNodeMapping::Spatialize_Dynamic;
+		}
+	}
+
+	ClassRepNodePolicies.Set(Class, Mapping);
+	return Mapping;
+}
@@ -0,0 +1,655 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RelevancySubsystem.h"
+#include "SecureCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarRelevancyIndexEnabled(
+	TEXT("fc.Relevancy.Enabled"),
+	true,
+	TEXT("Answer ASecureCharacter relevancy from the precomputed per-connection bitsets. When false, the stock distance test is used."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarOcclusionEnabled(
+	TEXT("fc.Relevancy.Occlusion.Enabled"),
+	true,
+	TEXT("Stop replicating enemy characters that are not in line of sight of the viewer."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarOcclusionMinTracesPerFrame(
+	TEXT("fc.Relevancy.Occlusion.MinTracesPerFrame"),
+	256,
+	TEXT("Line-of-sight traces issued per server frame when there are few viewer and character pairs."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarOcclusionMaxTracesPerFrame(
+	TEXT("fc.Relevancy.Occlusion.MaxTracesPerFrame"),
+	4096,
+	TEXT("Upper bound on line-of-sight traces issued per server frame. Pairs not traced within the hysteresis window stay relevant."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarOcclusionHysteresis(
+	TEXT("fc.Relevancy.Occlusion.Hysteresis"),
+	0.5f,
+	TEXT("Seconds an enemy stays relevant after it was last in line of sight."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarOcclusionLeadTime(
+	TEXT("fc.Relevancy.Occlusion.LeadTime"),
+	0.15f,
+	TEXT("Seconds of velocity extrapolation applied to trace targets, so moving enemies are sent slightly before they clear a corner."),
+	ECVF_Default);
+
+void URelevancySubsystem::Deinitialize()
+{
+	for (const TWeakObjectPtr<ASecureCharacter>& Character : Characters)
+	{
+		if (Character.IsValid())
+		{
+			Character->RelevancyIndex = INDEX_NONE;
+		}
+	}
+
+	Characters.Reset();
+	CharacterCells.Reset();
+	CharacterCullDistancesSquared.Reset();
+	CharacterLocations.Reset();
+	Grid.Reset();
+	TeamMembers.Reset();
+	Viewers.Reset();
+	ViewerLookup.Reset();
+	LastViewer.Reset();
+	LastViewerIndex = INDEX_NONE;
+	PendingTraces.Reset();
+	OcclusionCursor = 0;
+	bValid = false;
+
+	Super::Deinitialize();
+}
+
+TStatId URelevancySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URelevancySubsystem, STATGROUP_Tickables);
+}
+
+bool URelevancySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URelevancySubsystem::RegisterCharacter(ASecureCharacter* Character)
+{
+	if (!Character || Character->RelevancyIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 Index = Characters.Add(Character);
+	Character->RelevancyIndex = Index;
+
+	const float CullDistanceSquared = Character->NetCullDistanceSquared;
+	CharacterCullDistancesSquared.Add(CullDistanceSquared);
+	CharacterLocations.Add(Character->GetActorLocation());
+
+	// Fail open: a character is treated as seen until a trace proves otherwise
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (FViewerEntry& Viewer : Viewers)
+	{
+		Viewer.Hidden.Add(false);
+		Viewer.Relevant.Add(false);
+		Viewer.LastVisibleTime.Add(Now);
+		Viewer.LastTracedTime.Add(NeverTraced);
+		Viewer.InRange.Add(false);
+	}
+
+	const float CullDistance = FMath::Sqrt(CullDistanceSquared);
+	if (CullDistance > GridCellSize)
+	{
+		// Neighbouring cells must cover the largest cull radius, so widen the grid and re-bucket everything
+		GridCellSize = CullDistance;
+		bGridDirty = true;
+	}
+
+	const FIntPoint Cell = GetCell(CharacterLocations[Index]);
+	CharacterCells.Add(Cell);
+	if (!bGridDirty)
+	{
+		Grid.FindOrAdd(Cell).Add(Index);
+	}
+}
+
+void URelevancySubsystem::UnregisterCharacter(ASecureCharacter* Character)
+{
+	if (!Character || !Characters.IsValidIndex(Character->RelevancyIndex))
+	{
+		return;
+	}
+
+	const int32 Index = Character->RelevancyIndex;
+	const int32 LastIndex = Characters.Num() - 1;
+	Character->RelevancyIndex = INDEX_NONE;
+
+	if (TArray<int32>* Cell = Grid.Find(CharacterCells[Index]))
+	{
+		Cell->RemoveSingleSwap(Index);
+		if (Cell->Num() == 0)
+		{
+			Grid.Remove(CharacterCells[Index]);
+		}
+	}
+
+	if (Index != LastIndex)
+	{
+		// Swap the last character into the freed slot so every array stays dense
+		if (TArray<int32>* LastCell = Grid.Find(CharacterCells[LastIndex]))
+		{
+			const int32 Slot = LastCell->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*LastCell)[Slot] = Index;
+			}
+		}
+
+		Characters[Index] = Characters[LastIndex];
+		CharacterCells[Index] = CharacterCells[LastIndex];
+		CharacterCullDistancesSquared[Index] = CharacterCullDistancesSquared[LastIndex];
+		CharacterLocations[Index] = CharacterLocations[LastIndex];
+
+		for (FViewerEntry& Viewer : Viewers)
+		{
+			Viewer.Hidden[Index] = Viewer.Hidden[LastIndex];
+			Viewer.Relevant[Index] = Viewer.Relevant[LastIndex];
+			Viewer.LastVisibleTime[Index] = Viewer.LastVisibleTime[LastIndex];
+			Viewer.LastTracedTime[Index] = Viewer.LastTracedTime[LastIndex];
+			Viewer.InRange[Index] = Viewer.InRange[LastIndex];
+		}
+
+		if (ASecureCharacter* Moved = Characters[Index].Get())
+		{
+			Moved->RelevancyIndex = Index;
+		}
+	}
+
+	Characters.Pop(false);
+	CharacterCells.Pop(false);
+	CharacterCullDistancesSquared.Pop(false);
+	CharacterLocations.Pop(false);
+
+	for (FViewerEntry& Viewer : Viewers)
+	{
+		Viewer.Hidden.RemoveAt(LastIndex);
+		Viewer.Relevant.RemoveAt(LastIndex);
+		Viewer.LastVisibleTime.Pop(false);
+		Viewer.LastTracedTime.Pop(false);
+		Viewer.InRange.RemoveAt(LastIndex);
+	}
+}
+
+void URelevancySubsystem::SetHiddenFrom(ASecureCharacter* Character, APlayerController* Viewer, bool bHidden)
+{
+	if (!Character || !Viewer || !Characters.IsValidIndex(Character->RelevancyIndex))
+	{
+		return;
+	}
+
+	const int32 ViewerIndex = FindOrAddViewer(Viewer);
+	Viewers[ViewerIndex].Hidden[Character->RelevancyIndex] = bHidden;
+	if (bHidden)
+	{
+		// Take effect immediately rather than on the next rebuild
+		Viewers[ViewerIndex].Relevant[Character->RelevancyIndex] = false;
+	}
+}
+
+void URelevancySubsystem::ClearHidden(ASecureCharacter* Character)
+{
+	if (!Character || !Characters.IsValidIndex(Character->RelevancyIndex))
+	{
+		return;
+	}
+
+	for (FViewerEntry& Viewer : Viewers)
+	{
+		Viewer.Hidden[Character->RelevancyIndex] = false;
+	}
+}
+
+bool URelevancySubsystem::TryGetRelevancy(const ASecureCharacter* Character, const AActor* Viewer, bool& bOutRelevant) const
+{
+	if (!bValid || !Character || !Characters.IsValidIndex(Character->RelevancyIndex))
+	{
+		return false;
+	}
+
+	const int32 ViewerIndex = FindViewer(Viewer);
+	if (ViewerIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bOutRelevant = Viewers[ViewerIndex].Relevant[Character->RelevancyIndex];
+	return true;
+}
+
+const TBitArray<>* URelevancySubsystem::GetRelevantCharacters(const AActor* Viewer) const
+{
+	if (!bValid)
+	{
+		return nullptr;
+	}
+
+	const int32 ViewerIndex = FindViewer(Viewer);
+	return ViewerIndex != INDEX_NONE ? &Viewers[ViewerIndex].Relevant : nullptr;
+}
+
+void URelevancySubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	bValid = World && World->GetNetMode() != NM_Client && CVarRelevancyIndexEnabled.GetValueOnGameThread();
+	if (!bValid)
+	{
+		return;
+	}
+
+	for (TPair<uint8, TBitArray<>>& Team : TeamMembers)
+	{
+		Team.Value.Init(false, Characters.Num());
+	}
+
+	for (int32 Index = 0; Index < Characters.Num(); ++Index)
+	{
+		const ASecureCharacter* Character = Characters[Index].Get();
+		if (!Character)
+		{
+			continue;
+		}
+
+		CharacterLocations[Index] = Character->GetActorLocation();
+
+		if (CharacterCullDistancesSquared[Index] != Character->NetCullDistanceSquared)
+		{
+			CharacterCullDistancesSquared[Index] = Character->NetCullDistanceSquared;
+			const float CullDistance = FMath::Sqrt(Character->NetCullDistanceSquared);
+			if (CullDistance > GridCellSize)
+			{
+				GridCellSize = CullDistance;
+				bGridDirty = true;
+			}
+		}
+
+		if (!bGridDirty)
+		{
+			const FIntPoint Cell = GetCell(CharacterLocations[Index]);
+			if (Cell != CharacterCells[Index])
+			{
+				MoveToCell(Index, Cell);
+			}
+		}
+
+		if (Character->TeamId != NoTeam)
+		{
+			TBitArray<>& Members = TeamMembers.FindOrAdd(Character->TeamId);
+			if (Members.Num() != Characters.Num())
+			{
+				Members.Init(false, Characters.Num());
+			}
+			Members[Index] = true;
+		}
+	}
+
+	if (bGridDirty)
+	{
+		RebuildGrid();
+	}
+
+	SyncViewers();
+
+	const double Now = World->GetTimeSeconds();
+	const bool bOcclusion = CVarOcclusionEnabled.GetValueOnGameThread();
+
+	if (bOcclusion)
+	{
+		CollectOcclusionResults(Now);
+	}
+	else
+	{
+		PendingTraces.Reset();
+	}
+
+	for (FViewerEntry& Viewer : Viewers)
+	{
+		BuildProximity(Viewer, Now);
+	}
+
+	const float Hysteresis = bOcclusion ? CVarOcclusionHysteresis.GetValueOnGameThread() : -1.f;
+	if (bOcclusion)
+	{
+		IssueOcclusionTraces(GetOcclusionBudget(DeltaTime, Hysteresis));
+	}
+
+	for (FViewerEntry& Viewer : Viewers)
+	{
+		FinalizeViewer(Viewer, Now, Hysteresis);
+	}
+}
+
+FIntPoint URelevancySubsystem::GetCell(const FVector& Location) const
+{
+	if (GridCellSize <= 0.f)
+	{
+		return FIntPoint::ZeroValue;
+	}
+
+	return FIntPoint(FMath::FloorToInt(Location.X / GridCellSize), FMath::FloorToInt(Location.Y / GridCellSize));
+}
+
+void URelevancySubsystem::MoveToCell(int32 CharacterIndex, const FIntPoint& NewCell)
+{
+	if (TArray<int32>* OldCell = Grid.Find(CharacterCells[CharacterIndex]))
+	{
+		OldCell->RemoveSingleSwap(CharacterIndex);
+		if (OldCell->Num() == 0)
+		{
+			Grid.Remove(CharacterCells[CharacterIndex]);
+		}
+	}
+
+	Grid.FindOrAdd(NewCell).Add(CharacterIndex);
+	CharacterCells[CharacterIndex] = NewCell;
+}
+
+void URelevancySubsystem::RebuildGrid()
+{
+	Grid.Reset();
+	for (int32 Index = 0; Index < Characters.Num(); ++Index)
+	{
+		CharacterCells[Index] = GetCell(CharacterLocations[Index]);
+		Grid.FindOrAdd(CharacterCells[Index]).Add(Index);
+	}
+	bGridDirty = false;
+}
+
+void URelevancySubsystem::SyncViewers()
+{
+	// Drop viewers whose controller has gone away
+	bool bRemovedViewer = false;
+	for (int32 Index = Viewers.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Viewers[Index].Controller.IsValid())
+		{
+			Viewers.RemoveAtSwap(Index, 1, false);
+			bRemovedViewer = true;
+		}
+	}
+
+	if (bRemovedViewer)
+	{
+		ViewerLookup.Reset();
+		for (int32 Index = 0; Index < Viewers.Num(); ++Index)
+		{
+			ViewerLookup.Add(Viewers[Index].Controller.Get(), Index);
+		}
+		LastViewer.Reset();
+		LastViewerIndex = INDEX_NONE;
+	}
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* Controller = It->Get();
+		if (!Controller)
+		{
+			continue;
+		}
+
+		FViewerEntry& Viewer = Viewers[FindOrAddViewer(Controller)];
+
+		FRotator ViewRotation;
+		Controller->GetPlayerViewPoint(Viewer.ViewLocation, ViewRotation);
+
+		const ASecureCharacter* ViewerCharacter = Cast<ASecureCharacter>(Controller->GetPawn());
+		Viewer.TeamId = ViewerCharacter ? ViewerCharacter->TeamId : NoTeam;
+	}
+}
+
+int32 URelevancySubsystem::FindOrAddViewer(APlayerController* Controller)
+{
+	if (const int32* Existing = ViewerLookup.Find(Controller))
+	{
+		return *Existing;
+	}
+
+	const int32 Index = Viewers.AddDefaulted();
+	Viewers[Index].Controller = Controller;
+	Viewers[Index].Hidden.Init(false, Characters.Num());
+	Viewers[Index].Relevant.Init(false, Characters.Num());
+	Viewers[Index].LastVisibleTime.Init(GetWorld()->GetTimeSeconds(), Characters.Num());
+	Viewers[Index].LastTracedTime.Init(NeverTraced, Characters.Num());
+	Viewers[Index].InRange.Init(false, Characters.Num());
+	ViewerLookup.Add(Controller, Index);
+	return Index;
+}
+
+int32 URelevancySubsystem::FindViewer(const AActor* Viewer) const
+{
+	if (LastViewerIndex != INDEX_NONE && LastViewer.Get() == Viewer)
+	{
+		return LastViewerIndex;
+	}
+
+	const int32* Found = ViewerLookup.Find(Viewer);
+	LastViewer = Viewer;
+	LastViewerIndex = Found ? *Found : INDEX_NONE;
+	return LastViewerIndex;
+}
+
+void URelevancySubsystem::BuildProximity(FViewerEntry& Viewer, double Now)
+{
+	Viewer.Relevant.Init(false, Characters.Num());
+
+	const FIntPoint Center = GetCell(Viewer.ViewLocation);
+	for (int32 Y = -1; Y <= 1; ++Y)
+	{
+		for (int32 X = -1; X <= 1; ++X)
+		{
+			const TArray<int32>* Cell = Grid.Find(Center + FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 Index : *Cell)
+			{
+				if (FVector::DistSquared(CharacterLocations[Index], Viewer.ViewLocation) < CharacterCullDistancesSquared[Index])
+				{
+					Viewer.Relevant[Index] = true;
+				}
+			}
+		}
+	}
+
+	// A character that just came into range has not been traced yet, so it is treated as seen until the next trace says otherwise
+	for (TConstSetBitIterator<> It(Viewer.Relevant); It; ++It)
+	{
+		if (!Viewer.InRange[It.GetIndex()])
+		{
+			Viewer.LastVisibleTime[It.GetIndex()] = Now;
+		}
+	}
+	Viewer.InRange = Viewer.Relevant;
+}
+
+void URelevancySubsystem::FinalizeViewer(FViewerEntry& Viewer, double Now, float Hysteresis)
+{
+	// Drop enemies that have been out of sight for longer than the hysteresis window. A pair the budget has not reached
+	// again within the window has no current answer and fails open, a stale occluded result would cull enemies in plain
+	// sight.
+	if (Hysteresis >= 0.f)
+	{
+		const APlayerController* Controller = Viewer.Controller.Get();
+		const APawn* ViewerPawn = Controller ? Controller->GetPawn() : nullptr;
+
+		for (TConstSetBitIterator<> It(Viewer.Relevant); It; ++It)
+		{
+			if (Now - Viewer.LastVisibleTime[It.GetIndex()] > Hysteresis && Now - Viewer.LastTracedTime[It.GetIndex()] <= Hysteresis
+				&& Characters[It.GetIndex()].Get() != ViewerPawn)
+			{
+				Viewer.Relevant[It.GetIndex()] = false;
+			}
+		}
+	}
+
+	// Teammates are always relevant to each other
+	if (Viewer.TeamId != NoTeam)
+	{
+		if (const TBitArray<>* Members = TeamMembers.Find(Viewer.TeamId))
+		{
+			Viewer.Relevant.CombineWithBitwiseOR(*Members, EBitwiseOperatorFlags::MaintainSize);
+		}
+	}
+
+	for (TConstSetBitIterator<> It(Viewer.Hidden); It; ++It)
+	{
+		Viewer.Relevant[It.GetIndex()] = false;
+	}
+}
+
+bool URelevancySubsystem::IsOcclusionCandidate(const FViewerEntry& Viewer, int32 CharacterIndex) const
+{
+	if (!Viewer.Relevant[CharacterIndex] || Viewer.Hidden[CharacterIndex])
+	{
+		return false;
+	}
+
+	const ASecureCharacter* Character = Characters[CharacterIndex].Get();
+	if (!Character || (Viewer.TeamId != NoTeam && Character->TeamId == Viewer.TeamId))
+	{
+		return false;
+	}
+
+	const APlayerController* Controller = Viewer.Controller.Get();
+	return Controller && Controller->GetPawn() != Character;
+}
+
+void URelevancySubsystem::CollectOcclusionResults(double Now)
+{
+	UWorld* World = GetWorld();
+
+	for (const FPendingOcclusionTrace& Pending : PendingTraces)
+	{
+		FTraceDatum Datum;
+		if (!World->QueryTraceData(Pending.Handle, Datum))
+		{
+			continue;
+		}
+
+		const ASecureCharacter* Character = Pending.Character.Get();
+		const int32* ViewerIndex = ViewerLookup.Find(Pending.Viewer.Get());
+		if (!Character || !ViewerIndex || !Characters.IsValidIndex(Character->RelevancyIndex))
+		{
+			continue;
+		}
+
+		FViewerEntry& Viewer = Viewers[*ViewerIndex];
+		Viewer.LastTracedTime[Character->RelevancyIndex] = Now;
+
+		// Any unobstructed ray to a bounding point counts as seen
+		const bool bBlocked = Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+		if (!bBlocked)
+		{
+			Viewer.LastVisibleTime[Character->RelevancyIndex] = Now;
+		}
+	}
+
+	PendingTraces.Reset();
+}
+
+int32 URelevancySubsystem::GetOcclusionBudget(float DeltaTime, float Hysteresis) const
+{
+	// Aim to trace every pair again in half the hysteresis window at the current frame rate. Pairs the capped budget
+	// cannot reach in time stay relevant in FinalizeViewer, so occlusion culls less rather than hiding visible enemies.
+	const int32 NumPairs = Viewers.Num() * Characters.Num();
+	const float FramesPerPass = FMath::Max(1.f, Hysteresis * 0.5f / FMath::Max(DeltaTime, KINDA_SMALL_NUMBER));
+	const int32 Needed = FMath::CeilToInt(NumPairs * TracesPerPair / FramesPerPass);
+
+	const int32 MaxTraces = CVarOcclusionMaxTracesPerFrame.GetValueOnGameThread();
+	return FMath::Min(FMath::Max(Needed, CVarOcclusionMinTracesPerFrame.GetValueOnGameThread()), MaxTraces);
+}
+
+void URelevancySubsystem::IssueOcclusionTraces(int32 Budget)
+{
+	const int32 NumPairs = Viewers.Num() * Characters.Num();
+	if (NumPairs == 0 || Budget <= 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const float LeadTime = CVarOcclusionLeadTime.GetValueOnGameThread();
+
+	// Only level geometry occludes; other pawns standing in the way should not hide anyone
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	OcclusionCursor %= NumPairs;
+	int32 Visited = 0;
+
+	while (Budget > 0 && Visited < NumPairs)
+	{
+		const int32 Pair = (OcclusionCursor + Visited) % NumPairs;
+		++Visited;
+
+		const FViewerEntry& Viewer = Viewers[Pair / Characters.Num()];
+		const int32 CharacterIndex = Pair % Characters.Num();
+		if (!IsOcclusionCandidate(Viewer, CharacterIndex))
+		{
+			continue;
+		}
+
+		ASecureCharacter* Character = Characters[CharacterIndex].Get();
+		if (!Character)
+		{
+			continue;
+		}
+
+		// Head, centre, feet and both shoulders as seen from the viewer, pushed ahead along the velocity
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+		const float HalfHeight = Capsule ? Capsule->GetScaledCapsuleHalfHeight() : 88.f;
+		const float Radius = Capsule ? Capsule->GetScaledCapsuleRadius() : 34.f;
+		const FVector Center = CharacterLocations[CharacterIndex] + Character->GetVelocity() * LeadTime;
+		const FVector Side = FVector::CrossProduct((Center - Viewer.ViewLocation).GetSafeNormal2D(), FVector::UpVector) * Radius;
+
+		const FVector Points[] =
+		{
+			Center + FVector(0.f, 0.f, HalfHeight * 0.9f),
+			Center,
+			Center - FVector(0.f, 0.f, HalfHeight * 0.9f),
+			Center + Side + FVector(0.f, 0.f, HalfHeight * 0.5f),
+			Center - Side + FVector(0.f, 0.f, HalfHeight * 0.5f),
+		};
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RelevancyOcclusion), false);
+		QueryParams.AddIgnoredActor(Character);
+		if (const APlayerController* Controller = Viewer.Controller.Get())
+		{
+			QueryParams.AddIgnoredActor(Controller->GetPawn());
+		}
+
+		for (const FVector& Point : Points)
+		{
+			FPendingOcclusionTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+			Pending.Handle = World->AsyncLineTraceByObjectType(EAsyncTraceType::Test, Viewer.ViewLocation, Point, ObjectParams, QueryParams);
+			Pending.Viewer = Viewer.Controller;
+			Pending.Character = Character;
+		}
+
+		static_assert(UE_ARRAY_COUNT(Points) == TracesPerPair, "Budget is computed from TracesPerPair");
+		Budget -= TracesPerPair;
+	}
+
+	OcclusionCursor = (OcclusionCursor + Visited) % NumPairs;
+}
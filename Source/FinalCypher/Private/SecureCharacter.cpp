@@ -2,6 +2,9 @@
 
 
 #include "SecureCharacter.h"
+#include "RelevancySubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
 
 // Sets default values
 ASecureCharacter::ASecureCharacter()
@@ -15,7 +18,28 @@ ASecureCharacter::ASecureCharacter()
 void ASecureCharacter::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	if (HasAuthority())
+	{
+		if (URelevancySubsystem* Relevancy = GetWorld()->GetSubsystem<URelevancySubsystem>())
+		{
+			Relevancy->RegisterCharacter(this);
+		}
+	}
+}
+
+void ASecureCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The world can already be gone when a level is torn down
+	if (const UWorld* World = GetWorld())
+	{
+		if (URelevancySubsystem* Relevancy = World->GetSubsystem<URelevancySubsystem>())
+		{
+			Relevancy->UnregisterCharacter(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -38,9 +62,42 @@ bool ASecureCharacter::IsNetRelevantFor
 	const AActor* ViewTarget,
 	const FVector& SrcLocation
 ) const {
-	//APlayerController* playerController = Cast<APlayerController>(RealViewer);
-	const bool irrelevant = IrrelevantControllers.Contains(Cast<APlayerController>(RealViewer));
-	return !irrelevant && Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+	if (IrrelevantControllers.Num() > 0 && IrrelevantControllers.Contains(Cast<APlayerController>(RealViewer)))
+	{
+		return false;
+	}
+
+	// The stock APawn accepts come first: owners, view targets, our own controller and anything based on either side
+	if (bAlwaysRelevant || RealViewer == Controller || IsOwnedBy(ViewTarget) || IsOwnedBy(RealViewer) || this == ViewTarget || ViewTarget == GetInstigator()
+		|| IsBasedOnActor(ViewTarget) || (ViewTarget && ViewTarget->IsBasedOnActor(this)))
+	{
+		return true;
+	}
+
+	// Hidden without collision is never relevant, whatever the index says
+	if ((IsHidden() || bOnlyRelevantToOwner) && (!GetRootComponent() || !GetRootComponent()->IsCollisionEnabled()))
+	{
+		return false;
+	}
+
+	// Riding on a skeletal mesh or on the owner defers to that actor in the stock test, which the index knows nothing about
+	const UPrimitiveComponent* MovementBase = GetMovementBase();
+	const AActor* BaseActor = MovementBase ? MovementBase->GetOwner() : nullptr;
+	const bool bDefersToBase = BaseActor && GetMovementComponent() && (MovementBase->IsA<USkeletalMeshComponent>() || BaseActor == GetOwner());
+
+	if (RelevancyIndex != INDEX_NONE && !bDefersToBase)
+	{
+		if (const URelevancySubsystem* Relevancy = GetWorld()->GetSubsystem<URelevancySubsystem>())
+		{
+			bool bRelevant = false;
+			if (Relevancy->TryGetRelevancy(this, RealViewer, bRelevant))
+			{
+				return bRelevant;
+			}
+		}
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "FinalCypherReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+class ASecureCharacter;
+
+enum class EFinalCypherRepNodeMapping : uint8
+{
+	NotRouted,				// Replicated through the owning connection's node, or not at all
+	RelevantAllConnections,	// Game state, player states and other global info
+	Characters,				// ASecureCharacter, culled per connection by the characters node
+	Spatialize_Static,		// Never moves, goes into the grid once
+	Spatialize_Dynamic,		// Moves, re-bucketed in the grid every frame
+};
+
+/**
+ * Gathers ASecureCharacters per connection from the URelevancySubsystem bitsets.
+ * Characters hidden from a connection (SetHiddenFrom or the legacy IrrelevantControllers set) are never gathered for it,
+ * so this node replaces the per-actor IsNetRelevantFor hook that the replication graph bypasses.
+ */
+UCLASS()
+class FINALCYPHER_API UFinalCypherReplicationGraphNode_Characters : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/** Drops the list kept for a connection that is going away */
+	void NotifyRemoveConnection(UNetReplicationGraphConnection* ConnectionManager);
+
+private:
+	TArray<TWeakObjectPtr<ASecureCharacter>> Characters;
+	TMap<UNetReplicationGraphConnection*, FActorRepListRefView> ConnectionLists;
+
+	/** Characters already gathered for the connection being gathered, reused across connections */
+	TSet<const ASecureCharacter*> Gathered;
+};
+
+/** Always relevant to one connection: its player controller, pawn and view target */
+UCLASS()
+class FINALCYPHER_API UFinalCypherReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+};
+
+/**
+ * Replication graph for dedicated servers. Replaces the default net driver loop, which considers every replicated actor
+ * for every connection each tick, with spatial, always-relevant and per-connection nodes.
+ *
+ * Replicated actors owned by or attached to an ASecureCharacter when they are added (weapons, attachments) are not
+ * routed to any node. They go on the character's dependent-actor list instead and replicate only to connections the
+ * character itself is gathered for, so they can't give away the position of a character that is hidden or culled.
+ */
+UCLASS(Transient, Config = Engine)
+class FINALCYPHER_API UFinalCypherReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual void RemoveClientConnection(UNetConnection* NetConnection) override;
+
+	/** Size of a grid cell in world units */
+	UPROPERTY(Config)
+	float GridCellSize = 10000.f;
+
+	/** Lower bound of the world, keeps cell coordinates positive */
+	UPROPERTY(Config)
+	FVector2D SpatialBias = FVector2D(-150000.f, -200000.f);
+
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* GridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+
+	UPROPERTY()
+	UFinalCypherReplicationGraphNode_Characters* CharactersNode;
+
+private:
+	EFinalCypherRepNodeMapping GetMappingPolicy(UClass* Class);
+
+	/** The character an actor is owned by or attached to, if it should replicate as one of its dependents */
+	static ASecureCharacter* GetParentCharacter(const AActor* Actor);
+
+	TClassMap<EFinalCypherRepNodeMapping> ClassRepNodePolicies;
+
+	/** Parent each dependent actor was added under, so it's removed from the same list if its owner changes */
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<ASecureCharacter>> DependentParents;
+};
@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "RelevancySubsystem.generated.h"
+
+class ASecureCharacter;
+class APlayerController;
+
+/**
+ * Server-side relevancy index for ASecureCharacter.
+ *
+ * Characters are bucketed into a uniform XY grid that is updated incrementally as they cross cells.
+ * Once per frame, before the net driver replicates, every viewer gets a bitset over the registered
+ * characters built from proximity, team membership and per-connection hide flags, so that
+ * ASecureCharacter::IsNetRelevantFor can answer with a single bit test.
+ *
+ * Enemies inside the cull distance are additionally filtered by line of sight. Each frame a budgeted batch of async
+ * traces runs from viewer cameras to the bounding points of enemy characters, and an enemy stays relevant for a short
+ * hysteresis window after it was last seen so that it does not pop in and out at corners. The budget grows with the
+ * number of viewer and character pairs so a full pass always fits in half of that window.
+ */
+UCLASS()
+class FINALCYPHER_API URelevancySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr uint8 NoTeam = 0xFF;
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterCharacter(ASecureCharacter* Character);
+	void UnregisterCharacter(ASecureCharacter* Character);
+
+	/** Hide or reveal a character from one connection, regardless of distance or team */
+	UFUNCTION(BlueprintCallable, Category = "Replication Security")
+	void SetHiddenFrom(ASecureCharacter* Character, APlayerController* Viewer, bool bHidden);
+
+	/** Reveal a character to every connection it was hidden from */
+	UFUNCTION(BlueprintCallable, Category = "Replication Security")
+	void ClearHidden(ASecureCharacter* Character);
+
+	/**
+	 * Look up the precomputed relevancy bit for a character and viewer.
+	 * Returns false when no answer is available (unknown viewer, unregistered character, or the index is disabled),
+	 * in which case the caller should fall back to the stock relevancy test.
+	 */
+	bool TryGetRelevancy(const ASecureCharacter* Character, const AActor* Viewer, bool& bOutRelevant) const;
+
+	/** Characters relevant to a viewer as of the last rebuild, indexed by character slot. Null when no answer is available. */
+	const TBitArray<>* GetRelevantCharacters(const AActor* Viewer) const;
+
+	ASecureCharacter* GetCharacter(int32 Index) const { return Characters.IsValidIndex(Index) ? Characters[Index].Get() : nullptr; }
+
+	bool IsIndexValid() const { return bValid; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FViewerEntry
+	{
+		TWeakObjectPtr<APlayerController> Controller;
+		FVector ViewLocation = FVector::ZeroVector;
+		uint8 TeamId = NoTeam;
+		/** Characters hidden from this connection, indexed by character slot */
+		TBitArray<> Hidden;
+		/** Result of the last rebuild, indexed by character slot */
+		TBitArray<> Relevant;
+		/** World time each character was last in line of sight of this viewer, indexed by character slot */
+		TArray<double> LastVisibleTime;
+		/** World time a trace result for each character last came back for this viewer, indexed by character slot */
+		TArray<double> LastTracedTime;
+		/** Characters inside the cull distance on the previous rebuild, indexed by character slot */
+		TBitArray<> InRange;
+	};
+
+	struct FPendingOcclusionTrace
+	{
+		FTraceHandle Handle;
+		TWeakObjectPtr<APlayerController> Viewer;
+		TWeakObjectPtr<ASecureCharacter> Character;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void MoveToCell(int32 CharacterIndex, const FIntPoint& NewCell);
+	void RebuildGrid();
+	void SyncViewers();
+	int32 FindOrAddViewer(APlayerController* Controller);
+	int32 FindViewer(const AActor* Viewer) const;
+	void BuildProximity(FViewerEntry& Viewer, double Now);
+	void FinalizeViewer(FViewerEntry& Viewer, double Now, float Hysteresis);
+	void CollectOcclusionResults(double Now);
+	int32 GetOcclusionBudget(float DeltaTime, float Hysteresis) const;
+	void IssueOcclusionTraces(int32 Budget);
+	bool IsOcclusionCandidate(const FViewerEntry& Viewer, int32 CharacterIndex) const;
+
+	TArray<TWeakObjectPtr<ASecureCharacter>> Characters;
+	TArray<FIntPoint> CharacterCells;
+	TArray<float> CharacterCullDistancesSquared;
+	TArray<FVector> CharacterLocations;
+
+	TMap<FIntPoint, TArray<int32>> Grid;
+	float GridCellSize = 0.f;
+	bool bGridDirty = false;
+
+	TMap<uint8, TBitArray<>> TeamMembers;
+
+	TArray<FViewerEntry> Viewers;
+	TMap<TWeakObjectPtr<const AActor>, int32> ViewerLookup;
+
+	/** The net driver queries every actor for one connection before moving on, so the last hit answers almost every lookup */
+	mutable TWeakObjectPtr<const AActor> LastViewer;
+	mutable int32 LastViewerIndex = INDEX_NONE;
+
+	/** LastTracedTime of a pair no trace has come back for yet */
+	static constexpr double NeverTraced = -1.0e9;
+
+	/** Head, centre, feet and both shoulders */
+	static constexpr int32 TracesPerPair = 5;
+
+	/** Traces issued last frame, whose results are read back this frame */
+	TArray<FPendingOcclusionTrace> PendingTraces;
+	/** Round-robin position in the flattened viewer x character pair space, so the trace budget is shared fairly */
+	int32 OcclusionCursor = 0;
+
+	bool bValid = false;
+};
@@ -19,10 +19,17 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
+	// Legacy per-character hide list. Prefer URelevancySubsystem::SetHiddenFrom, which is answered from a precomputed bit.
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Replication Security")
 	TSet<APlayerController*> IrrelevantControllers;
 
+	// Characters sharing a team are always relevant to each other. 255 means no team.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication Security")
+	uint8 TeamId = 0xFF;
+
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
@@ -36,4 +43,10 @@ public:
 		const FVector& SrcLocation
 	) const override;
 
+private:
+	friend class URelevancySubsystem;
+
+	// Dense slot in URelevancySubsystem, INDEX_NONE while unregistered
+	int32 RelevancyIndex = INDEX_NONE;
+
 };